@@ -59,6 +59,8 @@ extern "C" {
     uint8_t  last_node;
   } blake2s_state;
 
+  typedef void (*blake2b_record_fn)( void *ctx, const void *in, size_t inlen );
+
   typedef struct blake2b_state__
   {
     uint64_t h[8];
@@ -68,6 +70,8 @@ extern "C" {
     size_t   buflen;
     size_t   outlen;
     uint8_t  last_node;
+    blake2b_record_fn record;     /* when set, updates are handed to it instead of hashed */
+    void             *record_ctx;
   } blake2b_state;
 
   typedef struct blake2sp_state__
@@ -156,6 +160,9 @@ extern "C" {
   int blake2b_update( blake2b_state *S, const void *in, size_t inlen );
   int blake2b_final( blake2b_state *S, void *out, size_t outlen );
 
+  /* Record mode: collects the input of a state's updates, e.g. to hash it later with blake2b_mb */
+  int blake2b_init_record( blake2b_state *S, blake2b_record_fn record, void *ctx );
+
   int blake2sp_init( blake2sp_state *S, size_t outlen );
   int blake2sp_init_key( blake2sp_state *S, size_t outlen, const void *key, size_t keylen );
   int blake2sp_update( blake2sp_state *S, const void *in, size_t inlen );
@@ -187,6 +194,9 @@ extern "C" {
   int blake2xs( void *out, size_t outlen, const void *in, size_t inlen, const void *key, size_t keylen );
   int blake2xb( void *out, size_t outlen, const void *in, size_t inlen, const void *key, size_t keylen );
 
+  /* Multi-buffer API: hashes count independent messages, several at a time in SIMD lanes when the CPU supports it */
+  int blake2b_mb( uint8_t * const *out, size_t outlen, const uint8_t * const *in, const size_t *inlen, size_t count );
+
   /* This is simply an alias for blake2b */
   int blake2( void *out, size_t outlen, const void *in, size_t inlen, const void *key, size_t keylen );
 
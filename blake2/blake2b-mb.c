@@ -0,0 +1,304 @@
+/*
+   BLAKE2 reference source code package - multi-buffer C implementation
+
+   Hashes several independent messages at once, one message per 64-bit
+   SIMD lane, so that the compression function runs on four messages for
+   roughly the cost of one. The AVX2 kernel is selected at runtime; other
+   CPUs and compilers fall back to one blake2b() call per message.
+
+   You may use this under the terms of the CC0, the OpenSSL Licence, or
+   the Apache Public License 2.0, at your option.  The terms of these
+   licenses can be found at:
+
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+   - OpenSSL license   : https://www.openssl.org/source/license.html
+   - Apache 2.0        : http://www.apache.org/licenses/LICENSE-2.0
+
+   More information about the BLAKE2 hash function can be found at
+   https://blake2.net.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "blake2.h"
+#include "blake2-impl.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define BLAKE2B_MB_AVX2
+#include <immintrin.h>
+#endif
+
+int blake2b_init_record( blake2b_state *S, blake2b_record_fn record, void *ctx )
+{
+  if( NULL == record ) return -1;
+
+  memset( S, 0, sizeof( blake2b_state ) );
+  S->outlen = BLAKE2B_OUTBYTES;
+  S->record = record;
+  S->record_ctx = ctx;
+  return 0;
+}
+
+static int blake2b_mb_scalar( uint8_t * const *out, size_t outlen,
+                              const uint8_t * const *in, const size_t *inlen,
+                              size_t count )
+{
+  size_t i;
+  for( i = 0; i < count; ++i )
+  {
+    if( blake2b( out[i], outlen, in[i], inlen[i], NULL, 0 ) < 0 )
+      return -1;
+  }
+  return 0;
+}
+
+#if defined(BLAKE2B_MB_AVX2)
+
+#define BLAKE2B_MB_LANES 4
+#define BLAKE2B_MB_TARGET __attribute__((target("avx2")))
+
+static const uint64_t blake2b_mb_IV[8] =
+{
+  0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+  0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+  0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+  0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const uint8_t blake2b_mb_sigma[12][16] =
+{
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+  { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 } ,
+  { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 } ,
+  {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 } ,
+  {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 } ,
+  {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 } ,
+  { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 } ,
+  { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 } ,
+  {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 } ,
+  { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 } ,
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 } ,
+  { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 }
+};
+
+#define MB_ROTR32(x) _mm256_shuffle_epi32( (x), _MM_SHUFFLE( 2, 3, 0, 1 ) )
+#define MB_ROTR24(x) _mm256_shuffle_epi8( (x), r24 )
+#define MB_ROTR16(x) _mm256_shuffle_epi8( (x), r16 )
+#define MB_ROTR63(x) _mm256_xor_si256( _mm256_srli_epi64( (x), 63 ), _mm256_add_epi64( (x), (x) ) )
+
+#define MB_G(r,i,a,b,c,d)                                                      \
+  do {                                                                         \
+    a = _mm256_add_epi64( _mm256_add_epi64( a, b ), m[blake2b_mb_sigma[r][2*i+0]] ); \
+    d = MB_ROTR32( _mm256_xor_si256( d, a ) );                                 \
+    c = _mm256_add_epi64( c, d );                                              \
+    b = MB_ROTR24( _mm256_xor_si256( b, c ) );                                 \
+    a = _mm256_add_epi64( _mm256_add_epi64( a, b ), m[blake2b_mb_sigma[r][2*i+1]] ); \
+    d = MB_ROTR16( _mm256_xor_si256( d, a ) );                                 \
+    c = _mm256_add_epi64( c, d );                                              \
+    b = MB_ROTR63( _mm256_xor_si256( b, c ) );                                 \
+  } while(0)
+
+#define MB_ROUND(r)                              \
+  do {                                           \
+    MB_G(r,0,v[ 0],v[ 4],v[ 8],v[12]);           \
+    MB_G(r,1,v[ 1],v[ 5],v[ 9],v[13]);           \
+    MB_G(r,2,v[ 2],v[ 6],v[10],v[14]);           \
+    MB_G(r,3,v[ 3],v[ 7],v[11],v[15]);           \
+    MB_G(r,4,v[ 0],v[ 5],v[10],v[15]);           \
+    MB_G(r,5,v[ 1],v[ 6],v[11],v[12]);           \
+    MB_G(r,6,v[ 2],v[ 7],v[ 8],v[13]);           \
+    MB_G(r,7,v[ 3],v[ 4],v[ 9],v[14]);           \
+  } while(0)
+
+/* Compress one block of each lane. Lanes whose mask is zero keep their state. */
+BLAKE2B_MB_TARGET
+static void blake2b_mb_compress4( __m256i h[8], const uint8_t * const block[BLAKE2B_MB_LANES],
+                                  __m256i t, __m256i f, __m256i active )
+{
+  const __m256i r16 = _mm256_setr_epi8( 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                        2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9 );
+  const __m256i r24 = _mm256_setr_epi8( 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                        3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10 );
+  __m256i m[16];
+  __m256i v[16];
+  size_t i;
+
+  /* Transpose the lanes' blocks so that m[j] holds word j of every lane. */
+  for( i = 0; i < 4; ++i )
+  {
+    const __m256i r0 = _mm256_loadu_si256( (const __m256i *)( block[0] + 32 * i ) );
+    const __m256i r1 = _mm256_loadu_si256( (const __m256i *)( block[1] + 32 * i ) );
+    const __m256i r2 = _mm256_loadu_si256( (const __m256i *)( block[2] + 32 * i ) );
+    const __m256i r3 = _mm256_loadu_si256( (const __m256i *)( block[3] + 32 * i ) );
+    const __m256i t0 = _mm256_unpacklo_epi64( r0, r1 );
+    const __m256i t1 = _mm256_unpackhi_epi64( r0, r1 );
+    const __m256i t2 = _mm256_unpacklo_epi64( r2, r3 );
+    const __m256i t3 = _mm256_unpackhi_epi64( r2, r3 );
+    m[4 * i + 0] = _mm256_permute2x128_si256( t0, t2, 0x20 );
+    m[4 * i + 1] = _mm256_permute2x128_si256( t1, t3, 0x20 );
+    m[4 * i + 2] = _mm256_permute2x128_si256( t0, t2, 0x31 );
+    m[4 * i + 3] = _mm256_permute2x128_si256( t1, t3, 0x31 );
+  }
+
+  for( i = 0; i < 8; ++i )
+    v[i] = h[i];
+  for( i = 0; i < 4; ++i )
+    v[8 + i] = _mm256_set1_epi64x( (long long)blake2b_mb_IV[i] );
+  v[12] = _mm256_xor_si256( _mm256_set1_epi64x( (long long)blake2b_mb_IV[4] ), t );
+  v[13] = _mm256_set1_epi64x( (long long)blake2b_mb_IV[5] );
+  v[14] = _mm256_xor_si256( _mm256_set1_epi64x( (long long)blake2b_mb_IV[6] ), f );
+  v[15] = _mm256_set1_epi64x( (long long)blake2b_mb_IV[7] );
+
+  MB_ROUND( 0 );
+  MB_ROUND( 1 );
+  MB_ROUND( 2 );
+  MB_ROUND( 3 );
+  MB_ROUND( 4 );
+  MB_ROUND( 5 );
+  MB_ROUND( 6 );
+  MB_ROUND( 7 );
+  MB_ROUND( 8 );
+  MB_ROUND( 9 );
+  MB_ROUND( 10 );
+  MB_ROUND( 11 );
+
+  for( i = 0; i < 8; ++i )
+  {
+    const __m256i next = _mm256_xor_si256( h[i], _mm256_xor_si256( v[i], v[i + 8] ) );
+    h[i] = _mm256_blendv_epi8( h[i], next, active );
+  }
+}
+
+BLAKE2B_MB_TARGET
+static void blake2b_mb_hash4( uint8_t * const out[BLAKE2B_MB_LANES], size_t outlen,
+                              const uint8_t * const in[BLAKE2B_MB_LANES],
+                              const size_t inlen[BLAKE2B_MB_LANES] )
+{
+  static const uint8_t zero[BLAKE2B_BLOCKBYTES] = { 0 };
+  uint8_t last[BLAKE2B_MB_LANES][BLAKE2B_BLOCKBYTES];
+  uint64_t words[8][BLAKE2B_MB_LANES];
+  size_t blocks[BLAKE2B_MB_LANES];
+  size_t most = 0;
+  size_t b, i, l;
+  __m256i h[8];
+
+  for( l = 0; l < BLAKE2B_MB_LANES; ++l )
+  {
+    /* Like blake2b_update, the last block is always held back for final. */
+    size_t tail;
+    blocks[l] = inlen[l] ? ( inlen[l] + BLAKE2B_BLOCKBYTES - 1 ) / BLAKE2B_BLOCKBYTES : 1;
+    tail = inlen[l] - ( blocks[l] - 1 ) * BLAKE2B_BLOCKBYTES;
+    memset( last[l], 0, BLAKE2B_BLOCKBYTES );
+    if( tail )
+      memcpy( last[l], in[l] + ( blocks[l] - 1 ) * BLAKE2B_BLOCKBYTES, tail );
+    if( blocks[l] > most )
+      most = blocks[l];
+  }
+
+  for( i = 0; i < 8; ++i )
+    h[i] = _mm256_set1_epi64x( (long long)blake2b_mb_IV[i] );
+  /* Parameter block: digest length, no key, fanout 1, depth 1. */
+  h[0] = _mm256_xor_si256( h[0], _mm256_set1_epi64x( (long long)( 0x01010000ULL ^ outlen ) ) );
+
+  for( b = 0; b < most; ++b )
+  {
+    const uint8_t *block[BLAKE2B_MB_LANES];
+    uint64_t t[BLAKE2B_MB_LANES];
+    uint64_t f[BLAKE2B_MB_LANES];
+    uint64_t active[BLAKE2B_MB_LANES];
+
+    for( l = 0; l < BLAKE2B_MB_LANES; ++l )
+    {
+      if( b + 1 < blocks[l] )
+      {
+        block[l] = in[l] + b * BLAKE2B_BLOCKBYTES;
+        t[l] = ( b + 1 ) * BLAKE2B_BLOCKBYTES;
+        f[l] = 0;
+        active[l] = ~0ULL;
+      }
+      else if( b + 1 == blocks[l] )
+      {
+        block[l] = last[l];
+        t[l] = inlen[l];
+        f[l] = ~0ULL;
+        active[l] = ~0ULL;
+      }
+      else
+      {
+        block[l] = zero;
+        t[l] = 0;
+        f[l] = 0;
+        active[l] = 0;
+      }
+    }
+
+    blake2b_mb_compress4( h, block,
+                          _mm256_setr_epi64x( (long long)t[0], (long long)t[1], (long long)t[2], (long long)t[3] ),
+                          _mm256_setr_epi64x( (long long)f[0], (long long)f[1], (long long)f[2], (long long)f[3] ),
+                          _mm256_setr_epi64x( (long long)active[0], (long long)active[1],
+                                              (long long)active[2], (long long)active[3] ) );
+  }
+
+  for( i = 0; i < 8; ++i )
+    _mm256_storeu_si256( (__m256i *)words[i], h[i] );
+
+  for( l = 0; l < BLAKE2B_MB_LANES; ++l )
+  {
+    uint8_t digest[BLAKE2B_OUTBYTES];
+    if( NULL == out[l] )
+      continue;
+    for( i = 0; i < 8; ++i )
+      store64( digest + 8 * i, words[i][l] );
+    memcpy( out[l], digest, outlen );
+  }
+}
+
+static int blake2b_mb_has_avx2( void )
+{
+  static int cached = -1;
+  if( cached < 0 )
+  {
+    __builtin_cpu_init();
+    cached = __builtin_cpu_supports( "avx2" ) ? 1 : 0;
+  }
+  return cached;
+}
+
+#endif
+
+int blake2b_mb( uint8_t * const *out, size_t outlen,
+                const uint8_t * const *in, const size_t *inlen,
+                size_t count )
+{
+  if( NULL == out || NULL == in || NULL == inlen ) return -1;
+
+  if( !outlen || outlen > BLAKE2B_OUTBYTES ) return -1;
+
+#if defined(BLAKE2B_MB_AVX2)
+  if( blake2b_mb_has_avx2() )
+  {
+    size_t i, l;
+    for( i = 0; i < count; i += BLAKE2B_MB_LANES )
+    {
+      uint8_t *lane_out[BLAKE2B_MB_LANES];
+      const uint8_t *lane_in[BLAKE2B_MB_LANES];
+      size_t lane_len[BLAKE2B_MB_LANES];
+
+      /* A short last group runs idle lanes on an empty message. */
+      for( l = 0; l < BLAKE2B_MB_LANES; ++l )
+      {
+        lane_out[l] = i + l < count ? out[i + l] : NULL;
+        lane_in[l]  = i + l < count ? in[i + l] : NULL;
+        lane_len[l] = i + l < count ? inlen[i + l] : 0;
+        if( NULL == lane_in[l] && lane_len[l] > 0 ) return -1;
+      }
+
+      blake2b_mb_hash4( lane_out, outlen, lane_in, lane_len );
+    }
+    return 0;
+  }
+#endif
+
+  return blake2b_mb_scalar( out, outlen, in, inlen, count );
+}
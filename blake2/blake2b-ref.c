@@ -221,6 +221,12 @@ static void blake2b_compress( blake2b_state *S, const uint8_t block[BLAKE2B_BLOC
 int blake2b_update( blake2b_state *S, const void *pin, size_t inlen )
 {
   const unsigned char * in = (const unsigned char *)pin;
+  if( S->record )
+  {
+    if( inlen > 0 )
+      S->record( S->record_ctx, pin, inlen );
+    return 0;
+  }
   if( inlen > 0 )
   {
     size_t left = S->buflen;
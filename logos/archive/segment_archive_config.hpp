@@ -0,0 +1,47 @@
+/// @file
+/// This file contains the declaration of the segment archive configuration.
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <string>
+
+struct SegmentArchiveConfig
+{
+    static constexpr uint32_t DEFAULT_FRAME_SIZE = 64 * 1024;
+    static constexpr uint32_t MIN_LAG            = 2;
+
+    bool DeserializeJson(boost::property_tree::ptree & tree)
+    {
+        enable = tree.get<bool>("enable", false);
+        path = tree.get<std::string>("path", "");
+        lag = tree.get<uint32_t>("lag", MIN_LAG);
+        frame_size = tree.get<uint32_t>("frame_size", DEFAULT_FRAME_SIZE);
+        cached_frames = tree.get<uint32_t>("cached_frames", 256);
+
+        return lag < MIN_LAG || frame_size == 0;
+    }
+
+    bool SerializeJson(boost::property_tree::ptree & tree) const
+    {
+        tree.put("enable", enable);
+        tree.put("path", path);
+        tree.put("lag", lag);
+        tree.put("frame_size", frame_size);
+        tree.put("cached_frames", cached_frames);
+
+        return false;
+    }
+
+    boost::filesystem::path Directory(const boost::filesystem::path & data_path) const
+    {
+        return path.empty() ? data_path / "segments" : boost::filesystem::path(path);
+    }
+
+    bool        enable        = false;              ///< move the blocks of finalized epochs to segments
+    std::string path;                               ///< empty for <data_path>/segments
+    uint32_t    lag           = MIN_LAG;            ///< epochs behind the epoch tip kept in the database
+    uint32_t    frame_size    = DEFAULT_FRAME_SIZE; ///< raw bytes per compressed frame
+    uint32_t    cached_frames = 256;                ///< decompressed frames kept in memory
+};
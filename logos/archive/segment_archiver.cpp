@@ -0,0 +1,291 @@
+/// @file
+/// This file contains the implementation of SegmentArchiver.
+
+#include <logos/archive/segment_archiver.hpp>
+#include <logos/lib/trace.hpp>
+
+#include <algorithm>
+#include <array>
+#include <unordered_set>
+
+constexpr uint32_t SegmentArchiveConfig::DEFAULT_FRAME_SIZE;
+constexpr uint32_t SegmentArchiveConfig::MIN_LAG;
+
+SegmentArchiver::SegmentArchiver(Store & store, const SegmentArchiveConfig & config)
+    : _store(store)
+    , _config(config)
+    , _thread([this](){ Run(); })
+{}
+
+SegmentArchiver::~SegmentArchiver()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+    }
+    _condition.notify_one();
+    _thread.join();
+}
+
+void SegmentArchiver::OnEpochBlock(uint32_t epoch_number)
+{
+    if(epoch_number <= _config.lag)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending = std::max(_pending, epoch_number - _config.lag);
+    }
+    _condition.notify_one();
+}
+
+void SegmentArchiver::Run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while(true)
+    {
+        _condition.wait(lock, [this](){ return _stopped || _pending; });
+        if(_stopped)
+        {
+            return;
+        }
+
+        auto target = _pending;
+        _pending = 0;
+        lock.unlock();
+
+        ArchiveUpTo(target);
+
+        lock.lock();
+    }
+}
+
+bool SegmentArchiver::Stopped()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stopped;
+}
+
+void SegmentArchiver::ArchiveUpTo(uint32_t target)
+{
+    // Epoch 0 holds genesis and is never archived.
+    uint32_t archived = 0;
+    {
+        logos::transaction transaction(_store.environment, nullptr, false);
+        _store.segment_archived_get(archived, transaction);
+    }
+    if(target <= archived)
+    {
+        return;
+    }
+
+    // Epoch blocks from target back to the last archived one, whose micro
+    // block tip bounds the first epoch to archive.
+    std::vector<ApprovedEB> epochs;
+    Tip tip;
+    if(_store.epoch_tip_get(tip))
+    {
+        return;
+    }
+    for(auto hash = tip.digest; !hash.is_zero();)
+    {
+        ApprovedEB epoch;
+        if(_store.epoch_get(hash, epoch))
+        {
+            LOG_ERROR(_log) << "SegmentArchiver::ArchiveUpTo - failed to get epoch block " << hash.to_string();
+            return;
+        }
+        if(epoch.epoch_number < archived)
+        {
+            break;
+        }
+        hash = epoch.previous;
+        if(epoch.epoch_number <= target)
+        {
+            epochs.push_back(std::move(epoch));
+        }
+    }
+    std::reverse(epochs.begin(), epochs.end());
+
+    for(size_t i = 0; i < epochs.size() && !Stopped(); ++i)
+    {
+        if(epochs[i].epoch_number <= archived)
+        {
+            continue;
+        }
+
+        if(Archive(epochs[i], i ? &epochs[i - 1] : nullptr))
+        {
+            LOG_ERROR(_log) << "SegmentArchiver::ArchiveUpTo - failed to archive epoch "
+                            << epochs[i].epoch_number;
+            return;
+        }
+    }
+}
+
+bool SegmentArchiver::Archive(const ApprovedEB & epoch, const ApprovedEB * previous)
+{
+    if(!_store.segments)
+    {
+        return true;
+    }
+
+    // Micro blocks of the epoch, newest first.
+    auto stop = previous ? previous->micro_block_tip.digest : BlockHash();
+    std::vector<ApprovedMB> micro_blocks;
+    for(auto hash = epoch.micro_block_tip.digest; !hash.is_zero() && hash != stop;)
+    {
+        ApprovedMB micro_block;
+        if(_store.micro_block_get(hash, micro_block))
+        {
+            LOG_ERROR(_log) << "SegmentArchiver::Archive - failed to get micro block " << hash.to_string();
+            return true;
+        }
+        hash = micro_block.previous;
+        micro_blocks.push_back(std::move(micro_block));
+    }
+
+    // Request blocks cut by them, per delegate, newest first.
+    std::array<std::vector<ApprovedRB>, NUM_DELEGATES> batches;
+    if(!micro_blocks.empty())
+    {
+        BatchTipHashes start;
+        BatchTipHashes end;
+        ApprovedMB previous_micro_block;
+        bool has_previous = !stop.is_zero() && !_store.micro_block_get(stop, previous_micro_block);
+
+        for(uint8_t delegate = 0; delegate < NUM_DELEGATES; ++delegate)
+        {
+            start[delegate] = micro_blocks.front().tips[delegate].digest;
+            end[delegate] = has_previous ? previous_micro_block.tips[delegate].digest : BlockHash();
+        }
+
+        _store.BatchBlocksIterator(start, end, [&batches](uint8_t delegate, const ApprovedRB & batch)
+        {
+            batches[delegate].push_back(batch);
+        });
+    }
+
+    struct Record
+    {
+        MDB_dbi *       db;
+        BlockHash       hash;
+        SegmentLocation location;
+    };
+    std::vector<Record> records;
+    std::vector<BlockHash> deferred;
+
+    SegmentWriter writer(_store.segments->Directory(), epoch.epoch_number, _config.frame_size);
+    {
+        logos::transaction read(_store.environment, nullptr, false);
+        auto history = _store.history_txn(read);
+
+        // A delegate idle since the epoch still has its last request block
+        // as tip, which gets its next once the delegate proposes again.
+        // Tips stay in the database with their requests, and are archived
+        // with a later epoch once they're linked.
+        std::unordered_set<BlockHash> tips;
+        for(auto it = logos::store_iterator(read, _store.request_tips_db); it != logos::store_iterator(nullptr); ++it)
+        {
+            bool error = false;
+            Tip tip(error, it->second);
+            if(error)
+            {
+                LOG_ERROR(_log) << "SegmentArchiver::Archive - failed to read a request block tip";
+                return true;
+            }
+            tips.insert(tip.digest);
+        }
+
+        auto add = [&](MDB_dbi & db, const BlockHash & hash)
+        {
+            // Records missing from the table were archived already.
+            logos::mdb_val value;
+            if(mdb_get(history, db, logos::mdb_val(hash), value))
+            {
+                return false;
+            }
+            records.push_back({&db, hash, SegmentLocation()});
+            return writer.Add(_store.segment_table(db), value, records.back().location);
+        };
+
+        auto add_batch = [&](const ApprovedRB & batch)
+        {
+            auto hash = batch.Hash();
+            if(batch.next.is_zero() || tips.count(hash))
+            {
+                deferred.push_back(hash);
+                return false;
+            }
+            bool error = add(_store.batch_db, hash);
+            for(auto & request : batch.hashes)
+            {
+                error |= add(_store.request_db, request);
+            }
+            return error;
+        };
+
+        // Oldest first, in the order chains are walked by bootstrap.
+        std::vector<BlockHash> earlier;
+        _store.segment_deferred_get(earlier, read);
+        bool error = false;
+        for(auto & hash : earlier)
+        {
+            ApprovedRB batch;
+            if(_store.request_block_get(hash, batch, read))
+            {
+                LOG_ERROR(_log) << "SegmentArchiver::Archive - failed to get deferred request block " << hash.to_string();
+                return true;
+            }
+            error |= add_batch(batch);
+        }
+
+        error |= add(_store.epoch_db, epoch.Hash());
+        for(auto mb = micro_blocks.rbegin(); !error && mb != micro_blocks.rend(); ++mb)
+        {
+            error |= add(_store.micro_block_db, mb->Hash());
+        }
+        for(auto & chain : batches)
+        {
+            for(auto batch = chain.rbegin(); !error && batch != chain.rend(); ++batch)
+            {
+                error |= add_batch(*batch);
+            }
+        }
+
+        if(error || writer.Finish())
+        {
+            LOG_ERROR(_log) << "SegmentArchiver::Archive - failed to write segment of epoch "
+                            << epoch.epoch_number;
+            return true;
+        }
+    }
+
+    {
+        logos::transaction write(_store.environment, nullptr, true);
+        auto history = _store.history_txn(write);
+
+        std::vector<uint8_t> buf;
+        for(auto & record : records)
+        {
+            buf.clear();
+            if(mdb_put(history, _store.segment_index_db, logos::mdb_val(record.hash),
+                       record.location.to_mdb_val(buf), 0)
+               || mdb_del(history, *record.db, logos::mdb_val(record.hash), nullptr))
+            {
+                LOG_FATAL(_log) << "SegmentArchiver::Archive - failed to index " << record.hash.to_string();
+                trace_and_halt();
+            }
+        }
+        _store.segment_deferred_put(deferred, write);
+        _store.segment_archived_put(epoch.epoch_number, write);
+    }
+
+    LOG_INFO(_log) << "SegmentArchiver::Archive - archived " << records.size() << " records of epoch "
+                   << epoch.epoch_number << ", " << writer.RawSize() << " bytes stored in "
+                   << writer.StoredSize();
+    return false;
+}
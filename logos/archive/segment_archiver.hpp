@@ -0,0 +1,61 @@
+/// @file
+/// This file contains the declaration of SegmentArchiver, which moves the
+/// blocks of finalized epochs from the database to segment files.
+#pragma once
+
+#include <logos/archive/segment_archive_config.hpp>
+#include <logos/blockstore.hpp>
+
+#include <condition_variable>
+#include <thread>
+#include <mutex>
+
+/// Archives epochs once they are config.lag epochs behind the epoch tip,
+/// by which time their blocks are never written again. An epoch's segment
+/// holds its epoch block, its micro blocks and the request blocks they cut,
+/// each followed by its requests. A request block without a next, or still
+/// a delegate's tip in request_tips_db, is left in the database, as it is
+/// linked to the delegate's next request block; it's recorded and archived
+/// with the first later epoch by which it's linked.
+///
+/// The segment is written and synced first, then a single transaction
+/// indexes the records and removes them from their tables, so a crash
+/// leaves either the records in the database or a complete segment.
+class SegmentArchiver
+{
+    using Store = logos::block_store;
+
+public:
+
+    SegmentArchiver(Store & store, const SegmentArchiveConfig & config);
+
+    ~SegmentArchiver();
+
+    /// Called when an epoch block is persisted. Epochs up to
+    /// epoch_number - config.lag are archived on the archiver's thread.
+    void OnEpochBlock(uint32_t epoch_number);
+
+    /// Archive one epoch.
+    ///     @param epoch the epoch's block
+    ///     @param previous the preceding epoch block, nullptr if none
+    ///     @returns true on error
+    bool Archive(const ApprovedEB & epoch, const ApprovedEB * previous);
+
+private:
+
+    void Run();
+
+    /// Archive all epochs after the last archived one up to target.
+    void ArchiveUpTo(uint32_t target);
+
+    bool Stopped();
+
+    Store &                  _store;
+    SegmentArchiveConfig     _config;
+    std::mutex               _mutex;
+    std::condition_variable  _condition;
+    uint32_t                 _pending = 0;
+    bool                     _stopped = false;
+    Log                      _log;
+    std::thread              _thread; ///< declared last, it runs as soon as it's constructed
+};
@@ -0,0 +1,399 @@
+/// @file
+/// This file contains the implementation of SegmentStore and SegmentWriter.
+
+#include <logos/archive/segment_store.hpp>
+#include <logos/lib/lz.hpp>
+#include <logos/lib/span_stream.hpp>
+
+#include <xxhash/xxhash.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+constexpr uint32_t SegmentLocation::WireSize;
+constexpr uint32_t SegmentFormat::MAGIC;
+constexpr uint8_t SegmentFormat::VERSION;
+constexpr uint32_t SegmentFormat::MAX_RECORD_SIZE;
+constexpr size_t SegmentFormat::HEADER_SIZE;
+constexpr size_t SegmentFormat::FRAME_HEADER_SIZE;
+
+namespace
+{
+
+const std::string SEGMENT_PREFIX = "epoch_";
+const std::string SEGMENT_SUFFIX = ".seg";
+
+struct SegmentHeader
+{
+    uint32_t magic   = SegmentFormat::MAGIC;
+    uint8_t  version = SegmentFormat::VERSION;
+    uint32_t segment = 0;
+
+    void Serialize(std::vector<uint8_t> & buf) const
+    {
+        buf.resize(SegmentFormat::HEADER_SIZE);
+        logos::span_writer stream(buf.data(), buf.size());
+        logos::write(stream, magic);
+        logos::write(stream, version);
+        logos::write(stream, segment);
+    }
+
+    bool Deserialize(const uint8_t * data)
+    {
+        logos::span_reader stream(data, SegmentFormat::HEADER_SIZE);
+        return logos::read(stream, magic) || logos::read(stream, version) || logos::read(stream, segment);
+    }
+};
+
+struct FrameHeader
+{
+    uint32_t raw_size    = 0;
+    uint32_t stored_size = 0;
+    uint8_t  compressed  = 0;
+    uint64_t checksum    = 0;
+
+    void Serialize(std::vector<uint8_t> & buf) const
+    {
+        buf.resize(SegmentFormat::FRAME_HEADER_SIZE);
+        logos::span_writer stream(buf.data(), buf.size());
+        logos::write(stream, raw_size);
+        logos::write(stream, stored_size);
+        logos::write(stream, compressed);
+        logos::write(stream, checksum);
+    }
+
+    bool Deserialize(const uint8_t * data)
+    {
+        logos::span_reader stream(data, SegmentFormat::FRAME_HEADER_SIZE);
+        return logos::read(stream, raw_size) || logos::read(stream, stored_size)
+               || logos::read(stream, compressed) || logos::read(stream, checksum);
+    }
+};
+
+#ifndef _WIN32
+/// Make a rename in directory durable.
+void SyncDirectory(const boost::filesystem::path & directory)
+{
+    auto fd = open(directory.string().c_str(), O_RDONLY);
+    if(fd >= 0)
+    {
+        fsync(fd);
+        close(fd);
+    }
+}
+#endif
+
+}
+
+SegmentLocation::SegmentLocation(bool & error, const logos::mdb_val & mdbval)
+{
+    logos::span_reader stream(reinterpret_cast<const uint8_t *>(mdbval.data()), mdbval.size());
+
+    uint8_t table_l;
+    error = logos::read(stream, table_l) || table_l > uint8_t(SegmentTable::Epoch)
+            || logos::read(stream, segment) || logos::read(stream, frame)
+            || logos::read(stream, offset) || logos::read(stream, size);
+    table = SegmentTable(table_l);
+}
+
+uint32_t SegmentLocation::Serialize(logos::stream & stream) const
+{
+    auto s = logos::write(stream, uint8_t(table));
+    s += logos::write(stream, segment);
+    s += logos::write(stream, frame);
+    s += logos::write(stream, offset);
+    s += logos::write(stream, size);
+
+    assert(s == WireSize);
+    return s;
+}
+
+logos::mdb_val SegmentLocation::to_mdb_val(std::vector<uint8_t> & buf) const
+{
+    auto error = logos::serialize_exact(buf, WireSize, [this](logos::stream & stream){ Serialize(stream); });
+    assert(!error); (void)error;
+    return logos::mdb_val(buf.size(), buf.data());
+}
+
+boost::filesystem::path SegmentFormat::SegmentPath(const boost::filesystem::path & directory, uint32_t segment)
+{
+    return directory / (SEGMENT_PREFIX + std::to_string(segment) + SEGMENT_SUFFIX);
+}
+
+SegmentWriter::SegmentWriter(const Path & directory, uint32_t segment, uint32_t frame_size)
+    : _path(SegmentFormat::SegmentPath(directory, segment))
+    , _partial(_path.string() + ".partial")
+    , _segment(segment)
+    , _frame_size(frame_size)
+{
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(directory, ec);
+
+    // A partial file is left by an interrupted archival, whose index was
+    // never committed.
+    _file = std::fopen(_partial.string().c_str(), "wb");
+    if(!_file)
+    {
+        _error = true;
+        return;
+    }
+
+    SegmentHeader segment_header;
+    segment_header.segment = _segment;
+    std::vector<uint8_t> header;
+    segment_header.Serialize(header);
+
+    _error = std::fwrite(header.data(), 1, header.size(), _file) != header.size();
+    _offset = header.size();
+    _frame.reserve(_frame_size);
+}
+
+SegmentWriter::~SegmentWriter()
+{
+    if(_file)
+    {
+        std::fclose(_file);
+    }
+    if(!_finished)
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove(_partial, ec);
+    }
+}
+
+bool SegmentWriter::Add(SegmentTable table, const logos::mdb_val & value, SegmentLocation & location)
+{
+    if(value.size() > SegmentFormat::MAX_RECORD_SIZE)
+    {
+        _error = true;
+    }
+
+    // Records don't span frames, an oversized one gets a frame of its own.
+    if(!_error && !_frame.empty() && _frame.size() + value.size() > _frame_size)
+    {
+        _error |= Flush();
+    }
+    if(_error)
+    {
+        return true;
+    }
+
+    location.table = table;
+    location.segment = _segment;
+    location.frame = _offset;
+    location.offset = _frame.size();
+    location.size = value.size();
+
+    auto data = reinterpret_cast<const uint8_t *>(value.data());
+    _frame.insert(_frame.end(), data, data + value.size());
+    return false;
+}
+
+bool SegmentWriter::Flush()
+{
+    if(_frame.empty())
+    {
+        return false;
+    }
+
+    FrameHeader header;
+    header.raw_size = _frame.size();
+    header.checksum = XXH64(_frame.data(), _frame.size(), 0);
+
+    _compressed.clear();
+    lz::Compress(_frame.data(), _frame.size(), _compressed);
+
+    // Incompressible frames are stored as they are.
+    header.compressed = _compressed.size() < _frame.size();
+    auto & payload = header.compressed ? _compressed : _frame;
+    header.stored_size = payload.size();
+
+    std::vector<uint8_t> buf;
+    header.Serialize(buf);
+    if(std::fwrite(buf.data(), 1, buf.size(), _file) != buf.size()
+       || std::fwrite(payload.data(), 1, payload.size(), _file) != payload.size())
+    {
+        return true;
+    }
+
+    _offset += buf.size() + payload.size();
+    _raw_size += _frame.size();
+    _stored_size += buf.size() + payload.size();
+    _frame.clear();
+    return false;
+}
+
+bool SegmentWriter::Finish()
+{
+    _error |= Flush();
+    if(_error || std::fflush(_file))
+    {
+        return true;
+    }
+#ifndef _WIN32
+    // The segment must be durable before the index referring to it is.
+    if(fsync(fileno(_file)))
+    {
+        return true;
+    }
+#endif
+    std::fclose(_file);
+    _file = nullptr;
+
+    boost::system::error_code ec;
+    boost::filesystem::rename(_partial, _path, ec);
+    if(ec)
+    {
+        return true;
+    }
+#ifndef _WIN32
+    SyncDirectory(_path.parent_path());
+#endif
+
+    _finished = true;
+    return false;
+}
+
+SegmentStore::SegmentStore(const Path & directory, uint32_t frame_size, size_t cached_frames)
+    : _directory(directory)
+    , _max_frame_size(std::max(frame_size, SegmentFormat::MAX_RECORD_SIZE))
+    , _cached_frames(std::max<size_t>(cached_frames, 1))
+{}
+
+bool SegmentStore::Read(const SegmentLocation & location, std::vector<uint8_t> & value)
+{
+    auto frame = GetFrame(Key(location.segment, location.frame));
+    if(!frame || uint64_t(location.offset) + location.size > frame->size())
+    {
+        LOG_ERROR(_log) << "SegmentStore::Read - failed to read record at " << location.offset
+                        << " of frame " << location.frame << " in segment " << location.segment;
+        return true;
+    }
+
+    auto begin = frame->begin() + location.offset;
+    value.assign(begin, begin + location.size);
+    return false;
+}
+
+SegmentStore::Frame SegmentStore::GetFrame(const Key & key)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto cached = _cache.find(key);
+        if(cached != _cache.end())
+        {
+            _lru.splice(_lru.begin(), _lru, cached->second);
+            return cached->second->second;
+        }
+    }
+
+    // Loaded without holding the lock, concurrent misses on a frame may
+    // both load it.
+    auto frame = LoadFrame(key);
+    if(!frame)
+    {
+        return frame;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(_cache.find(key) == _cache.end())
+    {
+        _lru.emplace_front(key, frame);
+        _cache[key] = _lru.begin();
+        if(_lru.size() > _cached_frames)
+        {
+            _cache.erase(_lru.back().first);
+            _lru.pop_back();
+        }
+    }
+    return frame;
+}
+
+SegmentStore::Frame SegmentStore::LoadFrame(const Key & key)
+{
+    auto path = SegmentFormat::SegmentPath(_directory, key.first);
+    std::unique_ptr<std::FILE, int(*)(std::FILE *)> file(std::fopen(path.string().c_str(), "rb"), &std::fclose);
+    if(!file)
+    {
+        LOG_ERROR(_log) << "SegmentStore::LoadFrame - failed to open " << path.string();
+        return nullptr;
+    }
+
+    uint8_t segment_buf[SegmentFormat::HEADER_SIZE];
+    SegmentHeader segment_header;
+    if(std::fread(segment_buf, 1, sizeof(segment_buf), file.get()) != sizeof(segment_buf)
+       || segment_header.Deserialize(segment_buf)
+       || segment_header.magic != SegmentFormat::MAGIC
+       || segment_header.version != SegmentFormat::VERSION
+       || segment_header.segment != key.first)
+    {
+        LOG_ERROR(_log) << "SegmentStore::LoadFrame - bad segment header in " << path.string();
+        return nullptr;
+    }
+
+    if(fseeko(file.get(), 0, SEEK_END))
+    {
+        LOG_ERROR(_log) << "SegmentStore::LoadFrame - failed to seek in " << path.string();
+        return nullptr;
+    }
+    uint64_t file_size = ftello(file.get());
+
+    uint8_t header_buf[SegmentFormat::FRAME_HEADER_SIZE];
+    FrameHeader header;
+    if(key.second < SegmentFormat::HEADER_SIZE
+       || key.second + SegmentFormat::FRAME_HEADER_SIZE > file_size
+       || fseeko(file.get(), key.second, SEEK_SET)
+       || std::fread(header_buf, 1, sizeof(header_buf), file.get()) != sizeof(header_buf)
+       || header.Deserialize(header_buf))
+    {
+        LOG_ERROR(_log) << "SegmentStore::LoadFrame - failed to read frame header at "
+                        << key.second << " in " << path.string();
+        return nullptr;
+    }
+
+    // Checked before allocating, a corrupt header could ask for 4GB. Frames
+    // are only compressed if that makes them smaller.
+    if(header.raw_size > _max_frame_size
+       || (header.compressed ? header.stored_size >= header.raw_size : header.stored_size != header.raw_size)
+       || key.second + SegmentFormat::FRAME_HEADER_SIZE + header.stored_size > file_size)
+    {
+        LOG_ERROR(_log) << "SegmentStore::LoadFrame - bad frame sizes at " << key.second
+                        << " in " << path.string();
+        return nullptr;
+    }
+
+    std::vector<uint8_t> stored(header.stored_size);
+    if(std::fread(stored.data(), 1, stored.size(), file.get()) != stored.size())
+    {
+        LOG_ERROR(_log) << "SegmentStore::LoadFrame - truncated frame at " << key.second
+                        << " in " << path.string();
+        return nullptr;
+    }
+
+    auto frame = std::make_shared<std::vector<uint8_t>>();
+    if(header.compressed)
+    {
+        frame->resize(header.raw_size);
+        if(lz::Decompress(stored.data(), stored.size(), frame->data(), frame->size()))
+        {
+            LOG_ERROR(_log) << "SegmentStore::LoadFrame - malformed frame at " << key.second
+                            << " in " << path.string();
+            return nullptr;
+        }
+    }
+    else
+    {
+        frame->swap(stored);
+    }
+
+    if(frame->size() != header.raw_size || XXH64(frame->data(), frame->size(), 0) != header.checksum)
+    {
+        LOG_ERROR(_log) << "SegmentStore::LoadFrame - checksum mismatch in frame at " << key.second
+                        << " in " << path.string();
+        return nullptr;
+    }
+
+    return frame;
+}
@@ -0,0 +1,148 @@
+/// @file
+/// This file contains the declaration of SegmentStore and SegmentWriter,
+/// which keep the blocks of finalized epochs in immutable, compressed
+/// segment files.
+#pragma once
+
+#include <logos/node/utility.hpp>
+#include <logos/lib/log.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <cstdio>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+/// The block_store table an archived record was moved from.
+enum class SegmentTable : uint8_t
+{
+    Batch,
+    Request,
+    MicroBlock,
+    Epoch
+};
+
+/// Where a record is archived, the value of block_store::segment_index_db.
+struct SegmentLocation
+{
+    static constexpr uint32_t WireSize = sizeof(uint8_t) + 3 * sizeof(uint32_t) + sizeof(uint64_t);
+
+    SegmentLocation() = default;
+    SegmentLocation(bool & error, const logos::mdb_val & mdbval);
+
+    uint32_t Serialize(logos::stream & stream) const;
+    logos::mdb_val to_mdb_val(std::vector<uint8_t> & buf) const;
+
+    SegmentTable table   = SegmentTable::Batch;
+    uint32_t     segment = 0; ///< epoch number of the segment
+    uint64_t     frame   = 0; ///< file offset of the frame holding the record
+    uint32_t     offset  = 0; ///< offset of the record in the decompressed frame
+    uint32_t     size    = 0; ///< size of the record
+};
+
+/// Segment files start with a header, followed by frames. A frame is a
+/// header and the compressed concatenation of whole records:
+///
+///     segment header: magic (4 bytes), version (1), segment (4)
+///     frame header:   raw size (4), stored size (4), compressed (1),
+///                     xxhash64 of the raw bytes (8)
+///
+/// Frames are compressed independently, so a lookup decompresses a
+/// single frame, and consecutive records of a frame are read at once.
+/// A frame holds up to the configured frame size of records, or a single
+/// record of up to MAX_RECORD_SIZE bytes.
+struct SegmentFormat
+{
+    static constexpr uint32_t MAGIC             = 0x4745534c; // "LSEG"
+    static constexpr uint8_t  VERSION           = 1;
+    static constexpr uint32_t MAX_RECORD_SIZE   = 1024 * 1024;
+    static constexpr size_t   HEADER_SIZE       = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t);
+    static constexpr size_t   FRAME_HEADER_SIZE = 2 * sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint64_t);
+
+    static boost::filesystem::path SegmentPath(const boost::filesystem::path & directory, uint32_t segment);
+};
+
+/// Writes one segment. Records are added in the order they are expected
+/// to be read, and the file becomes visible under its final name only
+/// once Finish succeeds.
+class SegmentWriter
+{
+    using Path = boost::filesystem::path;
+
+public:
+
+    SegmentWriter(const Path & directory, uint32_t segment, uint32_t frame_size);
+    ~SegmentWriter();
+
+    /// Append a record.
+    ///     @param table the table the record is moved from
+    ///     @param value the record, up to MAX_RECORD_SIZE bytes
+    ///     @param location [out] where the record will be found
+    ///     @returns true on error
+    bool Add(SegmentTable table, const logos::mdb_val & value, SegmentLocation & location);
+
+    /// Flush, sync and publish the segment.
+    ///     @returns true on error
+    bool Finish();
+
+    /// Raw and stored bytes of the records written so far.
+    uint64_t RawSize() const { return _raw_size; }
+    uint64_t StoredSize() const { return _stored_size; }
+
+private:
+
+    bool Flush();
+
+    Path                 _path;
+    Path                 _partial;
+    uint32_t             _segment;
+    uint32_t             _frame_size;
+    std::FILE *          _file        = nullptr;
+    uint64_t             _offset      = 0;
+    std::vector<uint8_t> _frame;
+    std::vector<uint8_t> _compressed;
+    uint64_t             _raw_size    = 0;
+    uint64_t             _stored_size = 0;
+    bool                 _finished    = false;
+    bool                 _error       = false;
+};
+
+/// Reads archived records. Decompressed frames are kept in a small LRU
+/// cache, so the records of a frame, which are written in chain order,
+/// cost one read and decompression when they're walked in that order.
+class SegmentStore
+{
+    using Path  = boost::filesystem::path;
+    using Frame = std::shared_ptr<const std::vector<uint8_t>>;
+    using Key   = std::pair<uint32_t, uint64_t>;
+
+public:
+
+    /// @param frame_size the frame size segments are written with
+    SegmentStore(const Path & directory, uint32_t frame_size, size_t cached_frames);
+
+    /// Read an archived record.
+    ///     @param location the record's location
+    ///     @param value [out] the record
+    ///     @returns true if the segment is missing or corrupt
+    bool Read(const SegmentLocation & location, std::vector<uint8_t> & value);
+
+    const Path & Directory() const { return _directory; }
+
+private:
+
+    Frame GetFrame(const Key & key);
+    Frame LoadFrame(const Key & key);
+
+    using Lru = std::list<std::pair<Key, Frame>>;
+
+    Path                        _directory;
+    uint32_t                    _max_frame_size;
+    size_t                      _cached_frames;
+    std::mutex                  _mutex;
+    Lru                         _lru;
+    std::map<Key, Lru::iterator> _cache;
+    Log                         _log;
+};
@@ -0,0 +1,542 @@
+/// @file
+/// This file contains the implementation of BenchDelegate.
+
+#include <logos/benchmark/bench_delegate.hpp>
+
+#include <logos/consensus/persistence/reservations.hpp>
+#include <logos/consensus/messages/util.hpp>
+#include <logos/node/utility.hpp>
+
+#include <algorithm>
+
+BenchDelegate::BenchDelegate(bool & error, uint8_t id, BenchContext & context)
+    : _id(id)
+    , _context(context)
+    , _doorbell(std::make_shared<Doorbell>())
+    , _channels(context.delegates)
+    , _previous(0)
+    // Starting at 1 keeps StoreRequestBlock from linking this chain to a
+    // previous epoch tip, which the synthetic ledger does not have.
+    , _sequence(1)
+{
+    _store = SyntheticLedger::CreateStore(_store_path);
+    if(!_store)
+    {
+        LOG_ERROR(_log) << "BenchDelegate - failed to create store at " << _store_path.string();
+        error = true;
+        return;
+    }
+
+    if(_context.ledger.Seed(*_store))
+    {
+        error = true;
+        return;
+    }
+
+    _persistence.reset(new PersistenceManager<R>(*_store,
+                                                 std::make_shared<ConsensusReservations>(*_store)));
+}
+
+BenchDelegate::~BenchDelegate()
+{
+    Stop();
+}
+
+DelegatePubKey BenchDelegate::GetPublicKey()
+{
+    return _validator.GetPublicKey();
+}
+
+void BenchDelegate::OnPublicKey(uint8_t delegate_id, const DelegatePubKey & key)
+{
+    _validator.keyStore.OnPublicKey(delegate_id, key);
+}
+
+void BenchDelegate::Connect(uint8_t delegate_id, QueuePtr inbound, QueuePtr outbound)
+{
+    _channels[delegate_id] = std::make_shared<LoopbackChannel>(
+            inbound,
+            outbound,
+            [this, delegate_id](const uint8_t * data)
+            {
+                OnPrequel(delegate_id, data);
+            });
+}
+
+void BenchDelegate::Start()
+{
+    _reader = std::thread([this]()
+    {
+        uint64_t seen = 0;
+        while(!_doorbell->Wait(seen))
+        {
+            for(auto & channel : _channels)
+            {
+                while(channel && channel->Readable())
+                {
+                    channel->ReadPrequel();
+                }
+            }
+        }
+    });
+}
+
+void BenchDelegate::Stop()
+{
+    _doorbell->Close();
+    if(_reader.joinable())
+    {
+        _reader.join();
+    }
+}
+
+size_t BenchDelegate::Propose(RequestList requests)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto pre_prepare = std::make_shared<PrePrepare>();
+    pre_prepare->primary_delegate = _id;
+    pre_prepare->epoch_number = _context.ledger.Config().epoch;
+    pre_prepare->delegates_epoch_number = pre_prepare->epoch_number;
+    pre_prepare->sequence = _sequence;
+    pre_prepare->previous = _previous;
+    pre_prepare->timestamp = GetStamp();
+
+    for(auto & request : requests)
+    {
+        pre_prepare->AddRequest(request);
+    }
+
+    // Like the real primary, drop whatever fails validation before
+    // proposing; the generator should never produce such requests.
+    RejectionMap rejection_map(pre_prepare->requests.size(), false);
+    if(ValidateBatch(*pre_prepare, rejection_map))
+    {
+        RequestList accepted;
+        for(size_t i = 0; i < rejection_map.size(); ++i)
+        {
+            if(!rejection_map[i])
+            {
+                accepted.push_back(pre_prepare->requests[i]);
+            }
+        }
+        pre_prepare->requests.swap(accepted);
+    }
+
+    {
+        ScopedStage stage(Stage("hash"));
+        _pre_prepare_hash = pre_prepare->Hash();
+    }
+
+    MessageValidator::DelegateSignature own{_id};
+    {
+        ScopedStage stage(Stage("bls_sign"), 2);
+        _validator.Sign(_pre_prepare_hash, pre_prepare->preprepare_sig);
+        _validator.Sign(_pre_prepare_hash, own.signature);
+    }
+
+    _pre_prepare = pre_prepare;
+    _previous = _pre_prepare_hash;
+    _sequence++;
+
+    _prepares.clear();
+    _commits.clear();
+    _prepares[_id] = own;
+
+    std::vector<uint8_t> buf;
+    Serialize(*pre_prepare, buf);
+    Broadcast(buf);
+
+    if(_prepares.size() == _context.delegates)
+    {
+        OnPreparesComplete();
+    }
+
+    return pre_prepare->requests.size();
+}
+
+void BenchDelegate::OnPrequel(uint8_t delegate_id, const uint8_t * data)
+{
+    // The prequel buffer is reused by the payload read below.
+    bool error = false;
+    logos::bufferstream stream(data, MessagePrequelSize);
+    Prequel prequel(error, stream);
+
+    if(error)
+    {
+        LOG_ERROR(_log) << "BenchDelegate::OnPrequel - failed to deserialize prequel from "
+                        << unsigned(delegate_id);
+        _context.failures++;
+        return;
+    }
+
+    auto type = prequel.type;
+    auto version = prequel.version;
+    size_t size = prequel.payload_size;
+
+    _channels[delegate_id]->AsyncRead(size,
+            [this, delegate_id, type, version, size](const uint8_t * data)
+            {
+                OnMessage(delegate_id, type, version, data, size);
+            });
+}
+
+void BenchDelegate::OnMessage(uint8_t delegate_id,
+                              MessageType type,
+                              uint8_t version,
+                              const uint8_t * data,
+                              size_t size)
+{
+    switch(type)
+    {
+        case MessageType::Pre_Prepare:
+            OnPrePrepare(delegate_id, version, data, size);
+            break;
+        case MessageType::Prepare:
+            OnPrepare(delegate_id, version, data, size);
+            break;
+        case MessageType::Post_Prepare:
+            OnPostPrepare(delegate_id, version, data, size);
+            break;
+        case MessageType::Commit:
+            OnCommit(delegate_id, version, data, size);
+            break;
+        case MessageType::Post_Commit:
+            OnPostCommit(delegate_id, version, data, size);
+            break;
+        default:
+            LOG_ERROR(_log) << "BenchDelegate::OnMessage - unexpected message type "
+                            << MessageToName(type);
+            _context.failures++;
+            break;
+    }
+}
+
+void BenchDelegate::OnPrePrepare(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size)
+{
+    std::shared_ptr<PrePrepare> pre_prepare;
+    {
+        ScopedStage stage(Stage("deserialize"));
+        bool error = false;
+        logos::bufferstream stream(data, size);
+        pre_prepare = std::make_shared<PrePrepare>(error, stream, version);
+
+        if(error)
+        {
+            LOG_ERROR(_log) << "BenchDelegate::OnPrePrepare - failed to deserialize";
+            _context.failures++;
+            return;
+        }
+    }
+
+    BlockHash hash;
+    {
+        ScopedStage stage(Stage("hash"));
+        hash = pre_prepare->Hash();
+    }
+
+    {
+        ScopedStage stage(Stage("bls_verify"));
+        if(!_validator.Validate(hash, pre_prepare->preprepare_sig, pre_prepare->primary_delegate))
+        {
+            LOG_ERROR(_log) << "BenchDelegate::OnPrePrepare - bad primary signature";
+            _context.failures++;
+            return;
+        }
+    }
+
+    RejectionMap rejection_map(pre_prepare->requests.size(), false);
+    ValidateBatch(*pre_prepare, rejection_map);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pre_prepare = pre_prepare;
+    _pre_prepare_hash = hash;
+
+    Prepare prepare(hash);
+    {
+        ScopedStage stage(Stage("bls_sign"));
+        _validator.Sign(hash, prepare.signature);
+    }
+
+    std::vector<uint8_t> buf;
+    Serialize(prepare, buf);
+    _channels[delegate_id]->Send(buf.data(), buf.size());
+}
+
+void BenchDelegate::OnPrepare(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size)
+{
+    bool error = false;
+    std::unique_ptr<Prepare> prepare;
+    {
+        ScopedStage stage(Stage("deserialize"));
+        logos::bufferstream stream(data, size);
+        prepare.reset(new Prepare(error, stream, version));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(error || prepare->preprepare_hash != _pre_prepare_hash)
+    {
+        LOG_ERROR(_log) << "BenchDelegate::OnPrepare - invalid prepare from " << unsigned(delegate_id);
+        _context.failures++;
+        return;
+    }
+
+    {
+        ScopedStage stage(Stage("bls_verify"));
+        if(!_validator.Validate(_pre_prepare_hash, prepare->signature, delegate_id))
+        {
+            LOG_ERROR(_log) << "BenchDelegate::OnPrepare - bad signature from " << unsigned(delegate_id);
+            _context.failures++;
+            return;
+        }
+    }
+
+    _prepares[delegate_id] = {delegate_id, prepare->signature};
+    if(_prepares.size() == _context.delegates)
+    {
+        OnPreparesComplete();
+    }
+}
+
+void BenchDelegate::OnPostPrepare(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size)
+{
+    bool error = false;
+    std::unique_ptr<PostPrepare> post_prepare;
+    {
+        ScopedStage stage(Stage("deserialize"));
+        logos::bufferstream stream(data, size);
+        post_prepare.reset(new PostPrepare(error, stream, version));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(error || post_prepare->preprepare_hash != _pre_prepare_hash)
+    {
+        LOG_ERROR(_log) << "BenchDelegate::OnPostPrepare - invalid post prepare";
+        _context.failures++;
+        return;
+    }
+
+    {
+        ScopedStage stage(Stage("bls_verify"));
+        if(!_validator.Validate(_pre_prepare_hash, post_prepare->signature))
+        {
+            LOG_ERROR(_log) << "BenchDelegate::OnPostPrepare - bad aggregate signature";
+            _context.failures++;
+            return;
+        }
+    }
+
+    {
+        ScopedStage stage(Stage("hash"));
+        _post_prepare_hash = post_prepare->ComputeHash();
+    }
+    _post_prepare_sig = post_prepare->signature;
+
+    Commit commit(_pre_prepare_hash);
+    {
+        ScopedStage stage(Stage("bls_sign"));
+        _validator.Sign(_post_prepare_hash, commit.signature);
+    }
+
+    std::vector<uint8_t> buf;
+    Serialize(commit, buf);
+    _channels[delegate_id]->Send(buf.data(), buf.size());
+}
+
+void BenchDelegate::OnCommit(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size)
+{
+    bool error = false;
+    std::unique_ptr<Commit> commit;
+    {
+        ScopedStage stage(Stage("deserialize"));
+        logos::bufferstream stream(data, size);
+        commit.reset(new Commit(error, stream, version));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(error || commit->preprepare_hash != _pre_prepare_hash)
+    {
+        LOG_ERROR(_log) << "BenchDelegate::OnCommit - invalid commit from " << unsigned(delegate_id);
+        _context.failures++;
+        return;
+    }
+
+    {
+        ScopedStage stage(Stage("bls_verify"));
+        if(!_validator.Validate(_post_prepare_hash, commit->signature, delegate_id))
+        {
+            LOG_ERROR(_log) << "BenchDelegate::OnCommit - bad signature from " << unsigned(delegate_id);
+            _context.failures++;
+            return;
+        }
+    }
+
+    _commits[delegate_id] = {delegate_id, commit->signature};
+    if(_commits.size() == _context.delegates)
+    {
+        OnCommitsComplete();
+    }
+}
+
+void BenchDelegate::OnPostCommit(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size)
+{
+    bool error = false;
+    std::unique_ptr<PostCommit> post_commit;
+    {
+        ScopedStage stage(Stage("deserialize"));
+        logos::bufferstream stream(data, size);
+        post_commit.reset(new PostCommit(error, stream, version));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(error || post_commit->preprepare_hash != _pre_prepare_hash)
+    {
+        LOG_ERROR(_log) << "BenchDelegate::OnPostCommit - invalid post commit";
+        _context.failures++;
+        return;
+    }
+
+    {
+        ScopedStage stage(Stage("bls_verify"));
+        if(!_validator.Validate(_post_prepare_hash, post_commit->signature))
+        {
+            LOG_ERROR(_log) << "BenchDelegate::OnPostCommit - bad aggregate signature";
+            _context.failures++;
+            return;
+        }
+    }
+
+    _post_commit_sig = post_commit->signature;
+    Persist();
+}
+
+size_t BenchDelegate::ValidateBatch(const PrePrepare & message, RejectionMap & rejection_map)
+{
+    // Request signatures are otherwise only checked by PersistenceManager
+    // when the node runs without TxAcceptors.
+    if(_context.verify_request_sigs)
+    {
+        ScopedStage stage(Stage("verify_request_sigs"), message.requests.size());
+        for(auto & request : message.requests)
+        {
+            if(!request->VerifySignature(request->origin))
+            {
+                LOG_ERROR(_log) << "BenchDelegate::ValidateBatch - bad request signature "
+                                << request->GetHash().to_string();
+                _context.failures++;
+            }
+        }
+    }
+
+    {
+        ScopedStage stage(Stage("validate"), message.requests.size());
+        std::lock_guard<std::mutex> lock(_context.ledger_mutex);
+        SyntheticLedger::BindManagers(*_store);
+        _persistence->ValidateBatch(message, rejection_map);
+    }
+
+    auto rejected = std::count(rejection_map.begin(), rejection_map.end(), true);
+    _context.rejected += rejected;
+    return rejected;
+}
+
+void BenchDelegate::OnPreparesComplete()
+{
+    // Every delegate's prepare is awaited rather than a 2/3 quorum, so each
+    // round accounts for the work of all delegates and the shared
+    // reservation cache is released in lock-step.
+    AggSignature aggregate;
+    {
+        ScopedStage stage(Stage("bls_aggregate"));
+        if(!_validator.AggregateSignature(_prepares, aggregate))
+        {
+            LOG_ERROR(_log) << "BenchDelegate::OnPreparesComplete - failed to aggregate";
+            _context.failures++;
+            return;
+        }
+    }
+
+    PostPrepare post_prepare(_pre_prepare_hash, aggregate);
+    {
+        ScopedStage stage(Stage("hash"));
+        _post_prepare_hash = post_prepare.ComputeHash();
+    }
+    _post_prepare_sig = aggregate;
+
+    MessageValidator::DelegateSignature own{_id};
+    {
+        ScopedStage stage(Stage("bls_sign"));
+        _validator.Sign(_post_prepare_hash, own.signature);
+    }
+    _commits[_id] = own;
+
+    std::vector<uint8_t> buf;
+    Serialize(post_prepare, buf);
+    Broadcast(buf);
+
+    if(_commits.size() == _context.delegates)
+    {
+        OnCommitsComplete();
+    }
+}
+
+void BenchDelegate::OnCommitsComplete()
+{
+    AggSignature aggregate;
+    {
+        ScopedStage stage(Stage("bls_aggregate"));
+        if(!_validator.AggregateSignature(_commits, aggregate))
+        {
+            LOG_ERROR(_log) << "BenchDelegate::OnCommitsComplete - failed to aggregate";
+            _context.failures++;
+            return;
+        }
+    }
+    _post_commit_sig = aggregate;
+
+    PostCommit post_commit(_pre_prepare_hash, aggregate);
+    std::vector<uint8_t> buf;
+    Serialize(post_commit, buf);
+    Broadcast(buf);
+
+    Persist();
+}
+
+void BenchDelegate::Persist()
+{
+    ApprovedRB block(*_pre_prepare, _post_prepare_sig, _post_commit_sig);
+    {
+        ScopedStage stage(Stage("persist"), block.requests.size());
+        std::lock_guard<std::mutex> lock(_context.ledger_mutex);
+        SyntheticLedger::BindManagers(*_store);
+        _persistence->ApplyUpdates(block, block.primary_delegate);
+    }
+
+    if(_context.on_persisted)
+    {
+        _context.on_persisted(_id);
+    }
+}
+
+template<typename MSG>
+void BenchDelegate::Serialize(const MSG & message, std::vector<uint8_t> & buf)
+{
+    ScopedStage stage(Stage("serialize"));
+    message.Serialize(buf);
+}
+
+void BenchDelegate::Broadcast(const std::vector<uint8_t> & buf)
+{
+    for(uint8_t i = 0; i < _channels.size(); ++i)
+    {
+        if(i != _id)
+        {
+            _channels[i]->Send(buf.data(), buf.size());
+        }
+    }
+}
+
+StageStats & BenchDelegate::Stage(const char * name)
+{
+    return _context.stages.Get(name);
+}
@@ -0,0 +1,164 @@
+/// @file
+/// This file contains the declaration of BenchDelegate, a request
+/// consensus participant stripped down to the work done per round:
+/// batch validation, BLS signing/aggregation, message (de)serialization
+/// and persistence.
+#pragma once
+
+#include <logos/consensus/persistence/request/request_persistence.hpp>
+#include <logos/consensus/message_validator.hpp>
+#include <logos/benchmark/request_generator.hpp>
+#include <logos/benchmark/loopback_channel.hpp>
+#include <logos/benchmark/bench_stats.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <unordered_map>
+#include <functional>
+#include <thread>
+
+/// MessageValidator signing with a locally generated BLS key pair.
+class BenchValidator : public MessageValidator
+{
+public:
+
+    void Sign(const BlockHash & hash, DelegateSig & sig) override
+    {
+        MessageValidator::Sign(hash, sig, [this](bls::Signature & sig_real, const std::string & hash_str) {
+            _key_pair.prv.sign(sig_real, hash_str);
+        });
+    }
+
+    DelegatePubKey GetPublicKey() override
+    {
+        return BlsPublicKey(_key_pair.pub);
+    }
+
+private:
+
+    bls::KeyPair _key_pair;
+};
+
+/// State shared by all delegates of a benchmark run.
+struct BenchContext
+{
+    using PersistedCallback = std::function<void(uint8_t delegate_id)>;
+
+    BenchContext(const SyntheticLedger & ledger, uint8_t delegates)
+        : ledger(ledger)
+        , delegates(delegates)
+    {}
+
+    const SyntheticLedger & ledger;
+    uint8_t                 delegates;
+    bool                    verify_request_sigs = false;
+    StageSet                stages;
+    PersistedCallback       on_persisted;
+    std::atomic<uint64_t>   rejected{0};
+    std::atomic<uint64_t>   failures{0};
+
+    /// Serializes access to the delegates' stores. Validation and
+    /// persistence already serialize on PersistenceManager<R>'s static
+    /// write mutex, and the staking/voting power/rewards singletons must
+    /// be rebound to the store in use, see SyntheticLedger::BindManagers.
+    std::mutex              ledger_mutex;
+};
+
+class BenchDelegate
+{
+    using PrePrepare  = PrePrepareMessage<ConsensusType::Request>;
+    using Prepare     = PrepareMessage<ConsensusType::Request>;
+    using Commit      = CommitMessage<ConsensusType::Request>;
+    using PostPrepare = PostPrepareMessage<ConsensusType::Request>;
+    using PostCommit  = PostCommitMessage<ConsensusType::Request>;
+    using Signatures  = std::unordered_map<uint8_t, MessageValidator::DelegateSignature>;
+    using ChannelPtr  = std::shared_ptr<LoopbackChannel>;
+    using QueuePtr    = std::shared_ptr<LoopbackQueue>;
+
+public:
+
+    using RequestList = RequestGenerator::RequestList;
+
+    /// Class constructor
+    ///     @param error set to true if the delegate's store could not be created [out]
+    ///     @param id delegate index
+    ///     @param context state shared by all delegates
+    BenchDelegate(bool & error, uint8_t id, BenchContext & context);
+
+    ~BenchDelegate();
+
+    DelegatePubKey GetPublicKey();
+
+    void OnPublicKey(uint8_t delegate_id, const DelegatePubKey & key);
+
+    std::shared_ptr<Doorbell> GetDoorbell() { return _doorbell; }
+
+    /// Attach the connection to a peer.
+    ///     @param delegate_id the peer's index
+    ///     @param inbound queue carrying the peer's messages to this delegate
+    ///     @param outbound queue carrying this delegate's messages to the peer
+    void Connect(uint8_t delegate_id, QueuePtr inbound, QueuePtr outbound);
+
+    void Start();
+    void Stop();
+
+    /// Start a consensus round as primary.
+    ///     @param requests the batch to propose
+    ///     @returns the number of requests proposed after validation
+    size_t Propose(RequestList requests);
+
+private:
+
+    void OnPrequel(uint8_t delegate_id, const uint8_t * data);
+    void OnMessage(uint8_t delegate_id, MessageType type, uint8_t version,
+                   const uint8_t * data, size_t size);
+
+    void OnPrePrepare(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size);
+    void OnPrepare(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size);
+    void OnPostPrepare(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size);
+    void OnCommit(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size);
+    void OnPostCommit(uint8_t delegate_id, uint8_t version, const uint8_t * data, size_t size);
+
+    /// Validate a batch against this delegate's store.
+    ///     @param message the batch
+    ///     @param rejection_map set for each rejected request, sized by the caller [out]
+    ///     @returns the number of rejected requests
+    size_t ValidateBatch(const PrePrepare & message, RejectionMap & rejection_map);
+
+    /// The primary waits for all delegates rather than a 2/3 quorum so
+    /// that every round completes on every store before the next starts.
+    void OnPreparesComplete();
+    void OnCommitsComplete();
+    void Persist();
+
+    template<typename MSG>
+    void Serialize(const MSG & message, std::vector<uint8_t> & buf);
+    void Broadcast(const std::vector<uint8_t> & buf);
+
+    StageStats & Stage(const char * name);
+
+    uint8_t                     _id;
+    BenchContext &              _context;
+    boost::filesystem::path     _store_path;
+    std::unique_ptr<logos::block_store> _store;
+    std::unique_ptr<PersistenceManager<R>> _persistence;
+    BenchValidator              _validator;
+    std::shared_ptr<Doorbell>   _doorbell;
+    std::vector<ChannelPtr>     _channels;
+    std::thread                 _reader;
+    Log                         _log;
+
+    // Round state, guarded by _mutex.
+    std::mutex                  _mutex;
+    std::shared_ptr<PrePrepare> _pre_prepare;
+    BlockHash                   _pre_prepare_hash;
+    BlockHash                   _post_prepare_hash;
+    AggSignature                _post_prepare_sig;
+    AggSignature                _post_commit_sig;
+    Signatures                  _prepares;
+    Signatures                  _commits;
+
+    // Own request block chain.
+    BlockHash                   _previous;
+    uint32_t                    _sequence;
+};
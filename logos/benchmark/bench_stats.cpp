@@ -0,0 +1,121 @@
+/// @file
+/// This file contains the implementation of the logos_bench timing helpers.
+
+#include <logos/benchmark/bench_stats.hpp>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <time.h>
+
+uint64_t ThreadCpuNanos()
+{
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+}
+
+uint64_t WallNanos()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void StageStats::SerializeJson(boost::property_tree::ptree & tree, double elapsed_sec) const
+{
+    uint64_t n = count;
+    tree.put("count", n);
+    tree.put("wall_ms", wall / 1e6);
+    tree.put("cpu_ms", cpu / 1e6);
+    tree.put("cpu_us_per_item", n ? (cpu / 1e3) / n : 0.0);
+    tree.put("cpu_share", elapsed_sec > 0 ? (cpu / 1e9) / elapsed_sec : 0.0);
+}
+
+StageStats & StageSet::Get(const std::string & name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stages[name];
+}
+
+void StageSet::Reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for(auto & entry : _stages)
+    {
+        entry.second.Reset();
+    }
+}
+
+void StageSet::SerializeJson(boost::property_tree::ptree & tree, double elapsed_sec) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for(auto & entry : _stages)
+    {
+        boost::property_tree::ptree stage;
+        entry.second.SerializeJson(stage, elapsed_sec);
+        tree.add_child(entry.first, stage);
+    }
+}
+
+void LatencySamples::Add(uint64_t ns)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _samples.push_back(ns);
+}
+
+uint64_t LatencySamples::Percentile(double p) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(_samples.empty())
+    {
+        return 0;
+    }
+
+    auto sorted = _samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    size_t rank = size_t(p / 100.0 * sorted.size() + 0.5);
+    rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+    return sorted[rank - 1];
+}
+
+size_t LatencySamples::Size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _samples.size();
+}
+
+void LatencySamples::SerializeJson(boost::property_tree::ptree & tree, const std::string & unit) const
+{
+    double scale = unit == "us" ? 1e3 : 1e6;
+
+    tree.put("samples", Size());
+    tree.put("p50_" + unit, Percentile(50) / scale);
+    tree.put("p90_" + unit, Percentile(90) / scale);
+    tree.put("p99_" + unit, Percentile(99) / scale);
+    tree.put("max_" + unit, Percentile(100) / scale);
+}
+
+bool WriteReport(const boost::property_tree::ptree & report, const std::string & path)
+{
+    try
+    {
+        if(path.empty() || path == "-")
+        {
+            boost::property_tree::write_json(std::cout, report);
+        }
+        else
+        {
+            std::ofstream out(path);
+            boost::property_tree::write_json(out, report);
+        }
+    }
+    catch(std::exception const & e)
+    {
+        std::cerr << "failed to write report: " << e.what() << std::endl;
+        return true;
+    }
+    return false;
+}
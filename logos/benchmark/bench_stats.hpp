@@ -0,0 +1,116 @@
+/// @file
+/// This file contains the timing and reporting helpers shared by the
+/// logos_bench benchmark suites.
+#pragma once
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <map>
+
+/// CPU time consumed by the calling thread, in nanoseconds.
+uint64_t ThreadCpuNanos();
+
+/// Wall clock time from a monotonic clock, in nanoseconds.
+uint64_t WallNanos();
+
+/// Accumulated wall/cpu time of one named pipeline stage.
+///
+/// Stages are updated concurrently by delegate threads, hence the atomics.
+struct StageStats
+{
+    void Add(uint64_t wall_ns, uint64_t cpu_ns, uint64_t items = 1)
+    {
+        wall += wall_ns;
+        cpu += cpu_ns;
+        count += items;
+    }
+
+    void Reset()
+    {
+        wall = 0;
+        cpu = 0;
+        count = 0;
+    }
+
+    void SerializeJson(boost::property_tree::ptree & tree, double elapsed_sec) const;
+
+    std::atomic<uint64_t> wall{0};
+    std::atomic<uint64_t> cpu{0};
+    std::atomic<uint64_t> count{0};
+};
+
+/// Collection of named stages. Stage objects are never removed, so
+/// references returned by Get remain valid for the lifetime of the set.
+class StageSet
+{
+public:
+
+    StageStats & Get(const std::string & name);
+
+    /// Zero all stages, e.g. at the end of a warmup phase.
+    void Reset();
+
+    void SerializeJson(boost::property_tree::ptree & tree, double elapsed_sec) const;
+
+private:
+
+    std::map<std::string, StageStats> _stages;
+    mutable std::mutex                _mutex;
+};
+
+/// RAII helper charging the enclosed scope's wall and thread cpu time
+/// to a stage.
+class ScopedStage
+{
+public:
+
+    ScopedStage(StageStats & stage, uint64_t items = 1)
+        : _stage(stage)
+        , _items(items)
+        , _wall(WallNanos())
+        , _cpu(ThreadCpuNanos())
+    {}
+
+    ~ScopedStage()
+    {
+        _stage.Add(WallNanos() - _wall, ThreadCpuNanos() - _cpu, _items);
+    }
+
+private:
+
+    StageStats & _stage;
+    uint64_t     _items;
+    uint64_t     _wall;
+    uint64_t     _cpu;
+};
+
+/// Latency samples with nearest-rank percentiles.
+class LatencySamples
+{
+public:
+
+    void Add(uint64_t ns);
+
+    /// @param p percentile in [0, 100]
+    /// @returns latency in nanoseconds, 0 if there are no samples
+    uint64_t Percentile(double p) const;
+
+    size_t Size() const;
+
+    /// @param unit either "ms" or "us"
+    void SerializeJson(boost::property_tree::ptree & tree, const std::string & unit = "ms") const;
+
+private:
+
+    std::vector<uint64_t> _samples;
+    mutable std::mutex    _mutex;
+};
+
+/// Write a report either to stdout or to the given file.
+/// @returns true on error
+bool WriteReport(const boost::property_tree::ptree & report, const std::string & path);
@@ -0,0 +1,201 @@
+/// @file
+/// This file contains the implementation of the request consensus benchmark.
+
+#include <logos/benchmark/consensus_bench.hpp>
+#include <logos/benchmark/bench_delegate.hpp>
+
+#include <logos/node/utility.hpp>
+#include <logos/lib/log.hpp>
+
+#include <condition_variable>
+
+constexpr std::chrono::seconds ConsensusBench::ROUND_TIMEOUT;
+
+ConsensusBench::ConsensusBench(const ConsensusBenchConfig & config)
+    : _config(config)
+{}
+
+bool ConsensusBench::CheckConfig()
+{
+    Log log;
+
+    if(!_config.delegates || _config.delegates > NUM_DELEGATES)
+    {
+        LOG_ERROR(log) << "ConsensusBench - delegates must be in [1, " << NUM_DELEGATES << "]";
+        return true;
+    }
+
+    if(!_config.batch_size || _config.batch_size > CONSENSUS_BATCH_SIZE)
+    {
+        LOG_ERROR(log) << "ConsensusBench - batch size must be in [1, " << CONSENSUS_BATCH_SIZE << "]";
+        return true;
+    }
+
+    if(!_config.ledger.accounts)
+    {
+        LOG_ERROR(log) << "ConsensusBench - at least one account is required";
+        return true;
+    }
+
+    if(_config.ledger.candidates > _config.ledger.reps)
+    {
+        LOG_ERROR(log) << "ConsensusBench - candidates cannot exceed representatives";
+        return true;
+    }
+
+    return false;
+}
+
+bool ConsensusBench::Run(boost::property_tree::ptree & report)
+{
+    if(CheckConfig())
+    {
+        return true;
+    }
+
+    Log log;
+    SyntheticLedger ledger(_config.ledger);
+    BenchContext context(ledger, _config.delegates);
+    context.verify_request_sigs = _config.verify_request_sigs;
+
+    std::mutex round_mutex;
+    std::condition_variable round_cv;
+    uint8_t persisted = 0;
+
+    context.on_persisted = [&](uint8_t)
+    {
+        {
+            std::lock_guard<std::mutex> lock(round_mutex);
+            persisted++;
+        }
+        round_cv.notify_one();
+    };
+
+    std::vector<std::unique_ptr<BenchDelegate>> delegates;
+    for(uint8_t i = 0; i < _config.delegates; ++i)
+    {
+        bool error = false;
+        delegates.emplace_back(new BenchDelegate(error, i, context));
+        if(error)
+        {
+            LOG_ERROR(log) << "ConsensusBench - failed to create delegate " << unsigned(i);
+            logos::remove_temporary_directories();
+            return true;
+        }
+    }
+
+    for(auto & delegate : delegates)
+    {
+        for(uint8_t i = 0; i < _config.delegates; ++i)
+        {
+            delegate->OnPublicKey(i, delegates[i]->GetPublicKey());
+        }
+    }
+
+    // queues[i][j] carries delegate i's messages to delegate j.
+    std::vector<std::vector<std::shared_ptr<LoopbackQueue>>> queues(_config.delegates);
+    for(uint8_t i = 0; i < _config.delegates; ++i)
+    {
+        for(uint8_t j = 0; j < _config.delegates; ++j)
+        {
+            queues[i].push_back(std::make_shared<LoopbackQueue>(delegates[j]->GetDoorbell()));
+        }
+    }
+
+    for(uint8_t i = 0; i < _config.delegates; ++i)
+    {
+        for(uint8_t j = 0; j < _config.delegates; ++j)
+        {
+            if(i != j)
+            {
+                delegates[i]->Connect(j, queues[j][i], queues[i][j]);
+            }
+        }
+        delegates[i]->Start();
+    }
+
+    RequestGenerator generator(ledger, _config.mix, _config.ledger.seed);
+    LatencySamples latency;
+    uint64_t proposed = 0;
+    uint64_t measured_wall = 0;
+    bool error = false;
+
+    auto measured_start = WallNanos();
+    for(uint32_t round = 0; round < _config.warmup_rounds + _config.rounds; ++round)
+    {
+        auto requests = generator.Next(_config.batch_size);
+
+        if(round == _config.warmup_rounds)
+        {
+            context.stages.Reset();
+            measured_start = WallNanos();
+        }
+
+        auto start = WallNanos();
+        auto count = delegates[round % _config.delegates]->Propose(requests);
+
+        {
+            std::unique_lock<std::mutex> lock(round_mutex);
+            if(!round_cv.wait_for(lock, ROUND_TIMEOUT,
+                                  [&](){ return persisted == _config.delegates; }))
+            {
+                LOG_ERROR(log) << "ConsensusBench - round " << round << " timed out with "
+                               << unsigned(persisted) << " of " << unsigned(_config.delegates)
+                               << " delegates persisted";
+                error = true;
+                break;
+            }
+            persisted = 0;
+        }
+
+        if(round >= _config.warmup_rounds)
+        {
+            latency.Add(WallNanos() - start);
+            proposed += count;
+        }
+    }
+    measured_wall = WallNanos() - measured_start;
+
+    for(auto & delegate : delegates)
+    {
+        delegate->Stop();
+    }
+    delegates.clear();
+    logos::remove_temporary_directories();
+
+    double elapsed = measured_wall / 1e9;
+
+    boost::property_tree::ptree config;
+    config.put("delegates", unsigned(_config.delegates));
+    config.put("rounds", _config.rounds);
+    config.put("warmup_rounds", _config.warmup_rounds);
+    config.put("batch_size", _config.batch_size);
+    config.put("verify_request_sigs", _config.verify_request_sigs);
+    config.put("accounts", _config.ledger.accounts);
+    config.put("reps", _config.ledger.reps);
+    config.put("candidates", _config.ledger.candidates);
+    config.put("mix.send", _config.mix.send);
+    config.put("mix.token_send", _config.mix.token_send);
+    config.put("mix.vote", _config.mix.vote);
+    report.add_child("config", config);
+
+    report.put("suite", "consensus");
+    report.put("elapsed_sec", elapsed);
+    report.put("requests", proposed);
+    report.put("requests_per_sec", elapsed > 0 ? proposed / elapsed : 0);
+    report.put("generated.send", generator.Generated(RequestType::Send));
+    report.put("generated.token_send", generator.Generated(RequestType::TokenSend));
+    report.put("generated.election_vote", generator.Generated(RequestType::ElectionVote));
+    report.put("rejected", context.rejected.load());
+    report.put("failures", context.failures.load());
+
+    boost::property_tree::ptree round_latency;
+    latency.SerializeJson(round_latency);
+    report.add_child("round_latency", round_latency);
+
+    boost::property_tree::ptree stages;
+    context.stages.SerializeJson(stages, elapsed);
+    report.add_child("stages", stages);
+
+    return error || context.failures;
+}
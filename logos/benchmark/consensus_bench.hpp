@@ -0,0 +1,46 @@
+/// @file
+/// This file contains the declaration of the request consensus benchmark,
+/// which runs a configurable number of delegates in one process over
+/// loopback channels and reports end to end throughput, round latency and
+/// a per stage cpu breakdown.
+#pragma once
+
+#include <logos/benchmark/request_generator.hpp>
+#include <logos/benchmark/synthetic_ledger.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <chrono>
+
+struct ConsensusBenchConfig
+{
+    uint8_t      delegates     = 4;      ///< at most NUM_DELEGATES
+    uint32_t     rounds        = 100;
+    uint32_t     warmup_rounds = 5;      ///< rounds excluded from the latency samples
+    uint32_t     batch_size    = 500;    ///< at most CONSENSUS_BATCH_SIZE
+    bool         verify_request_sigs = false;
+    LedgerConfig ledger;
+    RequestMix   mix;
+};
+
+class ConsensusBench
+{
+public:
+
+    /// Maximum time to wait for a round to be persisted by all delegates.
+    static constexpr std::chrono::seconds ROUND_TIMEOUT{60};
+
+    explicit ConsensusBench(const ConsensusBenchConfig & config);
+
+    /// Run the benchmark.
+    ///     @param report receives the results [out]
+    ///     @returns true on error
+    bool Run(boost::property_tree::ptree & report);
+
+private:
+
+    /// @returns true if the configuration is invalid
+    bool CheckConfig();
+
+    ConsensusBenchConfig _config;
+};
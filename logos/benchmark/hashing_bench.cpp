@@ -0,0 +1,181 @@
+/// @file
+/// This file contains the implementation of the hashing microbenchmark.
+
+#include <logos/benchmark/hashing_bench.hpp>
+#include <logos/benchmark/bench_stats.hpp>
+
+#include <logos/consensus/messages/request_block.hpp>
+#include <logos/request/requests.hpp>
+#include <logos/lib/hash.hpp>
+#include <logos/lib/merkle.hpp>
+#include <logos/lib/log.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using RequestList = std::vector<std::shared_ptr<Request>>;
+
+RequestList Requests(uint32_t count, uint64_t seed)
+{
+    std::mt19937_64 engine(seed);
+    auto random = [&engine]()
+    {
+        logos::uint256_union value;
+        for(auto & qword : value.qwords)
+        {
+            qword = engine();
+        }
+        return value;
+    };
+
+    RequestList requests;
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        auto send = std::make_shared<Send>(random(), random(), i, random(), Amount(engine()),
+                                           Amount(engine()), AccountSig());
+        for(auto extra = engine() % Send::MAX_TRANSACTIONS; extra; --extra)
+        {
+            send->AddTransaction(random(), Amount(engine()));
+        }
+        requests.push_back(send);
+    }
+    return requests;
+}
+
+/// @returns nanoseconds per request
+template <typename Op>
+double Time(uint32_t rounds, uint32_t batch, Op op)
+{
+    auto start = WallNanos();
+    for(uint32_t round = 0; round < rounds; ++round)
+    {
+        op();
+    }
+    return rounds && batch ? double(WallNanos() - start) / (uint64_t(rounds) * batch) : 0;
+}
+
+}
+
+HashingBench::HashingBench(const HashingBenchConfig & config)
+    : _config(config)
+{}
+
+bool HashingBench::Run(boost::property_tree::ptree & report)
+{
+    boost::property_tree::ptree config_tree;
+    config_tree.put("batch", _config.batch);
+    config_tree.put("rounds", _config.rounds);
+    config_tree.put("seed", _config.seed);
+    report.add_child("config", config_tree);
+    report.put("suite", "hashing");
+
+    auto requests = Requests(std::min<uint32_t>(_config.batch, CONSENSUS_BATCH_SIZE), _config.seed);
+    auto batch = requests.size();
+    boost::property_tree::ptree cases;
+
+    std::vector<BlockHash> scalar(batch);
+    std::vector<BlockHash> batched;
+
+    auto scalar_ns = Time(_config.rounds, batch, [&]()
+    {
+        for(size_t i = 0; i < batch; ++i)
+        {
+            scalar[i] = Blake2bHash(*requests[i]);
+        }
+    });
+    auto batched_ns = Time(_config.rounds, batch, [&]()
+    {
+        Blake2bHashBatch(requests.begin(), requests.end(), batched);
+    });
+
+    boost::property_tree::ptree digests;
+    digests.put("scalar_ns_per_request", scalar_ns);
+    digests.put("batched_ns_per_request", batched_ns);
+    digests.put("speedup", batched_ns > 0 ? scalar_ns / batched_ns : 0);
+    digests.put("matches", scalar == batched);
+    cases.add_child("request_digests", digests);
+
+    // Deserializing a block, with its requests' digests computed in a batch.
+    RequestBlock block;
+    for(auto & request : requests)
+    {
+        block.AddRequest(request);
+        block.hashes.push_back(request->GetHash());
+    }
+
+    std::vector<uint8_t> buffer;
+    {
+        logos::vectorstream stream(buffer);
+        block.Serialize(stream, true);
+    }
+
+    bool matches = true;
+    auto deserialize_ns = Time(_config.rounds, batch, [&]()
+    {
+        bool error = false;
+        logos::bufferstream stream(buffer.data(), buffer.size());
+        RequestBlock copy(error, stream, true);
+        matches &= !error && copy.requests.size() == batch
+                   && copy.requests.back()->GetHash() == scalar.back();
+    });
+
+    boost::property_tree::ptree deserialize;
+    deserialize.put("ns_per_request", deserialize_ns);
+    deserialize.put("matches", matches);
+    cases.add_child("request_block_deserialize", deserialize);
+
+    // Micro block sized Merkle trees: batch request block hashes per delegate.
+    std::vector<BlockHash> leaves(size_t(_config.batch) * NUM_DELEGATES);
+    std::mt19937_64 engine(_config.seed);
+    for(auto & leaf : leaves)
+    {
+        for(auto & qword : leaf.qwords)
+        {
+            qword = engine();
+        }
+    }
+
+    auto builder = merkle::GetBuilder();
+    auto merkle_time = [&](merkle::Builder b, BlockHash & root)
+    {
+        merkle::SetBuilder(b);
+        return Time(_config.rounds, leaves.size(), [&]()
+        {
+            auto level = leaves;
+            root = merkle::MerkleRoot(level);
+        });
+    };
+
+    BlockHash serial_root;
+    BlockHash batched_root;
+    auto serial_merkle_ns = merkle_time(merkle::Builder::Serial, serial_root);
+    auto batched_merkle_ns = merkle_time(merkle::Builder::Batched, batched_root);
+    merkle::SetBuilder(builder);
+
+    boost::property_tree::ptree merkle_root;
+    merkle_root.put("leaves", leaves.size());
+    merkle_root.put("serial_ns_per_leaf", serial_merkle_ns);
+    merkle_root.put("batched_ns_per_leaf", batched_merkle_ns);
+    merkle_root.put("speedup", batched_merkle_ns > 0 ? serial_merkle_ns / batched_merkle_ns : 0);
+    merkle_root.put("matches", serial_root == batched_root);
+    cases.add_child("merkle_root", merkle_root);
+
+    report.add_child("cases", cases);
+
+    bool error = false;
+    for(auto & entry : cases)
+    {
+        if(!entry.second.get<bool>("matches"))
+        {
+            Log log;
+            LOG_ERROR(log) << "HashingBench::Run - " << entry.first << " results differ from the scalar path";
+            error = true;
+        }
+    }
+
+    return error;
+}
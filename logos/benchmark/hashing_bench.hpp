@@ -0,0 +1,36 @@
+/// @file
+/// This file contains the declaration of the hashing microbenchmark,
+/// which compares computing request digests and Merkle roots one hash at a
+/// time against computing them in batches with the multi-buffer Blake2b.
+#pragma once
+
+#include <boost/property_tree/ptree.hpp>
+
+struct HashingBenchConfig
+{
+    uint32_t batch  = 1500; ///< requests per batch
+    uint32_t rounds = 100;  ///< measured batches per case
+    uint64_t seed   = 1;
+};
+
+class HashingBench
+{
+public:
+
+    explicit HashingBench(const HashingBenchConfig & config);
+
+    /// Run the benchmark.
+    ///
+    /// Batches of Send requests with one to eight transactions are hashed
+    /// with Blake2bHash one request at a time and with
+    /// Request::ComputeDigests, and request blocks are deserialized, which
+    /// now computes the digests of their requests in a batch. Merkle roots
+    /// over batch * NUM_DELEGATES hashes are built with either builder.
+    ///     @param report receives the results [out]
+    ///     @returns true on error
+    bool Run(boost::property_tree::ptree & report);
+
+private:
+
+    HashingBenchConfig _config;
+};
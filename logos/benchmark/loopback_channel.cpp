@@ -0,0 +1,92 @@
+/// @file
+/// This file contains the implementation of the in-memory IOChannel.
+
+#include <logos/benchmark/loopback_channel.hpp>
+
+#include <logos/consensus/messages/common.hpp>
+
+void Doorbell::Ring()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _rings++;
+    }
+    _cv.notify_one();
+}
+
+bool Doorbell::Wait(uint64_t & seen)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this, &seen](){ return _closed || _rings != seen; });
+
+    seen = _rings;
+    return _closed;
+}
+
+void Doorbell::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+    }
+    _cv.notify_all();
+}
+
+void LoopbackQueue::Push(const void * data, size_t size)
+{
+    auto bytes = static_cast<const uint8_t *>(data);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _bytes.insert(_bytes.end(), bytes, bytes + size);
+    }
+    _cv.notify_one();
+
+    if(_doorbell)
+    {
+        _doorbell->Ring();
+    }
+}
+
+void LoopbackQueue::Pop(size_t size, std::vector<uint8_t> & buffer)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this, size](){ return _bytes.size() >= size; });
+
+    buffer.assign(_bytes.begin(), _bytes.begin() + size);
+    _bytes.erase(_bytes.begin(), _bytes.begin() + size);
+}
+
+size_t LoopbackQueue::Size()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _bytes.size();
+}
+
+LoopbackChannel::LoopbackChannel(QueuePtr inbound,
+                                 QueuePtr outbound,
+                                 PrequelCallback on_prequel)
+    : _inbound(inbound)
+    , _outbound(outbound)
+    , _on_prequel(on_prequel)
+{}
+
+void LoopbackChannel::Send(const void * data, size_t size)
+{
+    _outbound->Push(data, size);
+}
+
+void LoopbackChannel::AsyncRead(size_t bytes, ReadCallback callback)
+{
+    _inbound->Pop(bytes, _buffer);
+    callback(_buffer.data());
+}
+
+void LoopbackChannel::ReadPrequel()
+{
+    AsyncRead(MessagePrequelSize, _on_prequel);
+}
+
+bool LoopbackChannel::Readable()
+{
+    return _inbound->Size() >= MessagePrequelSize;
+}
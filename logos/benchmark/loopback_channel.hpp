@@ -0,0 +1,106 @@
+/// @file
+/// This file contains the declaration of the in-memory IOChannel used to
+/// connect benchmark delegates living in the same process.
+#pragma once
+
+#include <logos/network/consensus_netio.hpp>
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+/// Wakes up a delegate's reader thread whenever any of its inbound
+/// queues receives data.
+class Doorbell
+{
+public:
+
+    void Ring();
+
+    /// Block until the bell was rung since the last call or it is closed.
+    ///     @param seen ring count observed by the caller [in/out]
+    ///     @returns true if the doorbell was closed
+    bool Wait(uint64_t & seen);
+
+    void Close();
+
+private:
+
+    uint64_t                _rings = 0;
+    bool                    _closed = false;
+    std::mutex              _mutex;
+    std::condition_variable _cv;
+};
+
+/// One direction of a delegate to delegate connection.
+///
+/// Each Push is appended atomically, so a reader which sees a complete
+/// prequel also sees the rest of the message.
+class LoopbackQueue
+{
+public:
+
+    explicit LoopbackQueue(std::shared_ptr<Doorbell> doorbell)
+        : _doorbell(doorbell)
+    {}
+
+    void Push(const void * data, size_t size);
+
+    /// Block until size bytes are available.
+    ///     @param size number of bytes to read
+    ///     @param buffer receives the bytes [out]
+    void Pop(size_t size, std::vector<uint8_t> & buffer);
+
+    size_t Size();
+
+private:
+
+    std::shared_ptr<Doorbell> _doorbell;
+    std::deque<uint8_t>       _bytes;
+    std::mutex                _mutex;
+    std::condition_variable   _cv;
+};
+
+/// IOChannel implementation over a pair of LoopbackQueues.
+///
+/// Reads complete synchronously on the calling thread, so a delegate's
+/// reader thread drives its own message processing by calling
+/// ReadPrequel while the channel is Readable.
+class LoopbackChannel : public IOChannel
+{
+public:
+
+    using PrequelCallback = std::function<void(const uint8_t * data)>;
+    using QueuePtr        = std::shared_ptr<LoopbackQueue>;
+
+    /// Class constructor
+    ///     @param inbound queue carrying the peer's messages to us
+    ///     @param outbound queue carrying our messages to the peer
+    ///     @param on_prequel handler invoked with each message prequel
+    LoopbackChannel(QueuePtr inbound,
+                    QueuePtr outbound,
+                    PrequelCallback on_prequel);
+
+    ~LoopbackChannel() = default;
+
+    void Send(const void * data, size_t size) override;
+
+    /// Note that the data passed to callback is only valid until the
+    /// next read from this channel.
+    void AsyncRead(size_t bytes, ReadCallback callback) override;
+
+    void ReadPrequel() override;
+
+    /// @returns true if a complete message prequel can be read
+    bool Readable();
+
+private:
+
+    QueuePtr             _inbound;
+    QueuePtr             _outbound;
+    PrequelCallback      _on_prequel;
+    std::vector<uint8_t> _buffer;
+};
@@ -0,0 +1,226 @@
+/// @file
+/// This file contains the logos_bench entry point.
+
+#include <logos/benchmark/persistence_bench.hpp>
+#include <logos/benchmark/numbers_bench.hpp>
+#include <logos/benchmark/hashing_bench.hpp>
+#include <logos/benchmark/serialization_bench.hpp>
+#include <logos/benchmark/consensus_bench.hpp>
+#include <logos/benchmark/bench_stats.hpp>
+
+#include <logos/request/utility.hpp>
+
+#include <bls/bls.hpp>
+
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+
+void ReadLedgerConfig(const boost::program_options::variables_map & vm, LedgerConfig & config)
+{
+    config.accounts = vm["accounts"].as<uint32_t>();
+    config.reps = vm["reps"].as<uint32_t>();
+    config.candidates = vm["candidates"].as<uint32_t>();
+    config.tokens = vm["tokens"].as<uint32_t>();
+    config.stakers = vm["stakers"].as<uint32_t>();
+    config.thawing = vm["thawing"].as<uint32_t>();
+    config.epoch = vm["epoch"].as<uint32_t>();
+    config.seed = vm["seed"].as<uint64_t>();
+}
+
+int Report(bool error, const boost::property_tree::ptree & report,
+           const boost::program_options::variables_map & vm)
+{
+    if(WriteReport(report, vm["output"].as<std::string>()))
+    {
+        return 1;
+    }
+    return error ? 1 : 0;
+}
+
+int RunConsensus(const boost::program_options::variables_map & vm)
+{
+    ConsensusBenchConfig config;
+    config.delegates = vm["delegates"].as<unsigned>();
+    config.rounds = vm["rounds"].as<uint32_t>();
+    config.warmup_rounds = vm["warmup"].as<uint32_t>();
+    config.batch_size = vm["batch"].as<uint32_t>();
+    config.verify_request_sigs = vm.count("verify-sigs");
+    ReadLedgerConfig(vm, config.ledger);
+    config.mix.send = vm["mix-send"].as<uint32_t>();
+    config.mix.token_send = vm["mix-token"].as<uint32_t>();
+    config.mix.vote = vm["mix-vote"].as<uint32_t>();
+
+    boost::property_tree::ptree report;
+    bool error = ConsensusBench(config).Run(report);
+
+    return Report(error, report, vm);
+}
+
+int RunPersistence(const boost::program_options::variables_map & vm)
+{
+    PersistenceBenchConfig config;
+    config.rounds = vm["rounds"].as<uint32_t>();
+    config.batch_size = vm["batch"].as<uint32_t>();
+    ReadLedgerConfig(vm, config.ledger);
+
+    if(vm.count("types"))
+    {
+        std::vector<std::string> names;
+        boost::split(names, vm["types"].as<std::string>(), boost::is_any_of(","));
+
+        for(auto & name : names)
+        {
+            bool error = false;
+            auto type = GetRequestType(error, name);
+            if(error || type == RequestType::Unknown)
+            {
+                std::cerr << "unknown request type " << name << std::endl;
+                return 1;
+            }
+            config.types.push_back(type);
+        }
+    }
+
+    boost::property_tree::ptree report;
+    bool error = PersistenceBench(config).Run(report);
+
+    return Report(error, report, vm);
+}
+
+int RunNumbers(const boost::program_options::variables_map & vm)
+{
+    NumbersBenchConfig config;
+    config.operations = vm["operations"].as<uint64_t>();
+    config.seed = vm["seed"].as<uint64_t>();
+
+    boost::property_tree::ptree report;
+    bool error = NumbersBench(config).Run(report);
+
+    return Report(error, report, vm);
+}
+
+int RunHashing(const boost::program_options::variables_map & vm)
+{
+    HashingBenchConfig config;
+    config.batch = vm["batch"].as<uint32_t>();
+    config.rounds = vm["rounds"].as<uint32_t>();
+    config.seed = vm["seed"].as<uint64_t>();
+
+    boost::property_tree::ptree report;
+    bool error = HashingBench(config).Run(report);
+
+    return Report(error, report, vm);
+}
+
+int RunSerialization(const boost::program_options::variables_map & vm)
+{
+    SerializationBenchConfig config;
+    config.batch = vm["batch"].as<uint32_t>();
+    config.rounds = vm["rounds"].as<uint32_t>();
+    config.seed = vm["seed"].as<uint64_t>();
+
+    boost::property_tree::ptree report;
+    bool error = SerializationBench(config).Run(report);
+
+    return Report(error, report, vm);
+}
+
+}
+
+int main(int argc, char * const * argv)
+{
+    namespace po = boost::program_options;
+
+    po::options_description description("logos_bench options");
+    description.add_options()
+        ("help", "Print out options")
+        ("suite", po::value<std::string>()->default_value("consensus"), "Benchmark suite to run: consensus, persistence, numbers, hashing, serialization")
+        ("output", po::value<std::string>()->default_value("-"), "JSON report path, - for stdout")
+        ("log_level", po::value<std::string>()->default_value("warning"), "Minimum severity logged")
+        ("delegates", po::value<unsigned>()->default_value(4), "Number of in-process delegates")
+        ("rounds", po::value<uint32_t>()->default_value(100), "Measured consensus rounds, or batches per request type")
+        ("warmup", po::value<uint32_t>()->default_value(5), "Unmeasured warmup rounds")
+        ("batch", po::value<uint32_t>()->default_value(500), "Requests per batch")
+        ("accounts", po::value<uint32_t>()->default_value(1000), "Synthetic user accounts")
+        ("reps", po::value<uint32_t>()->default_value(64), "Synthetic representatives")
+        ("candidates", po::value<uint32_t>()->default_value(8), "Representatives announcing candidacy")
+        ("tokens", po::value<uint32_t>()->default_value(1), "Token accounts, each user holds an entry for every one")
+        ("stakers", po::value<uint32_t>()->default_value(0), "Users locking proxy to a representative")
+        ("thawing", po::value<uint32_t>()->default_value(0), "Thawing funds and liabilities per staker")
+        ("epoch", po::value<uint32_t>()->default_value(10), "Epoch of the benchmarked requests")
+        ("seed", po::value<uint64_t>()->default_value(1), "Seed for keys and request generation")
+        ("types", po::value<std::string>(), "Comma separated request types for the persistence suite, default all supported")
+        ("operations", po::value<uint64_t>()->default_value(10000000), "Operations per case for the numbers suite")
+        ("mix-send", po::value<uint32_t>()->default_value(80), "Relative weight of Send requests")
+        ("mix-token", po::value<uint32_t>()->default_value(15), "Relative weight of TokenSend requests")
+        ("mix-vote", po::value<uint32_t>()->default_value(5), "Relative weight of ElectionVote requests")
+        ("verify-sigs", "Verify request signatures on every delegate");
+
+    po::positional_options_description positional;
+    positional.add("suite", 1);
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::command_line_parser(argc, argv).options(description).positional(positional).run(), vm);
+        po::notify(vm);
+    }
+    catch(po::error const & e)
+    {
+        std::cerr << e.what() << std::endl << description << std::endl;
+        return 1;
+    }
+
+    if(vm.count("help"))
+    {
+        std::cout << description << std::endl;
+        return 0;
+    }
+
+    // Request validation logs every request at info level, which would
+    // otherwise dominate the measurements.
+    boost::log::trivial::severity_level level;
+    std::istringstream level_stream(vm["log_level"].as<std::string>());
+    if(!(level_stream >> level))
+    {
+        std::cerr << "invalid log_level" << std::endl;
+        return 1;
+    }
+    boost::log::core::get()->set_filter(boost::log::trivial::severity >= level);
+
+    bls::init();
+
+    auto suite = vm["suite"].as<std::string>();
+    if(suite == "consensus")
+    {
+        return RunConsensus(vm);
+    }
+    else if(suite == "persistence")
+    {
+        return RunPersistence(vm);
+    }
+    else if(suite == "numbers")
+    {
+        return RunNumbers(vm);
+    }
+    else if(suite == "hashing")
+    {
+        return RunHashing(vm);
+    }
+    else if(suite == "serialization")
+    {
+        return RunSerialization(vm);
+    }
+
+    std::cerr << "unknown suite " << suite << std::endl << description << std::endl;
+    return 1;
+}
@@ -0,0 +1,184 @@
+/// @file
+/// This file contains the implementation of the numbers microbenchmark.
+
+#include <logos/benchmark/numbers_bench.hpp>
+#include <logos/benchmark/bench_stats.hpp>
+
+#include <logos/lib/numbers.hpp>
+#include <logos/lib/log.hpp>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+/// Operand pairs are cycled through, small enough to stay in cache.
+const size_t OPERANDS = 1024;
+
+template <typename Number, typename Union>
+Number BoostNumber(const Union & value)
+{
+    Number result = 0;
+    for(auto byte : value.bytes)
+    {
+        result <<= 8;
+        result |= byte;
+    }
+    return result;
+}
+
+template <typename Union, typename Number>
+Union BoostUnion(Number number)
+{
+    Union result;
+    for(auto i = result.bytes.rbegin(); i != result.bytes.rend(); ++i)
+    {
+        *i = static_cast<uint8_t>(number & 0xff);
+        number >>= 8;
+    }
+    return result;
+}
+
+template <typename Union>
+std::vector<std::pair<Union, Union>> Operands(uint64_t seed)
+{
+    std::mt19937_64 engine(seed);
+    std::vector<std::pair<Union, Union>> operands(OPERANDS);
+
+    for(auto & pair : operands)
+    {
+        for(auto & qword : pair.first.qwords)
+        {
+            qword = engine();
+        }
+        for(auto & qword : pair.second.qwords)
+        {
+            qword = engine();
+        }
+    }
+
+    return operands;
+}
+
+/// Time op over the operands and fold its results into a checksum, so
+/// the work can't be optimized away.
+///     @returns nanoseconds per operation
+template <typename Union, typename Op>
+double Time(const std::vector<std::pair<Union, Union>> & operands,
+            uint64_t operations,
+            uint64_t & checksum,
+            Op op)
+{
+    auto start = WallNanos();
+    for(uint64_t i = 0; i < operations; ++i)
+    {
+        auto & pair = operands[i % OPERANDS];
+        checksum += op(pair.first, pair.second);
+    }
+    return operations ? double(WallNanos() - start) / operations : 0;
+}
+
+template <typename Union, typename NativeOp, typename BoostOp>
+void AddCase(boost::property_tree::ptree & report,
+             const std::string & name,
+             const std::vector<std::pair<Union, Union>> & operands,
+             uint64_t operations,
+             NativeOp native_op,
+             BoostOp boost_op)
+{
+    uint64_t native_checksum = 0;
+    uint64_t boost_checksum = 0;
+    auto native_ns = Time(operands, operations, native_checksum, native_op);
+    auto boost_ns = Time(operands, operations, boost_checksum, boost_op);
+
+    boost::property_tree::ptree tree;
+    tree.put("native_ns_per_op", native_ns);
+    tree.put("boost_ns_per_op", boost_ns);
+    tree.put("speedup", native_ns > 0 ? boost_ns / native_ns : 0);
+    tree.put("matches", native_checksum == boost_checksum);
+    report.add_child(name, tree);
+}
+
+}
+
+NumbersBench::NumbersBench(const NumbersBenchConfig & config)
+    : _config(config)
+{}
+
+bool NumbersBench::Run(boost::property_tree::ptree & report)
+{
+    using logos::uint128_union;
+    using logos::uint256_union;
+    using logos::uint128_t;
+    using logos::uint256_t;
+
+    boost::property_tree::ptree config_tree;
+    config_tree.put("operations", _config.operations);
+    config_tree.put("seed", _config.seed);
+    report.add_child("config", config_tree);
+    report.put("suite", "numbers");
+
+    auto amounts = Operands<uint128_union>(_config.seed);
+    auto hashes = Operands<uint256_union>(_config.seed + 1);
+    auto n = _config.operations;
+    boost::property_tree::ptree cases;
+
+    AddCase(cases, "uint128_add", amounts, n,
+            [](const uint128_union & a, const uint128_union & b)
+            { return (a + b).qwords[1]; },
+            [](const uint128_union & a, const uint128_union & b)
+            {
+                return BoostUnion<uint128_union>(uint128_t(BoostNumber<uint128_t>(a) +
+                                                           BoostNumber<uint128_t>(b))).qwords[1];
+            });
+    AddCase(cases, "uint128_subtract", amounts, n,
+            [](const uint128_union & a, const uint128_union & b)
+            { return (a - b).qwords[1]; },
+            [](const uint128_union & a, const uint128_union & b)
+            {
+                return BoostUnion<uint128_union>(uint128_t(BoostNumber<uint128_t>(a) -
+                                                           BoostNumber<uint128_t>(b))).qwords[1];
+            });
+    AddCase(cases, "uint128_multiply", amounts, n,
+            [](const uint128_union & a, const uint128_union & b)
+            { return (a * b).qwords[1]; },
+            [](const uint128_union & a, const uint128_union & b)
+            {
+                return BoostUnion<uint128_union>(uint128_t(BoostNumber<uint128_t>(a) *
+                                                           BoostNumber<uint128_t>(b))).qwords[1];
+            });
+    AddCase(cases, "uint128_compare", amounts, n,
+            [](const uint128_union & a, const uint128_union & b)
+            { return uint64_t(a < b); },
+            [](const uint128_union & a, const uint128_union & b)
+            { return uint64_t(BoostNumber<uint128_t>(a) < BoostNumber<uint128_t>(b)); });
+    AddCase(cases, "uint256_add", hashes, n,
+            [](const uint256_union & a, const uint256_union & b)
+            { return (a + b).qwords[3]; },
+            [](const uint256_union & a, const uint256_union & b)
+            {
+                return BoostUnion<uint256_union>(uint256_t(BoostNumber<uint256_t>(a) +
+                                                           BoostNumber<uint256_t>(b))).qwords[3];
+            });
+    AddCase(cases, "uint256_compare", hashes, n,
+            [](const uint256_union & a, const uint256_union & b)
+            { return uint64_t(a < b); },
+            [](const uint256_union & a, const uint256_union & b)
+            { return uint64_t(BoostNumber<uint256_t>(a) < BoostNumber<uint256_t>(b)); });
+
+    report.add_child("cases", cases);
+
+    bool error = false;
+    for(auto & entry : cases)
+    {
+        if(!entry.second.get<bool>("matches"))
+        {
+            Log log;
+            LOG_ERROR(log) << "NumbersBench::Run - " << entry.first << " results differ from boost";
+            error = true;
+        }
+    }
+
+    return error;
+}
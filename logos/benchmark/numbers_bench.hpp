@@ -0,0 +1,33 @@
+/// @file
+/// This file contains the declaration of the numbers microbenchmark,
+/// which compares uint128_union/uint256_union arithmetic and comparison
+/// against the equivalent boost::multiprecision operations.
+#pragma once
+
+#include <boost/property_tree/ptree.hpp>
+
+struct NumbersBenchConfig
+{
+    uint64_t operations = 10000000; ///< operations per case
+    uint64_t seed       = 1;
+};
+
+class NumbersBench
+{
+public:
+
+    explicit NumbersBench(const NumbersBenchConfig & config);
+
+    /// Run the benchmark.
+    ///
+    /// Every case is timed twice: once through the union operators and
+    /// once by converting the operands to boost numbers byte by byte,
+    /// operating on those and converting back, as the unions used to.
+    ///     @param report receives the results [out]
+    ///     @returns true on error
+    bool Run(boost::property_tree::ptree & report);
+
+private:
+
+    NumbersBenchConfig _config;
+};
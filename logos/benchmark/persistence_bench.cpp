@@ -0,0 +1,229 @@
+/// @file
+/// This file contains the implementation of the persistence microbenchmark.
+
+#include <logos/benchmark/persistence_bench.hpp>
+#include <logos/benchmark/request_generator.hpp>
+#include <logos/benchmark/bench_stats.hpp>
+
+#include <logos/consensus/persistence/request/request_persistence.hpp>
+#include <logos/consensus/persistence/reservations.hpp>
+#include <logos/request/utility.hpp>
+#include <logos/node/utility.hpp>
+#include <logos/lib/log.hpp>
+
+#include <map>
+
+namespace
+{
+
+const std::vector<RequestType> DEFAULT_TYPES =
+{
+    RequestType::Send,
+    RequestType::TokenSend,
+    RequestType::Distribute,
+    RequestType::ElectionVote,
+    RequestType::Proxy,
+    RequestType::Stake,
+    RequestType::Claim,
+};
+
+}
+
+PersistenceBench::PersistenceBench(const PersistenceBenchConfig & config)
+    : _config(config)
+{
+    if(_config.types.empty())
+    {
+        _config.types = DEFAULT_TYPES;
+    }
+}
+
+bool PersistenceBench::CheckConfig()
+{
+    Log log;
+
+    for(auto type : _config.types)
+    {
+        if(!RequestGenerator::Supports(type))
+        {
+            LOG_ERROR(log) << "PersistenceBench - unsupported request type "
+                           << GetRequestTypeField(type);
+            return true;
+        }
+    }
+
+    if(!_config.ledger.accounts || !_config.batch_size)
+    {
+        LOG_ERROR(log) << "PersistenceBench - accounts and batch size must be positive";
+        return true;
+    }
+
+    if(_config.ledger.tokens > logos::account_info::MAX_TOKEN_ENTRIES)
+    {
+        LOG_ERROR(log) << "PersistenceBench - at most " << logos::account_info::MAX_TOKEN_ENTRIES
+                       << " tokens are supported";
+        return true;
+    }
+
+    return false;
+}
+
+bool PersistenceBench::Run(boost::property_tree::ptree & report)
+{
+    if(CheckConfig())
+    {
+        return true;
+    }
+
+    SyntheticLedger ledger(_config.ledger);
+    auto & config = ledger.Config();
+
+    boost::property_tree::ptree config_tree;
+    config_tree.put("rounds", _config.rounds);
+    config_tree.put("batch_size", _config.batch_size);
+    config_tree.put("accounts", config.accounts);
+    config_tree.put("reps", config.reps);
+    config_tree.put("candidates", config.candidates);
+    config_tree.put("tokens", config.tokens);
+    config_tree.put("stakers", config.stakers);
+    config_tree.put("thawing", config.thawing);
+    config_tree.put("epoch", config.epoch);
+    report.add_child("config", config_tree);
+    report.put("suite", "persistence");
+
+    bool error = false;
+    boost::property_tree::ptree types;
+
+    for(auto type : _config.types)
+    {
+        boost::property_tree::ptree type_report;
+        error |= RunType(type, ledger, type_report);
+        types.add_child(GetRequestTypeField(type), type_report);
+    }
+
+    report.add_child("types", types);
+    logos::remove_temporary_directories();
+
+    return error;
+}
+
+bool PersistenceBench::RunType(RequestType type,
+                               const SyntheticLedger & ledger,
+                               boost::property_tree::ptree & report)
+{
+    Log log;
+
+    boost::filesystem::path path;
+    auto store = SyntheticLedger::CreateStore(path);
+    if(!store || ledger.Seed(*store))
+    {
+        LOG_ERROR(log) << "PersistenceBench::RunType - failed to seed store";
+        return true;
+    }
+
+    PersistenceManager<R> persistence(*store, std::make_shared<ConsensusReservations>(*store));
+    RequestGenerator generator(ledger, RequestMix(), ledger.Config().seed);
+    auto epoch = ledger.Config().epoch;
+
+    StageStats validate;
+    StageStats apply;
+    StageStats commit;
+    LatencySamples validate_latency;
+    LatencySamples apply_latency;
+    std::map<std::string, uint64_t> rejections;
+    uint64_t requests = 0;
+    uint32_t rounds = 0;
+
+    for(; rounds < _config.rounds; ++rounds)
+    {
+        auto batch = generator.Next(type, _config.batch_size);
+        if(batch.empty())
+        {
+            break;
+        }
+        requests += batch.size();
+
+        // Mirror PersistenceManager<R>::ValidateBatch, which validates
+        // the whole batch against one read snapshot.
+        std::vector<bool> valid(batch.size());
+        {
+            logos::read_snapshot snapshot(store->environment);
+            for(size_t i = 0; i < batch.size(); ++i)
+            {
+                logos::process_return result;
+
+                auto wall = WallNanos();
+                auto cpu = ThreadCpuNanos();
+                valid[i] = persistence.ValidateRequest(batch[i], epoch, result);
+                wall = WallNanos() - wall;
+
+                validate.Add(wall, ThreadCpuNanos() - cpu);
+                validate_latency.Add(wall);
+
+                if(!valid[i])
+                {
+                    rejections[logos::ProcessResultToString(result.code)]++;
+                }
+            }
+        }
+
+        std::unique_ptr<logos::transaction> txn(new logos::transaction(store->environment, nullptr, true));
+        auto timestamp = GetStamp();
+
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+            if(!valid[i])
+            {
+                continue;
+            }
+
+            auto wall = WallNanos();
+            auto cpu = ThreadCpuNanos();
+            persistence.ApplyRequest(batch[i], timestamp, epoch, *txn);
+            wall = WallNanos() - wall;
+
+            apply.Add(wall, ThreadCpuNanos() - cpu);
+            apply_latency.Add(wall);
+        }
+
+        ScopedStage stage(commit);
+        txn.reset();
+    }
+
+    uint64_t rejected = 0;
+    boost::property_tree::ptree rejection_tree;
+    for(auto & entry : rejections)
+    {
+        rejection_tree.put(entry.first, entry.second);
+        rejected += entry.second;
+    }
+
+    double elapsed = (validate.wall + apply.wall + commit.wall) / 1e9;
+
+    report.put("rounds", rounds);
+    report.put("requests", requests);
+    report.put("rejected", rejected);
+    report.add_child("rejections", rejection_tree);
+    report.put("requests_per_sec", elapsed > 0 ? requests / elapsed : 0);
+
+    auto add_stage = [&report, elapsed](const std::string & name,
+                                        const StageStats & stats,
+                                        const LatencySamples * latency)
+    {
+        boost::property_tree::ptree tree;
+        stats.SerializeJson(tree, elapsed);
+        if(latency)
+        {
+            boost::property_tree::ptree latency_tree;
+            latency->SerializeJson(latency_tree, "us");
+            tree.add_child("latency", latency_tree);
+        }
+        report.add_child(name, tree);
+    };
+
+    add_stage("validate", validate, &validate_latency);
+    add_stage("apply", apply, &apply_latency);
+    add_stage("commit", commit, nullptr);
+
+    return false;
+}
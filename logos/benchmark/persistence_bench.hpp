@@ -0,0 +1,50 @@
+/// @file
+/// This file contains the declaration of the persistence microbenchmark,
+/// which times PersistenceManager<R> validation and application of
+/// single-type request batches against a synthetic ledger.
+#pragma once
+
+#include <logos/benchmark/synthetic_ledger.hpp>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <vector>
+
+struct PersistenceBenchConfig
+{
+    std::vector<RequestType> types;             ///< empty for every supported type
+    uint32_t                 rounds     = 10;   ///< batches per type
+    uint32_t                 batch_size = 1000; ///< requests per batch
+    LedgerConfig             ledger;
+};
+
+class PersistenceBench
+{
+public:
+
+    explicit PersistenceBench(const PersistenceBenchConfig & config);
+
+    /// Run the benchmark.
+    ///
+    /// Each type is measured against its own freshly seeded store, so
+    /// results don't depend on the order in which types are run.
+    ///     @param report receives the results [out]
+    ///     @returns true on error
+    bool Run(boost::property_tree::ptree & report);
+
+private:
+
+    /// @returns true if the configuration is invalid
+    bool CheckConfig();
+
+    /// Benchmark a single request type.
+    ///     @param type request type
+    ///     @param ledger the ledger to seed
+    ///     @param report receives the results for this type [out]
+    ///     @returns true on error
+    bool RunType(RequestType type,
+                 const SyntheticLedger & ledger,
+                 boost::property_tree::ptree & report);
+
+    PersistenceBenchConfig _config;
+};
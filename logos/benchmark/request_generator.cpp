@@ -0,0 +1,321 @@
+/// @file
+/// This file contains the implementation of RequestGenerator.
+
+#include <logos/benchmark/request_generator.hpp>
+
+#include <logos/consensus/persistence/request/request_persistence.hpp>
+#include <logos/governance/requests.hpp>
+#include <logos/token/requests.hpp>
+#include <logos/rewards/claim.hpp>
+
+#include <algorithm>
+
+namespace
+{
+
+const Amount SEND_AMOUNT       = 1000;
+const Amount TOKEN_SEND_AMOUNT = 100;
+const Amount PROXY_STEP        = 1000;
+
+}
+
+RequestGenerator::RequestGenerator(const SyntheticLedger & ledger,
+                                   const RequestMix & mix,
+                                   uint64_t seed)
+    : _ledger(ledger)
+    , _mix(mix)
+    , _rng(seed)
+    , _tokens(ledger.TokenIds().size())
+{
+    for(size_t i = 0; i < ledger.Users().size(); ++i)
+    {
+        _users.push_back(ledger.UserChain(i));
+    }
+
+    for(size_t i = 0; i < ledger.Reps().size(); ++i)
+    {
+        _reps.push_back(ledger.RepChain(i));
+    }
+
+    // Without candidates there is nothing to vote for.
+    if(!ledger.Config().candidates)
+    {
+        _mix.send += _mix.vote;
+        _mix.vote = 0;
+    }
+}
+
+RequestGenerator::RequestList RequestGenerator::Next(size_t count)
+{
+    RequestList requests;
+    requests.reserve(count);
+
+    auto total = _mix.send + _mix.token_send + _mix.vote;
+    size_t used_users = 0;
+
+    while(requests.size() < count)
+    {
+        auto pick = total ? _rng() % total : 0;
+
+        if(pick < _mix.vote && _next_rep < _reps.size())
+        {
+            requests.push_back(MakeVote(_next_rep++));
+            continue;
+        }
+
+        if(used_users == _users.size())
+        {
+            break;
+        }
+
+        auto user = _next_user;
+        _next_user = (_next_user + 1) % _users.size();
+        ++used_users;
+
+        if(pick >= _mix.vote && pick < _mix.vote + _mix.token_send)
+        {
+            requests.push_back(MakeTokenSend(user));
+        }
+        else
+        {
+            requests.push_back(MakeSend(user));
+        }
+    }
+
+    return requests;
+}
+
+RequestGenerator::RequestList RequestGenerator::Next(RequestType type, size_t count)
+{
+    RequestList requests;
+
+    // One-shot types consume their origins.
+    if(type == RequestType::ElectionVote)
+    {
+        while(requests.size() < count && _next_rep < _reps.size())
+        {
+            requests.push_back(MakeVote(_next_rep++));
+        }
+        return requests;
+    }
+
+    if(type == RequestType::Claim)
+    {
+        while(requests.size() < count && _next_claim < _users.size())
+        {
+            requests.push_back(MakeClaim(_next_claim++));
+        }
+        return requests;
+    }
+
+    size_t pool = 0;
+    switch(type)
+    {
+        case RequestType::Send:
+        case RequestType::TokenSend:
+            pool = _users.size();
+            break;
+        case RequestType::Proxy:
+            pool = _reps.empty() ? 0 :
+                   _ledger.Config().stakers ? _ledger.Config().stakers : _users.size();
+            break;
+        case RequestType::Stake:
+            pool = _reps.size();
+            break;
+        case RequestType::Distribute:
+            pool = _users.empty() ? 0 : _tokens.size();
+            break;
+        default:
+            return requests;
+    }
+
+    auto & cursor = _cursors[type];
+    count = std::min(count, pool);
+    requests.reserve(count);
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        auto origin = cursor;
+        cursor = (cursor + 1) % pool;
+
+        switch(type)
+        {
+            case RequestType::Send:
+                requests.push_back(MakeSend(origin));
+                break;
+            case RequestType::TokenSend:
+                requests.push_back(MakeTokenSend(origin));
+                break;
+            case RequestType::Proxy:
+                requests.push_back(MakeProxy(origin));
+                break;
+            case RequestType::Stake:
+                requests.push_back(MakeStake(origin));
+                break;
+            case RequestType::Distribute:
+                requests.push_back(MakeDistribute(origin));
+                break;
+            default:
+                break;
+        }
+    }
+
+    return requests;
+}
+
+bool RequestGenerator::Supports(RequestType type)
+{
+    switch(type)
+    {
+        case RequestType::Send:
+        case RequestType::TokenSend:
+        case RequestType::Distribute:
+        case RequestType::ElectionVote:
+        case RequestType::Proxy:
+        case RequestType::Stake:
+        case RequestType::Claim:
+            return true;
+        default:
+            return false;
+    }
+}
+
+uint64_t RequestGenerator::Generated(RequestType type) const
+{
+    auto entry = _generated.find(type);
+    return entry == _generated.end() ? 0 : entry->second;
+}
+
+RequestGenerator::RequestPtr RequestGenerator::MakeSend(size_t user)
+{
+    auto send = std::make_shared<Send>();
+    send->AddTransaction(_ledger.Users()[RandomDestination(user)].pub, SEND_AMOUNT);
+
+    return Finish(send, _ledger.Users()[user], _users[user]);
+}
+
+RequestGenerator::RequestPtr RequestGenerator::MakeTokenSend(size_t user)
+{
+    auto & token_ids = _ledger.TokenIds();
+
+    auto send = std::make_shared<TokenSend>();
+    send->token_id = token_ids[_rng() % token_ids.size()];
+    send->token_fee = SyntheticLedger::TOKEN_FEE;
+    send->AddTransaction(_ledger.Users()[RandomDestination(user)].pub, TOKEN_SEND_AMOUNT);
+
+    return Finish(send, _ledger.Users()[user], _users[user]);
+}
+
+RequestGenerator::RequestPtr RequestGenerator::MakeDistribute(size_t token)
+{
+    auto & controller = _ledger.Users()[0];
+    auto & chain = _tokens[token];
+
+    // Token admin requests extend the token account's chain, but are
+    // issued and signed by the controller.
+    auto distribute = std::make_shared<Distribute>();
+    distribute->origin = controller.pub;
+    distribute->previous = chain.head;
+    distribute->sequence = chain.sequence;
+    distribute->fee = PersistenceManager<R>::MinTransactionFee(RequestType::Distribute);
+    distribute->token_id = _ledger.TokenIds()[token];
+    distribute->transaction = {_ledger.Users()[RandomDestination(0)].pub, TOKEN_SEND_AMOUNT};
+    distribute->Sign(controller.prv, controller.pub);
+
+    chain.head = distribute->GetHash();
+    chain.sequence++;
+    _generated[distribute->type]++;
+
+    return distribute;
+}
+
+RequestGenerator::RequestPtr RequestGenerator::MakeVote(size_t rep)
+{
+    auto vote = std::make_shared<ElectionVote>();
+    vote->epoch_num = _ledger.Config().epoch;
+
+    auto candidates = std::min<size_t>(_ledger.Config().candidates, MAX_VOTES);
+    for(size_t i = 0; i < candidates; ++i)
+    {
+        vote->votes.emplace_back(_ledger.Reps()[(rep + i) % _ledger.Config().candidates].pub, 1);
+    }
+
+    return Finish(vote, _ledger.Reps()[rep], _reps[rep], true);
+}
+
+RequestGenerator::RequestPtr RequestGenerator::MakeProxy(size_t user)
+{
+    auto & chain = _users[user];
+
+    // Lowering the locked proxy leaves thawing funds behind, users
+    // without a rep lock proxy for the first time.
+    auto proxy = std::make_shared<Proxy>();
+    proxy->epoch_num = _ledger.Config().epoch;
+    proxy->rep = _ledger.Reps()[_ledger.StakerRep(user)].pub;
+    proxy->lock_proxy = chain.stake.is_zero() ? SyntheticLedger::STAKER_LOCK : chain.stake - PROXY_STEP;
+    chain.stake = proxy->lock_proxy;
+
+    return Finish(proxy, _ledger.Users()[user], chain, true);
+}
+
+RequestGenerator::RequestPtr RequestGenerator::MakeStake(size_t rep)
+{
+    auto & chain = _reps[rep];
+
+    // Alternately raise and lower the self stake, the latter leaving
+    // thawing funds which the former then draws from.
+    auto stake = std::make_shared<Stake>();
+    stake->epoch_num = _ledger.Config().epoch;
+    stake->stake = chain.stake == MIN_DELEGATE_STAKE ? MIN_DELEGATE_STAKE + 1 : MIN_DELEGATE_STAKE;
+    chain.stake = stake->stake;
+
+    return Finish(stake, _ledger.Reps()[rep], chain, true);
+}
+
+RequestGenerator::RequestPtr RequestGenerator::MakeClaim(size_t user)
+{
+    auto claim = std::make_shared<Claim>();
+    claim->epoch_hash = _ledger.EpochHash();
+    claim->epoch_number = _ledger.Config().epoch - 1;
+
+    return Finish(claim, _ledger.Users()[user], _users[user]);
+}
+
+RequestGenerator::RequestPtr RequestGenerator::Finish(std::shared_ptr<Request> request,
+                                                      const BenchAccount & account,
+                                                      BenchChain & chain,
+                                                      bool governance)
+{
+    request->origin = account.pub;
+    request->previous = chain.head;
+    request->sequence = chain.sequence;
+    request->fee = PersistenceManager<R>::MinTransactionFee(request->type);
+
+    if(governance)
+    {
+        std::static_pointer_cast<Governance>(request)->governance_subchain_prev = chain.governance_head;
+    }
+
+    request->Sign(account.prv, account.pub);
+
+    chain.head = request->GetHash();
+    chain.sequence++;
+    if(governance)
+    {
+        chain.governance_head = chain.head;
+    }
+    _generated[request->type]++;
+
+    return request;
+}
+
+size_t RequestGenerator::RandomDestination(size_t user)
+{
+    if(_users.size() < 2)
+    {
+        return user;
+    }
+
+    auto destination = _rng() % (_users.size() - 1);
+    return destination >= user ? destination + 1 : destination;
+}
@@ -0,0 +1,92 @@
+/// @file
+/// This file contains the declaration of RequestGenerator, a deterministic
+/// source of valid, signed requests against a SyntheticLedger.
+#pragma once
+
+#include <logos/benchmark/synthetic_ledger.hpp>
+#include <logos/request/requests.hpp>
+
+#include <memory>
+#include <map>
+#include <random>
+#include <vector>
+
+/// Relative weights of the generated request types.
+struct RequestMix
+{
+    uint32_t send       = 80;
+    uint32_t token_send = 15;
+    uint32_t vote       = 5;
+};
+
+class RequestGenerator
+{
+public:
+
+    using RequestPtr  = std::shared_ptr<Request>;
+    using RequestList = std::vector<RequestPtr>;
+
+    RequestGenerator(const SyntheticLedger & ledger,
+                     const RequestMix & mix,
+                     uint64_t seed = 1);
+
+    /// Generate the next batch of requests following the mix.
+    ///
+    /// Every origin appears at most once per batch, since a request can only
+    /// be validated against the account head left by its predecessor once
+    /// that predecessor has been persisted. Each representative votes at
+    /// most once per epoch; once all of them have voted, the vote share of
+    /// the mix is served with sends instead.
+    ///     @param count maximum number of requests, capped by the number of accounts
+    ///     @returns the generated requests
+    RequestList Next(size_t count);
+
+    /// Generate the next batch of requests of a single type.
+    ///
+    /// Origins are drawn, at most once per batch, from the accounts able
+    /// to issue the type: users for Send, TokenSend and Claim, stakers (or
+    /// users, if there are none) for Proxy, representatives for Stake and
+    /// ElectionVote and the token accounts for Distribute. ElectionVote and
+    /// Claim are accepted once per origin and epoch, so their batches
+    /// shrink, down to empty, once every origin has issued one.
+    ///     @param type request type
+    ///     @param count maximum number of requests
+    ///     @returns the generated requests, empty if type isn't supported
+    RequestList Next(RequestType type, size_t count);
+
+    /// @returns true if Next can generate requests of the given type
+    static bool Supports(RequestType type);
+
+    /// @returns the number of requests generated of the given type
+    uint64_t Generated(RequestType type) const;
+
+private:
+
+    RequestPtr MakeSend(size_t user);
+    RequestPtr MakeTokenSend(size_t user);
+    RequestPtr MakeDistribute(size_t token);
+    RequestPtr MakeVote(size_t rep);
+    RequestPtr MakeProxy(size_t user);
+    RequestPtr MakeStake(size_t rep);
+    RequestPtr MakeClaim(size_t user);
+
+    /// Sign the request and advance the chain it extends.
+    RequestPtr Finish(std::shared_ptr<Request> request,
+                      const BenchAccount & account,
+                      BenchChain & chain,
+                      bool governance = false);
+
+    size_t RandomDestination(size_t user);
+
+    const SyntheticLedger &          _ledger;
+    RequestMix                       _mix;
+    std::mt19937_64                  _rng;
+    std::vector<BenchChain>          _users;
+    std::vector<BenchChain>          _reps;
+    std::vector<BenchChain>          _tokens;
+    size_t                           _next_user  = 0;
+    size_t                           _next_rep   = 0;
+    size_t                           _next_claim = 0;
+    std::map<RequestType, size_t>    _cursors;
+    std::map<RequestType, uint64_t>  _generated;
+};
@@ -0,0 +1,182 @@
+/// @file
+/// This file contains the implementation of the serialization microbenchmark.
+
+#include <logos/benchmark/serialization_bench.hpp>
+#include <logos/benchmark/bench_stats.hpp>
+
+#include <logos/consensus/messages/messages.hpp>
+#include <logos/lib/span_stream.hpp>
+#include <logos/lib/log.hpp>
+#include <logos/node/utility.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using Block = PostCommittedBlock<ConsensusType::Request>;
+
+Block MakeBlock(uint32_t count, uint64_t seed)
+{
+    std::mt19937_64 engine(seed);
+    auto random = [&engine]()
+    {
+        logos::uint256_union value;
+        for(auto & qword : value.qwords)
+        {
+            qword = engine();
+        }
+        return value;
+    };
+
+    PrePrepareMessage<ConsensusType::Request> pre_prepare;
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        auto send = std::make_shared<Send>(random(), random(), i, random(), Amount(engine()),
+                                           Amount(engine()), AccountSig());
+        for(auto extra = engine() % Send::MAX_TRANSACTIONS; extra; --extra)
+        {
+            send->AddTransaction(random(), Amount(engine()));
+        }
+        pre_prepare.AddRequest(send);
+        pre_prepare.hashes.push_back(send->GetHash());
+    }
+
+    AggSignature post_prepare_sig;
+    AggSignature post_commit_sig;
+    Block block(pre_prepare, post_prepare_sig, post_commit_sig);
+    block.next = random();
+
+    return block;
+}
+
+/// The serialization path before span streams: grow the buffer with a
+/// vectorstream, then patch in the payload size.
+void VectorSerialize(const Block & block, std::vector<uint8_t> & buf)
+{
+    {
+        logos::vectorstream stream(buf);
+        block.payload_size = block.Serialize(stream, true, true) - MessagePrequelSize;
+    }
+
+    HeaderStream header_stream(buf.data(), MessagePrequelSize);
+    block.MessagePrequel<MessageType::Post_Committed_Block, ConsensusType::Request>::Serialize(header_stream);
+}
+
+template <typename Stream>
+bool Deserialize(const std::vector<uint8_t> & buf, const BlockHash & hash)
+{
+    bool error = false;
+    Stream stream(buf.data() + MessagePrequelSize, buf.size() - MessagePrequelSize);
+    Block block(error, stream, logos_version, true, true);
+    return !error && block.Hash() == hash;
+}
+
+/// @returns nanoseconds per block
+template <typename Op>
+double Time(uint32_t rounds, Op op)
+{
+    auto start = WallNanos();
+    for(uint32_t round = 0; round < rounds; ++round)
+    {
+        op();
+    }
+    return rounds ? double(WallNanos() - start) / rounds : 0;
+}
+
+void AddCase(boost::property_tree::ptree & cases, const std::string & name,
+             double stream_ns, double span_ns, bool matches)
+{
+    boost::property_tree::ptree tree;
+    tree.put("stream_ns_per_block", stream_ns);
+    tree.put("span_ns_per_block", span_ns);
+    tree.put("speedup", span_ns > 0 ? stream_ns / span_ns : 0);
+    tree.put("matches", matches);
+    cases.add_child(name, tree);
+}
+
+}
+
+SerializationBench::SerializationBench(const SerializationBenchConfig & config)
+    : _config(config)
+{}
+
+bool SerializationBench::Run(boost::property_tree::ptree & report)
+{
+    boost::property_tree::ptree config_tree;
+    config_tree.put("batch", _config.batch);
+    config_tree.put("rounds", _config.rounds);
+    config_tree.put("seed", _config.seed);
+    report.add_child("config", config_tree);
+    report.put("suite", "serialization");
+
+    auto block = MakeBlock(std::min<uint32_t>(_config.batch, CONSENSUS_BATCH_SIZE), _config.seed);
+    auto hash = block.Hash();
+    boost::property_tree::ptree cases;
+
+    std::vector<uint8_t> stream_buf;
+    std::vector<uint8_t> span_buf;
+
+    auto stream_ns = Time(_config.rounds, [&]()
+    {
+        stream_buf.clear();
+        stream_buf.shrink_to_fit();
+        VectorSerialize(block, stream_buf);
+    });
+    auto span_ns = Time(_config.rounds, [&]()
+    {
+        span_buf.clear();
+        span_buf.shrink_to_fit();
+        block.Serialize(span_buf, true, true);
+    });
+    AddCase(cases, "serialize", stream_ns, span_ns, stream_buf == span_buf);
+    report.put("block_bytes", span_buf.size());
+
+    // The database form, which omits the requests and the header's payload size.
+    std::vector<uint8_t> stream_db;
+    std::vector<uint8_t> span_db;
+
+    stream_ns = Time(_config.rounds, [&]()
+    {
+        stream_db.clear();
+        stream_db.shrink_to_fit();
+        logos::vectorstream stream(stream_db);
+        block.Serialize(stream, false, true);
+    });
+    span_ns = Time(_config.rounds, [&]()
+    {
+        span_db.clear();
+        span_db.shrink_to_fit();
+        block.to_mdb_val(span_db);
+    });
+    AddCase(cases, "serialize_db", stream_ns, span_ns, stream_db == span_db);
+
+    bool stream_ok = true;
+    bool span_ok = true;
+    stream_ns = Time(_config.rounds, [&]()
+    {
+        stream_ok &= Deserialize<logos::bufferstream>(span_buf, hash);
+    });
+    span_ns = Time(_config.rounds, [&]()
+    {
+        span_ok &= Deserialize<logos::span_reader>(span_buf, hash);
+    });
+    AddCase(cases, "deserialize", stream_ns, span_ns, stream_ok && span_ok);
+
+    report.add_child("cases", cases);
+
+    bool error = false;
+    for(auto & entry : cases)
+    {
+        if(!entry.second.get<bool>("matches"))
+        {
+            Log log;
+            LOG_ERROR(log) << "SerializationBench::Run - " << entry.first << " results differ between stream buffers";
+            error = true;
+        }
+    }
+
+    return error;
+}
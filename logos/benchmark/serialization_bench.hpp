@@ -0,0 +1,35 @@
+/// @file
+/// This file contains the declaration of the serialization microbenchmark,
+/// which compares the stream buffers used to serialize and deserialize
+/// consensus blocks: the growing vectorstream and array backed
+/// bufferstream against the pre-sized span_writer and span_reader.
+#pragma once
+
+#include <boost/property_tree/ptree.hpp>
+
+struct SerializationBenchConfig
+{
+    uint32_t batch  = 1500; ///< requests per block
+    uint32_t rounds = 100;  ///< measured blocks per case
+    uint64_t seed   = 1;
+};
+
+class SerializationBench
+{
+public:
+
+    explicit SerializationBench(const SerializationBenchConfig & config);
+
+    /// Run the benchmark.
+    ///
+    /// A post-committed request block of Send requests with one to eight
+    /// transactions is serialized for the network and the database, and
+    /// deserialized, with each pair of stream buffers.
+    ///     @param report receives the results [out]
+    ///     @returns true on error
+    bool Run(boost::property_tree::ptree & report);
+
+private:
+
+    SerializationBenchConfig _config;
+};
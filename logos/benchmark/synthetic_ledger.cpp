@@ -0,0 +1,298 @@
+/// @file
+/// This file contains the implementation of SyntheticLedger.
+
+#include <logos/benchmark/synthetic_ledger.hpp>
+
+#include <logos/consensus/persistence/request/request_persistence.hpp>
+#include <logos/consensus/consensus_container.hpp>
+#include <logos/epoch/epoch_voting_manager.hpp>
+#include <logos/rewards/epoch_rewards_manager.hpp>
+#include <logos/staking/voting_power_manager.hpp>
+#include <logos/staking/staking_manager.hpp>
+#include <logos/governance/requests.hpp>
+#include <logos/token/account.hpp>
+#include <logos/token/entry.hpp>
+#include <logos/node/utility.hpp>
+#include <logos/lib/log.hpp>
+
+#include <blake2/blake2.h>
+#include <ed25519-donna/ed25519.h>
+
+#include <algorithm>
+
+namespace
+{
+
+// Arbitrary valid secp256r1 point; candidacy requests are persisted with
+// their ECIES key, which must therefore be initialized.
+const std::string BENCH_ECIES_KEY =
+        "8e1ad798008baac3663c0c1a6ce04c7cb632eb504562de923845fccf39d1c46dee"
+        "52df70f6cf46f1351ce7ac8e92055e5f168f5aff24bcaab7513d447fd677d3";
+
+BenchAccount MakeAccount(uint64_t seed, uint64_t index)
+{
+    BenchAccount account;
+
+    blake2b_state hash;
+    blake2b_init(&hash, account.prv.bytes.size());
+    blake2b_update(&hash, &seed, sizeof(seed));
+    blake2b_update(&hash, &index, sizeof(index));
+    blake2b_final(&hash, account.prv.bytes.data(), account.prv.bytes.size());
+
+    ed25519_publickey(account.prv.bytes.data(), account.pub.bytes.data());
+    return account;
+}
+
+std::shared_ptr<StartRepresenting> MakeStartRepresenting(const BenchAccount & rep,
+                                                         const BenchChain & chain,
+                                                         uint32_t epoch)
+{
+    auto request = std::make_shared<StartRepresenting>();
+    request->origin = rep.pub;
+    request->previous = chain.head;
+    request->sequence = chain.sequence;
+    request->fee = PersistenceManager<R>::MinTransactionFee(RequestType::StartRepresenting);
+    request->epoch_num = epoch;
+    request->governance_subchain_prev = chain.governance_head;
+    request->set_stake = true;
+    request->stake = MIN_DELEGATE_STAKE;
+    request->Sign(rep.prv, rep.pub);
+    return request;
+}
+
+std::shared_ptr<AnnounceCandidacy> MakeAnnounceCandidacy(const BenchAccount & rep,
+                                                         const BenchChain & chain,
+                                                         uint32_t epoch)
+{
+    auto request = std::make_shared<AnnounceCandidacy>();
+    request->origin = rep.pub;
+    request->previous = chain.head;
+    request->sequence = chain.sequence;
+    request->fee = PersistenceManager<R>::MinTransactionFee(RequestType::AnnounceCandidacy);
+    request->epoch_num = epoch;
+    request->governance_subchain_prev = chain.governance_head;
+    request->set_stake = false;
+    request->stake = 0;
+    request->ecies_key.FromHexString(BENCH_ECIES_KEY);
+    request->Sign(rep.prv, rep.pub);
+    return request;
+}
+
+std::shared_ptr<Proxy> MakeProxy(const BenchAccount & user,
+                                 const BenchChain & chain,
+                                 const BenchAccount & rep,
+                                 const Amount & lock_proxy,
+                                 uint32_t epoch)
+{
+    auto request = std::make_shared<Proxy>();
+    request->origin = user.pub;
+    request->previous = chain.head;
+    request->sequence = chain.sequence;
+    request->fee = PersistenceManager<R>::MinTransactionFee(RequestType::Proxy);
+    request->epoch_num = epoch;
+    request->governance_subchain_prev = chain.governance_head;
+    request->lock_proxy = lock_proxy;
+    request->rep = rep.pub;
+    request->Sign(user.prv, user.pub);
+    return request;
+}
+
+// Epoch block of the epoch preceding the benchmarked one; its delegates
+// are not among the synthetic accounts, so candidacies are stored right
+// away and the benchmarked epoch is outside of the elections dead period.
+ApprovedEB MakeEpochBlock(uint32_t epoch)
+{
+    ApprovedEB eb;
+    eb.epoch_number = epoch;
+    eb.sequence = 0;
+    eb.previous = 0;
+    ECIESPublicKey ecies;
+    ecies.FromHexString(BENCH_ECIES_KEY);
+    for(uint8_t i = 0; i < NUM_DELEGATES; ++i)
+    {
+        eb.delegates[i] = Delegate(AccountAddress(i + 1), DelegatePubKey(), ecies, 1, 1);
+    }
+    return eb;
+}
+
+}
+
+const Amount SyntheticLedger::USER_BALANCE       = logos::Mlgs_ratio;
+const Amount SyntheticLedger::USER_TOKEN_BALANCE(logos::uint128_t(1) << 64);
+const Amount SyntheticLedger::TOKEN_FEE          = 1;
+const Amount SyntheticLedger::STAKER_LOCK(logos::Mlgs_ratio / 2);
+
+SyntheticLedger::SyntheticLedger(const LedgerConfig & config)
+    : _config(config)
+{
+    _config.candidates = std::min(_config.candidates, _config.reps);
+    _config.stakers = _config.reps ? std::min(_config.stakers, _config.accounts) : 0;
+    _config.tokens = std::max<uint32_t>(_config.tokens, 1);
+    // Each thawing fund is left by lowering the locked proxy in a
+    // distinct epoch preceding the benchmarked one.
+    _config.epoch = std::max(_config.epoch, _config.thawing + 2);
+
+    for(uint64_t i = 0; i < _config.accounts; ++i)
+    {
+        _users.push_back(MakeAccount(_config.seed, i));
+    }
+    _user_chains.resize(_users.size());
+
+    for(uint64_t i = 0; i < _config.reps; ++i)
+    {
+        _reps.push_back(MakeAccount(_config.seed, _config.accounts + i));
+    }
+    _rep_chains.resize(_reps.size());
+
+    // Seed requests are recorded in apply order, one epoch at a time.
+    for(size_t i = 0; i < _reps.size(); ++i)
+    {
+        auto & chain = _rep_chains[i];
+        AddSeedRequest(FirstEpoch(), chain, MakeStartRepresenting(_reps[i], chain, FirstEpoch()));
+        chain.stake = MIN_DELEGATE_STAKE;
+    }
+
+    auto thawing_step = Amount(STAKER_LOCK.number() / (2 * (_config.thawing + 1)));
+    for(uint32_t epoch = FirstEpoch(); epoch < _config.epoch; ++epoch)
+    {
+        for(size_t i = 0; i < _config.stakers; ++i)
+        {
+            auto & chain = _user_chains[i];
+            auto lock = epoch == FirstEpoch() ? STAKER_LOCK : chain.stake - thawing_step;
+            AddSeedRequest(epoch, chain, MakeProxy(_users[i], chain, _reps[StakerRep(i)], lock, epoch));
+            chain.stake = lock;
+        }
+    }
+
+    for(size_t i = 0; i < _config.candidates; ++i)
+    {
+        auto & chain = _rep_chains[i];
+        AddSeedRequest(_config.epoch - 1, chain, MakeAnnounceCandidacy(_reps[i], chain, _config.epoch - 1));
+    }
+
+    auto issuer = _users.empty() ? AccountAddress(0) : _users[0].pub;
+    for(uint32_t i = 0; i < _config.tokens; ++i)
+    {
+        auto suffix = i ? std::to_string(i) : std::string();
+        _token_ids.push_back(GetTokenID("BENCH" + suffix, "Bench Token" + suffix, issuer, 0));
+    }
+
+    _epoch_hash = MakeEpochBlock(_config.epoch - 1).Hash();
+}
+
+void SyntheticLedger::AddSeedRequest(uint32_t epoch, BenchChain & chain, RequestPtr request)
+{
+    chain.head = request->GetHash();
+    chain.sequence++;
+    chain.governance_head = chain.head;
+    _seed_requests.push_back({epoch, request});
+}
+
+bool SyntheticLedger::Seed(logos::block_store & store) const
+{
+    Log log;
+    BindManagers(store);
+
+    ConsensusContainer::SetCurEpochNumber(_config.epoch);
+    EpochVotingManager::START_ELECTIONS_EPOCH = std::min(EpochVotingManager::START_ELECTIONS_EPOCH,
+                                                         _config.epoch);
+    EpochVotingManager::ENABLE_ELECTIONS = true;
+
+    PersistenceManager<R> persistence(store, nullptr);
+    logos::transaction txn(store.environment, nullptr, true);
+
+    auto eb = MakeEpochBlock(_config.epoch - 1);
+    if(store.epoch_put(eb, txn) || store.epoch_tip_put(eb.CreateTip(), txn))
+    {
+        LOG_ERROR(log) << "SyntheticLedger::Seed - failed to store epoch block";
+        return true;
+    }
+
+    ControllerInfo::Privileges privileges;
+    privileges.Set(size_t(ControllerPrivilege::Distribute));
+
+    for(uint32_t i = 0; i < _token_ids.size(); ++i)
+    {
+        auto suffix = i ? std::to_string(i) : std::string();
+
+        // Half of the supply is held by users, the other half is
+        // left for Distribute requests.
+        TokenAccount token;
+        token.SetBalance(USER_BALANCE, FirstEpoch(), txn);
+        token.fee_type = TokenFeeType::Flat;
+        token.fee_rate = TOKEN_FEE;
+        token.symbol = "BENCH" + suffix;
+        token.name = "Bench Token" + suffix;
+        token.total_supply = Amount(USER_TOKEN_BALANCE.number() * std::max<uint32_t>(_config.accounts, 1) * 2);
+        token.token_balance = Amount(USER_TOKEN_BALANCE.number() * std::max<uint32_t>(_config.accounts, 1));
+        if(!_users.empty())
+        {
+            token.controllers.push_back(ControllerInfo(_users[0].pub, privileges));
+        }
+
+        if(store.token_account_put(_token_ids[i], token, txn))
+        {
+            LOG_ERROR(log) << "SyntheticLedger::Seed - failed to store token account";
+            return true;
+        }
+    }
+
+    for(auto & user : _users)
+    {
+        logos::account_info info;
+        info.SetBalance(USER_BALANCE, FirstEpoch(), txn);
+
+        for(auto & token_id : _token_ids)
+        {
+            TokenEntry entry;
+            entry.token_id = token_id;
+            entry.balance = USER_TOKEN_BALANCE;
+            info.entries.push_back(entry);
+        }
+
+        if(store.account_put(user.pub, info, txn))
+        {
+            LOG_ERROR(log) << "SyntheticLedger::Seed - failed to store account";
+            return true;
+        }
+    }
+
+    for(auto & rep : _reps)
+    {
+        logos::account_info info;
+        info.SetBalance(Amount(MIN_DELEGATE_STAKE.number() * 2), FirstEpoch(), txn);
+        if(store.account_put(rep.pub, info, txn))
+        {
+            LOG_ERROR(log) << "SyntheticLedger::Seed - failed to store rep account";
+            return true;
+        }
+    }
+
+    for(auto & seed : _seed_requests)
+    {
+        persistence.ApplyRequest(seed.request, 0, seed.epoch, txn);
+    }
+
+    return false;
+}
+
+void SyntheticLedger::BindManagers(logos::block_store & store)
+{
+    VotingPowerManager::SetInstance(store);
+    StakingManager::SetInstance(store);
+    EpochRewardsManager::SetInstance(store);
+}
+
+std::unique_ptr<logos::block_store> SyntheticLedger::CreateStore(boost::filesystem::path & path)
+{
+    bool error = false;
+    path = logos::unique_path();
+
+    std::unique_ptr<logos::block_store> store(new logos::block_store(error, path));
+    if(error)
+    {
+        store.reset();
+    }
+
+    return store;
+}
@@ -0,0 +1,122 @@
+/// @file
+/// This file contains the declaration of SyntheticLedger, which seeds
+/// identical, deterministic state into the temporary block stores used
+/// by the logos_bench suites.
+#pragma once
+
+#include <logos/consensus/messages/byte_arrays.hpp>
+#include <logos/request/requests.hpp>
+#include <logos/blockstore.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <memory>
+#include <vector>
+
+/// Shape of the synthetic ledger.
+struct LedgerConfig
+{
+    uint32_t accounts   = 1000;  ///< user accounts holding logos and tokens
+    uint32_t reps       = 64;    ///< representatives, each may vote once per epoch
+    uint32_t candidates = 8;     ///< representatives that also announce candidacy
+    uint32_t tokens     = 1;     ///< token accounts, every user holds an entry for each
+    uint32_t stakers    = 0;     ///< users locking proxy to a representative
+    uint32_t thawing    = 0;     ///< thawing funds, and thus liabilities, per staker
+    uint32_t epoch      = 10;    ///< epoch in which benchmarked requests are issued
+    uint64_t seed       = 1;     ///< seed for the deterministic account keys
+};
+
+/// A deterministic account key pair.
+struct BenchAccount
+{
+    AccountPrivKey prv;
+    AccountPubKey  pub;
+};
+
+/// State of an account's request chains after seeding.
+struct BenchChain
+{
+    BlockHash head;
+    uint32_t  sequence = 0;
+    BlockHash governance_head;
+    Amount    stake = 0;        ///< self stake for reps, locked proxy for users
+};
+
+class SyntheticLedger
+{
+public:
+
+    explicit SyntheticLedger(const LedgerConfig & config);
+
+    /// Seed the ledger into an empty store.
+    ///
+    /// User accounts are given a logos balance and a tethered entry for
+    /// every token. Governance state is built through the regular apply
+    /// path, one epoch at a time: representatives start representing
+    /// config.thawing + 1 epochs before config.epoch, stakers lock proxy
+    /// to a representative in that same epoch and lower it in each of the
+    /// following ones, leaving one thawing fund and liability per epoch,
+    /// and candidates announce their candidacy in the epoch preceding
+    /// config.epoch, so that ElectionVotes issued in config.epoch validate.
+    ///     @param store the store to seed
+    ///     @returns true on error
+    bool Seed(logos::block_store & store) const;
+
+    /// Point the process wide staking, voting power and rewards managers
+    /// at the given store. The managers are singletons which are rebound
+    /// by every block_store constructor, so a process holding several
+    /// stores has to rebind them before touching a given store.
+    static void BindManagers(logos::block_store & store);
+
+    /// Create a block store in a fresh temporary directory.
+    ///     @param path set to the database file path
+    ///     @returns the store, or nullptr on error
+    static std::unique_ptr<logos::block_store> CreateStore(boost::filesystem::path & path);
+
+    const LedgerConfig & Config() const { return _config; }
+    const std::vector<BenchAccount> & Users() const { return _users; }
+    const std::vector<BenchAccount> & Reps() const { return _reps; }
+
+    /// Chain state of user/rep i after seeding.
+    const BenchChain & UserChain(size_t i) const { return _user_chains[i]; }
+    const BenchChain & RepChain(size_t i) const { return _rep_chains[i]; }
+
+    /// Representative stakers proxy to.
+    size_t StakerRep(size_t user) const { return user % _reps.size(); }
+
+    /// Users[0] controls every token account.
+    const std::vector<BlockHash> & TokenIds() const { return _token_ids; }
+    const BlockHash & TokenId() const { return _token_ids[0]; }
+
+    /// Hash of the seeded epoch block, which may be claimed against.
+    const BlockHash & EpochHash() const { return _epoch_hash; }
+
+    static const Amount USER_BALANCE;
+    static const Amount USER_TOKEN_BALANCE;
+    static const Amount TOKEN_FEE;
+    static const Amount STAKER_LOCK;
+
+private:
+
+    using RequestPtr = std::shared_ptr<const Request>;
+
+    /// A governance request applied while seeding.
+    struct SeedRequest
+    {
+        uint32_t   epoch;
+        RequestPtr request;
+    };
+
+    void AddSeedRequest(uint32_t epoch, BenchChain & chain, RequestPtr request);
+
+    uint32_t FirstEpoch() const { return _config.epoch - 1 - _config.thawing; }
+
+    LedgerConfig              _config;
+    std::vector<BenchAccount> _users;
+    std::vector<BenchAccount> _reps;
+    std::vector<BenchChain>   _user_chains;
+    std::vector<BenchChain>   _rep_chains;
+    std::vector<SeedRequest>  _seed_requests;
+    std::vector<BlockHash>    _token_ids;
+    BlockHash                 _epoch_hash;
+};
@@ -12,6 +12,29 @@
 #include <logos/staking/staked_funds.hpp>
 #include <logos/staking/thawing_funds.hpp>
 
+#include <boost/endian/conversion.hpp>
+
+namespace
+{
+
+// meta key of the first epoch whose governance requests are all checkpointed,
+// key 1 is the store version
+const uint64_t GOVERNANCE_CHECKPOINT_KEY = 2;
+
+// entries copied per history environment transaction by split_history
+const size_t HISTORY_SPLIT_BATCH = 10000;
+
+// meta key of the last epoch moved to segments
+const uint64_t SEGMENT_ARCHIVED_KEY = 3;
+
+// meta key present once the history tables are kept in their own environment
+const uint64_t HISTORY_SPLIT_KEY = 4;
+
+// meta key of the request blocks left behind by archived epochs
+const uint64_t SEGMENT_DEFERRED_KEY = 5;
+
+}
+
 logos::store_entry::store_entry () :
 first (0, nullptr),
 second (0, nullptr)
@@ -148,7 +171,7 @@ template<typename T>
 bool logos::block_store::put(MDB_dbi &db, const mdb_val &key, const T &t, MDB_txn *tx)
 {
     std::vector<uint8_t> buf;
-    auto status(mdb_put(tx, db, key, t.to_mdb_val(buf), 0));
+    auto status(mdb_put(txn_for(db, tx), db, key, t.to_mdb_val(buf), 0));
     assert(status == 0);
     return status;
 }
@@ -169,9 +192,9 @@ bool logos::block_store::get(MDB_dbi &db, const mdb_val &key, T &t, MDB_txn *tx)
     int status = 0;
     if (tx == 0) {
         logos::transaction transaction(environment, nullptr, false);
-        status = mdb_get(transaction, db, key, value);
+        status = mdb_get(txn_for(db, transaction), db, key, value);
     } else {
-        status = mdb_get(tx, db, key, value);
+        status = mdb_get(txn_for(db, tx), db, key, value);
     }
     assert (status == 0 || status == MDB_NOTFOUND);
     bool result;
@@ -203,11 +226,16 @@ template bool logos::block_store::get(MDB_dbi&, logos::mdb_val const &, Liabilit
 template bool logos::block_store::put(MDB_dbi&, logos::mdb_val const &, Liability const &, MDB_txn*);
 template bool logos::block_store::get(MDB_dbi&, logos::mdb_val const &, VotingPowerFallback&, MDB_txn*);
 template bool logos::block_store::put(MDB_dbi&, logos::mdb_val const &, VotingPowerFallback const &, MDB_txn*);
+template bool logos::block_store::put(MDB_dbi&, logos::mdb_val const &, GovernanceCheckpoint const &, MDB_txn*);
+template bool logos::block_store::get(MDB_dbi&, logos::mdb_val const &, ThawingSummary&, MDB_txn*);
+template bool logos::block_store::put(MDB_dbi&, logos::mdb_val const &, ThawingSummary const &, MDB_txn*);
+template bool logos::block_store::get(MDB_dbi&, logos::mdb_val const &, SecondaryLiabilitySummary&, MDB_txn*);
+template bool logos::block_store::put(MDB_dbi&, logos::mdb_val const &, SecondaryLiabilitySummary const &, MDB_txn*);
 
 
 bool logos::block_store::del(MDB_dbi &db, const mdb_val &key, MDB_txn *tx)
 {
-    auto status (mdb_del (tx, db, key, nullptr));
+    auto status (mdb_del (txn_for (db, tx), db, key, nullptr));
 
     auto error = status != 0;
 
@@ -245,27 +273,33 @@ bool logos::block_store::iterate_db(
 
 template bool logos::block_store::iterate_db(MDB_dbi&, AccountAddress const &, std::function<bool(ThawingFunds&, logos::store_iterator&)> const &,MDB_txn*);
 
-logos::block_store::block_store (bool & error_a, boost::filesystem::path const & path_a, int lmdb_max_dbs) :
+logos::block_store::block_store (bool & error_a, boost::filesystem::path const & path_a, int lmdb_max_dbs, boost::filesystem::path const & history_path_a) :
 environment (error_a, path_a, lmdb_max_dbs)
 {
+    if (!error_a && !history_path_a.empty ())
+    {
+        error_a |= open_history (history_path_a, lmdb_max_dbs);
+    }
     if (!error_a)
     {
         logos::transaction transaction (environment, nullptr, true);
+        auto history (history_txn (transaction));
 
         // consensus-prototype
-        error_a |= mdb_dbi_open (transaction, "batch_db", MDB_CREATE, &batch_db) != 0;
-        error_a |= mdb_dbi_open (transaction, "request_db", MDB_CREATE, &request_db) != 0;
+        error_a |= mdb_dbi_open (history, "batch_db", MDB_CREATE, &batch_db) != 0;
+        error_a |= mdb_dbi_open (history, "request_db", MDB_CREATE, &request_db) != 0;
         error_a |= mdb_dbi_open (transaction, "account_db", MDB_CREATE, &account_db) != 0;
         error_a |= mdb_dbi_open (transaction, "reservation_db", MDB_CREATE, &reservation_db) != 0;
-        error_a |= mdb_dbi_open (transaction, "receive_db", MDB_CREATE, &receive_db) != 0;
+        error_a |= mdb_dbi_open (history, "receive_db", MDB_CREATE, &receive_db) != 0;
         error_a |= mdb_dbi_open (transaction, "request_tips_db", MDB_CREATE, &request_tips_db) != 0;
 
         // microblock-prototype
-        error_a |= mdb_dbi_open (transaction, "micro_block_db", MDB_CREATE, &micro_block_db) != 0;
+        error_a |= mdb_dbi_open (history, "micro_block_db", MDB_CREATE, &micro_block_db) != 0;
         error_a |= mdb_dbi_open (transaction, "micro_block_tip_db", MDB_CREATE, &micro_block_tip_db) != 0;
 
         // microblock-prototype
-        error_a |= mdb_dbi_open (transaction, "epoch_db", MDB_CREATE, &epoch_db) != 0;
+        error_a |= mdb_dbi_open (history, "epoch_db", MDB_CREATE, &epoch_db) != 0;
+        error_a |= mdb_dbi_open (history, "segment_index_db", MDB_CREATE, &segment_index_db) != 0;
         error_a |= mdb_dbi_open (transaction, "epoch_tip_db", MDB_CREATE, &epoch_tip_db) != 0;
 
         // token platform
@@ -275,6 +309,21 @@ environment (error_a, path_a, lmdb_max_dbs)
         error_a |= mdb_dbi_open (transaction, "meta", MDB_CREATE, &meta) != 0;
         error_a |= mdb_dbi_open (transaction, "p2p_db", MDB_CREATE, &p2p_db) != 0;
 
+        // Once history is kept apart, the tables of this environment are
+        // empty and opening without it would look like a store without blocks.
+        logos::mdb_val split;
+        auto history_split (!error_a && mdb_get (transaction, meta, logos::mdb_val (logos::uint256_union (HISTORY_SPLIT_KEY)), split) == 0);
+        if (history_split && environment.history == nullptr)
+        {
+            LOG_ERROR (log) << "block_store::block_store the block history was split from "
+                            << path_a.string () << ", it must be opened with its history path";
+            error_a = true;
+        }
+        else if (!error_a && !history_split && environment.history != nullptr)
+        {
+            error_a |= history_split_put (transaction);
+        }
+
         // elections
         error_a |= mdb_dbi_open (transaction, "representative_db", MDB_CREATE, &representative_db) != 0;
         error_a |= mdb_dbi_open (transaction, "candidacy_db", MDB_CREATE, &candidacy_db) != 0;
@@ -294,19 +343,121 @@ environment (error_a, path_a, lmdb_max_dbs)
         VotingPowerManager::SetInstance(*this);
         error_a |= mdb_dbi_open (transaction, "staking_db", MDB_CREATE, &staking_db);
         error_a |= mdb_dbi_open (transaction, "thawing_db", MDB_CREATE | MDB_DUPSORT, &thawing_db);
+        error_a |= mdb_dbi_open (transaction, "thawing_summary_db", MDB_CREATE, &thawing_summary_db);
         StakingManager::SetInstance(*this);
 
         //liabilities
         error_a |= mdb_dbi_open (transaction, "master_liabilities_db", MDB_CREATE, &master_liabilities_db);
         error_a |= mdb_dbi_open (transaction, "rep_liabilities_db", MDB_CREATE | MDB_DUPSORT, &rep_liabilities_db);
         error_a |= mdb_dbi_open (transaction, "secondary_liabilities_db", MDB_CREATE | MDB_DUPSORT, &secondary_liabilities_db);
+        error_a |= mdb_dbi_open (transaction, "secondary_liabilities_summary_db", MDB_CREATE, &secondary_liabilities_summary_db);
 
         //rewards
         error_a |= mdb_dbi_open (transaction, "rewards_db", MDB_CREATE, &rewards_db);
         error_a |= mdb_dbi_open (transaction, "global_rewards_db", MDB_CREATE, &global_rewards_db);
         error_a |= mdb_dbi_open (transaction, "delegate_rewards_db", MDB_CREATE, &delegate_rewards_db);
         EpochRewardsManager::SetInstance(*this);
+
+        //governance
+        error_a |= mdb_dbi_open (transaction, "governance_checkpoint_db", MDB_CREATE, &governance_checkpoint_db);
+
+        // A store that already has a chain was written without checkpoints,
+        // claims fall back to walking the governance subchain before the
+        // first epoch whose requests are all checkpointed.
+        logos::mdb_val start;
+        if (!error_a && mdb_get (transaction, meta, logos::mdb_val (logos::uint256_union (GOVERNANCE_CHECKPOINT_KEY)), start) == MDB_NOTFOUND)
+        {
+            Tip tip;
+            governance_checkpoint_start_put (epoch_tip_get (tip, transaction) ? 0 : tip.epoch + 2, transaction);
+        }
+    }
+}
+
+namespace
+{
+
+std::array<uint8_t, 36> governance_checkpoint_key (AccountAddress const & account, uint32_t epoch_number)
+{
+    std::array<uint8_t, 36> key;
+    std::copy (account.bytes.begin (), account.bytes.end (), key.begin ());
+    epoch_number = boost::endian::native_to_big (epoch_number);
+    memcpy (key.data () + account.bytes.size (), &epoch_number, sizeof (epoch_number));
+    return key;
+}
+
+}
+
+bool logos::block_store::governance_checkpoint_put(
+        AccountAddress const & account,
+        uint32_t epoch_number,
+        GovernanceCheckpoint const & checkpoint,
+        MDB_txn* txn)
+{
+    auto key = governance_checkpoint_key(account, epoch_number);
+    return put(governance_checkpoint_db, logos::mdb_val(key.size(), key.data()), checkpoint, txn);
+}
+
+bool logos::block_store::governance_checkpoint_get_prior(
+        AccountAddress const & account,
+        uint32_t before_epoch,
+        uint32_t & epoch_number,
+        GovernanceCheckpoint & checkpoint,
+        MDB_txn* txn)
+{
+    assert(txn != nullptr);
+
+    MDB_cursor * cursor;
+    if(mdb_cursor_open(txn, governance_checkpoint_db, &cursor))
+    {
+        return true;
+    }
+
+    // Position on the first key at or after (account, before_epoch) and
+    // step back to the last key preceding it.
+    auto key = governance_checkpoint_key(account, before_epoch);
+    logos::mdb_val key_val(key.size(), key.data());
+    logos::mdb_val value;
+
+    auto status = mdb_cursor_get(cursor, key_val, value, MDB_SET_RANGE);
+    status = mdb_cursor_get(cursor, key_val, value, status == MDB_NOTFOUND ? MDB_LAST : MDB_PREV);
+
+    bool error = status != 0
+                 || key_val.size() != key.size()
+                 || memcmp(key_val.data(), account.bytes.data(), account.bytes.size());
+
+    if(!error)
+    {
+        memcpy(&epoch_number, reinterpret_cast<uint8_t *>(key_val.data()) + account.bytes.size(), sizeof(epoch_number));
+        epoch_number = boost::endian::big_to_native(epoch_number);
+
+        logos::bufferstream stream(reinterpret_cast<uint8_t const *>(value.data()), value.size());
+        error = checkpoint.Deserialize(stream);
+        assert(!error);
+    }
+
+    mdb_cursor_close(cursor);
+    return error;
+}
+
+uint32_t logos::block_store::governance_checkpoint_start(MDB_txn * txn)
+{
+    if (txn == 0) {
+        logos::transaction transaction(environment, nullptr, false);
+        return governance_checkpoint_start(transaction);
     }
+
+    logos::mdb_val data;
+    int status = mdb_get(txn, meta, logos::mdb_val(logos::uint256_union(GOVERNANCE_CHECKPOINT_KEY)), data);
+    assert (status == 0 || status == MDB_NOTFOUND);
+
+    return status ? 0 : data.uint256().number().convert_to<uint32_t>();
+}
+
+void logos::block_store::governance_checkpoint_start_put(uint32_t epoch_number, MDB_txn * txn)
+{
+    auto status (mdb_put (txn, meta, logos::mdb_val (logos::uint256_union (GOVERNANCE_CHECKPOINT_KEY)),
+                          logos::mdb_val (logos::uint256_union (epoch_number)), 0));
+    assert (status == 0);
 }
 
 void logos::block_store::version_put (MDB_txn * transaction_a, int version_a)
@@ -336,17 +487,280 @@ int logos::block_store::version_get (MDB_txn * transaction_a)
     return result;
 }
 
-void logos::block_store::clear (MDB_dbi db_a, MDB_txn * txn)
+bool logos::block_store::open_history (boost::filesystem::path const & history_path_a, int lmdb_max_dbs)
+{
+    // History left in this environment would be shadowed by the empty
+    // tables of the new one.
+    {
+        logos::transaction transaction (environment, nullptr, true);
+        MDB_dbi existing;
+        MDB_stat stat;
+        if (mdb_dbi_open (transaction, "batch_db", 0, &existing) == 0 &&
+            mdb_stat (transaction, existing, &stat) == 0 && stat.ms_entries != 0)
+        {
+            LOG_ERROR (log) << __func__ << " the database still holds block history, move it to "
+                            << history_path_a.string () << " with --history_split first";
+            return true;
+        }
+    }
+
+    bool error (false);
+    history_environment = std::make_unique<logos::mdb_env> (error, history_path_a, lmdb_max_dbs);
+    if (error)
+    {
+        LOG_ERROR (log) << __func__ << " failed to open history database " << history_path_a.string ();
+        return true;
+    }
+    environment.attach_history (history_environment.get ());
+    return false;
+}
+
+bool logos::block_store::is_history (MDB_dbi const & db_a) const
+{
+    return &db_a == &batch_db || &db_a == &request_db || &db_a == &receive_db ||
+           &db_a == &micro_block_db || &db_a == &epoch_db || &db_a == &segment_index_db;
+}
+
+MDB_txn * logos::block_store::history_txn (MDB_txn * transaction_a)
+{
+    return environment.history != nullptr ? environment.companion (transaction_a) : transaction_a;
+}
+
+MDB_txn * logos::block_store::txn_for (MDB_dbi const & db_a, MDB_txn * transaction_a)
+{
+    return is_history (db_a) ? history_txn (transaction_a) : transaction_a;
+}
+
+void logos::block_store::open_segments (boost::filesystem::path const & directory_a, uint32_t frame_size_a, size_t cached_frames_a)
+{
+    segments = std::make_unique<SegmentStore> (directory_a, frame_size_a, cached_frames_a);
+}
+
+SegmentTable logos::block_store::segment_table (MDB_dbi const & db_a) const
+{
+    if (&db_a == &request_db)
+    {
+        return SegmentTable::Request;
+    }
+    if (&db_a == &micro_block_db)
+    {
+        return SegmentTable::MicroBlock;
+    }
+    if (&db_a == &epoch_db)
+    {
+        return SegmentTable::Epoch;
+    }
+    assert (&db_a == &batch_db);
+    return SegmentTable::Batch;
+}
+
+bool logos::block_store::segment_locate (MDB_dbi const & db_a, MDB_txn * transaction_a, logos::mdb_val const & key_a, SegmentLocation & location_a)
+{
+    logos::mdb_val index;
+    if (segments == nullptr || mdb_get (history_txn (transaction_a), segment_index_db, key_a, index))
+    {
+        return true;
+    }
+    bool error (false);
+    location_a = SegmentLocation (error, index);
+    if (error)
+    {
+        LOG_ERROR (log) << __func__ << " malformed segment index entry for " << key_a.uint256 ().to_string ();
+        return true;
+    }
+    return location_a.table != segment_table (db_a);
+}
+
+bool logos::block_store::history_get (MDB_dbi const & db_a, MDB_txn * transaction_a, logos::mdb_val const & key_a, logos::mdb_val & value_a, std::vector<uint8_t> & buf_a)
+{
+    if (transaction_a == nullptr)
+    {
+        logos::transaction transaction (environment, nullptr, false);
+        auto error (history_get (db_a, transaction, key_a, value_a, buf_a));
+        // Values in the database are only valid until the transaction ends.
+        if (!error && value_a.data () != buf_a.data ())
+        {
+            auto data (reinterpret_cast<uint8_t const *> (value_a.data ()));
+            buf_a.assign (data, data + value_a.size ());
+            value_a = logos::mdb_val (buf_a.size (), buf_a.data ());
+        }
+        return error;
+    }
+
+    auto status (mdb_get (history_txn (transaction_a), db_a, key_a, value_a));
+    assert (status == 0 || status == MDB_NOTFOUND);
+    if (status == 0)
+    {
+        return false;
+    }
+
+    SegmentLocation location;
+    if (segment_locate (db_a, transaction_a, key_a, location))
+    {
+        return true;
+    }
+    if (segments->Read (location, buf_a))
+    {
+        LOG_ERROR (log) << __func__ << " failed to read archived " << key_a.uint256 ().to_string ();
+        return true;
+    }
+    value_a = logos::mdb_val (buf_a.size (), buf_a.data ());
+    return false;
+}
+
+bool logos::block_store::history_exists (MDB_dbi const & db_a, MDB_txn * transaction_a, logos::mdb_val const & key_a)
+{
+    if (transaction_a == nullptr)
+    {
+        logos::transaction transaction (environment, nullptr, false);
+        return history_exists (db_a, transaction, key_a);
+    }
+
+    logos::mdb_val junk;
+    auto status (mdb_get (history_txn (transaction_a), db_a, key_a, junk));
+    assert (status == 0 || status == MDB_NOTFOUND);
+
+    SegmentLocation location;
+    return status == 0 || !segment_locate (db_a, transaction_a, key_a, location);
+}
+
+bool logos::block_store::segment_archived_get (uint32_t & epoch_number_a, MDB_txn * transaction_a)
+{
+    logos::mdb_val value;
+    if (mdb_get (transaction_a, meta, logos::mdb_val (logos::uint256_union (SEGMENT_ARCHIVED_KEY)), value))
+    {
+        return true;
+    }
+    assert (value.size () == sizeof (epoch_number_a));
+    memcpy (&epoch_number_a, value.data (), sizeof (epoch_number_a));
+    return false;
+}
+
+void logos::block_store::segment_archived_put (uint32_t epoch_number_a, MDB_txn * transaction_a)
+{
+    auto status (mdb_put (transaction_a, meta, logos::mdb_val (logos::uint256_union (SEGMENT_ARCHIVED_KEY)),
+                          logos::mdb_val (epoch_number_a), 0));
+    assert (status == 0);
+}
+
+void logos::block_store::segment_deferred_get (std::vector<BlockHash> & hashes_a, MDB_txn * transaction_a)
+{
+    hashes_a.clear ();
+    logos::mdb_val value;
+    if (mdb_get (transaction_a, meta, logos::mdb_val (logos::uint256_union (SEGMENT_DEFERRED_KEY)), value))
+    {
+        return;
+    }
+    assert (value.size () % sizeof (BlockHash) == 0);
+    hashes_a.resize (value.size () / sizeof (BlockHash));
+    memcpy (hashes_a.data (), value.data (), hashes_a.size () * sizeof (BlockHash));
+}
+
+void logos::block_store::segment_deferred_put (std::vector<BlockHash> const & hashes_a, MDB_txn * transaction_a)
+{
+    logos::uint256_union key_l (SEGMENT_DEFERRED_KEY);
+    logos::mdb_val key (key_l);
+    auto status (hashes_a.empty ()
+                 ? mdb_del (transaction_a, meta, key, nullptr)
+                 : mdb_put (transaction_a, meta, key,
+                            logos::mdb_val (hashes_a.size () * sizeof (BlockHash), const_cast<BlockHash *> (hashes_a.data ())), 0));
+    assert (status == 0 || status == MDB_NOTFOUND);
+}
+
+bool logos::block_store::copy_with_compaction (boost::filesystem::path const & destination_a)
+{
+    return mdb_env_copy2 (environment.environment, destination_a.string ().c_str (), MDB_CP_COMPACT) != 0;
+}
+
+bool logos::block_store::split_history (boost::filesystem::path const & history_path_a)
+{
+    if (environment.history != nullptr)
+    {
+        LOG_ERROR (log) << __func__ << " block history is already split";
+        return true;
+    }
+    if (boost::filesystem::exists (history_path_a))
+    {
+        LOG_ERROR (log) << __func__ << " " << history_path_a.string () << " already exists";
+        return true;
+    }
+
+    bool error (false);
+    logos::mdb_env history (error, history_path_a);
+    if (error)
+    {
+        LOG_ERROR (log) << __func__ << " failed to create " << history_path_a.string ();
+        return true;
+    }
+
+    const std::vector<std::pair<const char *, MDB_dbi *>> tables = {
+        {"batch_db",       &batch_db},
+        {"request_db",     &request_db},
+        {"receive_db",     &receive_db},
+        {"micro_block_db", &micro_block_db},
+        {"epoch_db",       &epoch_db},
+        {"segment_index_db", &segment_index_db},
+    };
+
+    {
+        // Keys are copied in order, so they are appended to the new tables
+        // without searching them, in batches to bound the dirty pages held
+        // by a write transaction.
+        logos::transaction read (environment, nullptr, false);
+        for (auto & table : tables)
+        {
+            logos::store_iterator i (read, *table.second);
+            uint64_t copied (0);
+            do
+            {
+                logos::transaction write (history, nullptr, true);
+                MDB_dbi target;
+                error |= mdb_dbi_open (write, table.first, MDB_CREATE, &target) != 0;
+                for (size_t n = 0; !error && n < HISTORY_SPLIT_BATCH && i != logos::store_iterator (nullptr); ++n, ++i)
+                {
+                    error |= mdb_put (write, target, i->first, i->second, MDB_APPEND) != 0;
+                    ++copied;
+                }
+            } while (!error && i != logos::store_iterator (nullptr));
+
+            if (error)
+            {
+                LOG_ERROR (log) << __func__ << " failed to copy " << table.first << ", "
+                                << history_path_a.string () << " is incomplete and should be removed";
+                return true;
+            }
+            LOG_INFO (log) << __func__ << " copied " << copied << " entries of " << table.first;
+        }
+    }
+
+    // The copy is durable, the originals can go. Their pages are reused
+    // by the hot tables, the file only shrinks when compacted.
+    logos::transaction write (environment, nullptr, true);
+    for (auto & table : tables)
+    {
+        error |= mdb_drop (write, *table.second, 1) != 0;
+    }
+    error |= history_split_put (write);
+    return error;
+}
+
+bool logos::block_store::history_split_put (MDB_txn * transaction_a)
+{
+    return mdb_put (transaction_a, meta, logos::mdb_val (logos::uint256_union (HISTORY_SPLIT_KEY)),
+                    logos::mdb_val (uint8_t (1)), 0) != 0;
+}
+
+void logos::block_store::clear (MDB_dbi const & db_a, MDB_txn * txn)
 {
     int status = 0;
     if(txn == 0)
     {
         logos::transaction transaction (environment, nullptr, true);
-        status  = mdb_drop (transaction, db_a, 0);
+        status  = mdb_drop (txn_for (db_a, transaction), db_a, 0);
     }
     else
     {
-        status = mdb_drop(txn, db_a, 0);
+        status = mdb_drop(txn_for (db_a, txn), db_a, 0);
     }
     assert (status == 0);
 }
@@ -397,7 +811,7 @@ bool logos::block_store::request_block_put(ApprovedRB const &block, const BlockH
 
     std::vector<uint8_t> buf;
     auto value(block.to_mdb_val(buf));
-    auto status(mdb_put(transaction, batch_db, logos::mdb_val(hash),
+    auto status(mdb_put(history_txn(transaction), batch_db, logos::mdb_val(hash),
                         value, 0));
     assert(status == 0);
 
@@ -416,7 +830,8 @@ bool logos::block_store::request_get(const BlockHash & hash, std::shared_ptr<Req
     LOG_TRACE(log) << __func__ << " key " << hash.to_string();
 
     mdb_val val;
-    if(mdb_get(transaction, request_db, mdb_val(hash), val))
+    std::vector<uint8_t> buf;
+    if(history_get(request_db, transaction, mdb_val(hash), val, buf))
     {
         LOG_TRACE(log) << __func__ << " mdb_get failed";
         return true;
@@ -435,7 +850,7 @@ bool logos::block_store::request_put(const Request & request, MDB_txn * transact
     LOG_TRACE(log) << __func__ << " key " << hash.to_string();
 
     std::vector<uint8_t> buf;
-    auto status(mdb_put(transaction, request_db, logos::mdb_val(request.GetHash()),
+    auto status(mdb_put(history_txn(transaction), request_db, logos::mdb_val(request.GetHash()),
                         request.ToDatabase(buf), 0));
 
     assert(status == 0);
@@ -451,20 +866,7 @@ bool logos::block_store::request_exists(const BlockHash & hash, MDB_txn* txn)
 {
     LOG_TRACE(log) << __func__ << " key " << hash.to_string();
 
-    logos::mdb_val junk;
-    int status = 0;
-    if(!txn)
-    {
-        logos::transaction transaction(environment, nullptr, false);
-        status = mdb_get (transaction, request_db, logos::mdb_val (hash), junk);
-    }
-    else
-    {
-        status = mdb_get (txn, request_db, logos::mdb_val (hash), junk);
-    }
-    assert (status == 0 || status == MDB_NOTFOUND);
-
-    return status == 0;
+    return history_exists (request_db, txn, logos::mdb_val (hash));
 }
 
 bool logos::block_store::request_block_get(const BlockHash & hash, ApprovedRB & block)
@@ -479,12 +881,10 @@ bool logos::block_store::request_block_get(const BlockHash &hash, ApprovedRB &bl
 
     mdb_val value;
     mdb_val key(hash);
-
-    auto status (mdb_get (transaction, batch_db, key, value));
-    assert (status == 0 || status == MDB_NOTFOUND);
+    std::vector<uint8_t> buf;
 
     bool error = false;
-    if (status == MDB_NOTFOUND)
+    if (history_get (batch_db, transaction, key, value, buf))
     {
         LOG_TRACE(log) << __func__ << " MDB_NOTFOUND";
         error = true;
@@ -521,15 +921,7 @@ bool logos::block_store::request_block_get(const BlockHash &hash, ApprovedRB &bl
 
 bool logos::block_store::request_block_exists (const ApprovedRB & block)
 {
-    auto exists (true);
-    logos::mdb_val junk;
-    transaction transaction_a(environment, nullptr, false);
-
-    auto status (mdb_get (transaction_a, batch_db, logos::mdb_val (block.Hash()), junk));
-    assert (status == 0 || status == MDB_NOTFOUND);
-    exists = status == 0;
-
-    return exists;
+    return history_exists (batch_db, nullptr, logos::mdb_val (block.Hash()));
 }
 
 void
@@ -607,7 +999,9 @@ bool logos::block_store::consensus_block_update_next(const BlockHash & hash, con
         trace_and_halt();
     }
 
-    auto status(mdb_get (transaction, db, key, value));
+    // Archived blocks are immutable, they are only archived once their
+    // successors are stored.
+    auto status(mdb_get (history_txn (transaction), db, key, value));
     if (status == MDB_NOTFOUND)
     {
         LOG_TRACE(log) << __func__ << " MDB_NOTFOUND";
@@ -631,7 +1025,7 @@ bool logos::block_store::consensus_block_update_next(const BlockHash & hash, con
     std::vector<uint8_t> buf(data_size);
     mdb_val value_buf(data_size, buf.data());
     UpdateNext(value, value_buf, next);
-    status = mdb_put(transaction, db, key, value_buf, 0);
+    status = mdb_put(history_txn (transaction), db, key, value_buf, 0);
     if(status != 0)
     {
         LOG_FATAL(log) << __func__ << " failed to put consensus block "
@@ -647,11 +1041,11 @@ bool logos::block_store::get(MDB_dbi &db, const mdb_val &key, mdb_val &value, MD
     if (tx == 0)
     {
         logos::transaction transaction(environment, nullptr, false);
-        status = mdb_get(transaction, db, key, value);
+        status = mdb_get(txn_for(db, transaction), db, key, value);
     }
     else
     {
-        status = mdb_get(tx, db, key, value);
+        status = mdb_get(txn_for(db, tx), db, key, value);
     }
     if( ! (status == 0 || status == MDB_NOTFOUND))
     {
@@ -668,7 +1062,7 @@ bool logos::block_store::micro_block_put(ApprovedMB const &block, MDB_txn *trans
     LOG_DEBUG(log) << __func__ << " key " << hash.to_string();
 
     std::vector<uint8_t> buf;
-    auto status(mdb_put(transaction, micro_block_db, mdb_val(hash), block.to_mdb_val(buf), 0));
+    auto status(mdb_put(history_txn(transaction), micro_block_db, mdb_val(hash), block.to_mdb_val(buf), 0));
     assert(status == 0);
     return status != 0;
 }
@@ -678,7 +1072,8 @@ bool logos::block_store::micro_block_get(const BlockHash &hash, ApprovedMB &bloc
     LOG_TRACE(log) << __func__ << " key " << hash.to_string();
 
     mdb_val val;
-    if(get(micro_block_db, mdb_val(hash), val, transaction))
+    std::vector<uint8_t> buf;
+    if(history_get(micro_block_db, transaction, mdb_val(hash), val, buf))
     {
         return true;
     }
@@ -724,15 +1119,7 @@ bool logos::block_store::micro_block_exists(const BlockHash &hash, MDB_txn *tran
 
 bool logos::block_store::micro_block_exists (const ApprovedMB & block)
 {
-    auto exists (true);
-    logos::mdb_val junk;
-    transaction transaction_a(environment, nullptr, false);
-
-    auto status (mdb_get (transaction_a, micro_block_db, logos::mdb_val (block.Hash()), junk));
-    assert (status == 0 || status == MDB_NOTFOUND);
-    exists = status == 0;
-
-    return exists;
+    return history_exists (micro_block_db, nullptr, logos::mdb_val (block.Hash()));
 }
 
 bool logos::block_store::epoch_put(ApprovedEB const &block, MDB_txn *transaction)
@@ -741,7 +1128,7 @@ bool logos::block_store::epoch_put(ApprovedEB const &block, MDB_txn *transaction
     LOG_DEBUG(log) << "epoch_block_put key " << hash.to_string();
 
     std::vector<uint8_t> buf;
-    auto status(mdb_put(transaction, epoch_db, mdb_val(hash), block.to_mdb_val(buf), 0));
+    auto status(mdb_put(history_txn(transaction), epoch_db, mdb_val(hash), block.to_mdb_val(buf), 0));
 
     assert(status == 0);
     return status != 0;
@@ -752,7 +1139,8 @@ bool logos::block_store::epoch_get(const BlockHash &hash, ApprovedEB &block, MDB
     LOG_TRACE(log) << "epoch_block_get key " << hash.to_string();
 
     mdb_val val;
-    if(get(epoch_db, mdb_val(hash), val, transaction))
+    std::vector<uint8_t> buf;
+    if(history_get(epoch_db, transaction, mdb_val(hash), val, buf))
     {
         return true;
     }
@@ -818,15 +1206,7 @@ bool logos::block_store::epoch_tip_get(Tip &tip, MDB_txn *t)
 
 bool logos::block_store::epoch_exists (const ApprovedEB & block)
 {
-    auto exists(true);
-    logos::mdb_val junk;
-    transaction transaction_a(environment, nullptr, false);
-
-    auto status(mdb_get(transaction_a, epoch_db, logos::mdb_val(block.Hash()), junk));
-    assert (status == 0 || status == MDB_NOTFOUND);
-    exists = status == 0;
-
-    return exists;
+    return history_exists (epoch_db, nullptr, logos::mdb_val (block.Hash()));
 }
 
 bool logos::block_store::epoch_exists (const BlockHash &hash, MDB_txn *transaction)
@@ -1283,7 +1663,7 @@ bool logos::block_store::receive_put(const BlockHash & hash, const ReceiveBlock
     LOG_TRACE(log) << __func__ << " key " << hash.to_string();
 
     std::vector<uint8_t> buf;
-    auto status(mdb_put(transaction, receive_db, logos::mdb_val(hash),
+    auto status(mdb_put(history_txn(transaction), receive_db, logos::mdb_val(hash),
             block.to_mdb_val(buf), 0));
 
     assert(status == 0);
@@ -1296,7 +1676,7 @@ bool logos::block_store::receive_get (const BlockHash & hash, ReceiveBlock & blo
 
     logos::mdb_val value;
 
-    auto status (mdb_get (transaction, receive_db, mdb_val(hash), value));
+    auto status (mdb_get (history_txn (transaction), receive_db, mdb_val(hash), value));
     assert (status == 0 || status == MDB_NOTFOUND);
     bool error = false;
     if (status == MDB_NOTFOUND)
@@ -1317,7 +1697,7 @@ bool logos::block_store::receive_exists(const BlockHash & hash)
     logos::mdb_val junk;
     logos::transaction transaction(environment, nullptr, false);
 
-    auto status(mdb_get(transaction, receive_db, logos::mdb_val(hash), junk));
+    auto status(mdb_get(history_txn(transaction), receive_db, logos::mdb_val(hash), junk));
     assert(status == 0 || status == MDB_NOTFOUND);
 
     return status == 0;
@@ -1371,7 +1751,7 @@ bool logos::block_store::request_block_update_prev(const BlockHash & hash, const
     mdb_val value;
     mdb_val key(hash);
 
-    auto status(mdb_get (transaction, batch_db, key, value));
+    auto status(mdb_get (history_txn (transaction), batch_db, key, value));
     if (status == MDB_NOTFOUND)
     {
         LOG_TRACE(log) << __func__ << " MDB_NOTFOUND";
@@ -1388,7 +1768,7 @@ bool logos::block_store::request_block_update_prev(const BlockHash & hash, const
     std::vector<uint8_t> buf(data_size);
     mdb_val value_buf(data_size, buf.data());
     update_PostCommittedRequestBlock_prev_field(value, value_buf, prev);
-    status = mdb_put(transaction, batch_db, key, value_buf, 0);
+    status = mdb_put(history_txn (transaction), batch_db, key, value_buf, 0);
     if(status != 0)
     {
         LOG_FATAL(log) << __func__ << " failed to put consensus block "
@@ -1413,36 +1793,30 @@ uint32_t logos::block_store::consensus_block_get_raw(const BlockHash & hash,
 
     mdb_val value;
     mdb_val key(hash);
-    MDB_dbi db = 0; //typedef unsigned int    MDB_dbi, maybe use a naked pointer?
+    MDB_dbi * db = nullptr;
     logos::transaction transaction(environment, nullptr, false);
 
     switch(type){
     case ConsensusType::Request:
-        db = batch_db;
+        db = &batch_db;
         break;
     case ConsensusType::MicroBlock:
-        db = micro_block_db;
+        db = &micro_block_db;
         break;
     case ConsensusType::Epoch:
-        db = epoch_db;
+        db = &epoch_db;
         break;
     default:
         LOG_FATAL(log) << __func__ << " wrong consensus type " << (uint)type;
         trace_and_halt();
     }
 
-    auto status(mdb_get (transaction, db, key, value));
-    if (status == MDB_NOTFOUND)
+    std::vector<uint8_t> archived;
+    if (history_get (*db, transaction, key, value, archived))
     {
         LOG_TRACE(log) << __func__ << " MDB_NOTFOUND";
         return 0;
     }
-    else if(status != 0)
-    {
-        LOG_FATAL(log) << __func__ << " error when getting a consensus block "
-                << ConsensusToName(type);
-        trace_and_halt();
-    }
 
     uint32_t block_size = value.size();
     buf.resize(reserve + block_size);
@@ -1617,6 +1991,30 @@ bool logos::block_store::thawing_del(
     return mdb_del(txn, thawing_db, logos::mdb_val(account), funds.to_mdb_val(buf));
 }
 
+bool logos::block_store::thawing_summary_get(
+        AccountAddress const & account,
+        ThawingSummary & summary,
+        MDB_txn* txn)
+{
+    return get(thawing_summary_db, logos::mdb_val(account), summary, txn);
+}
+
+bool logos::block_store::thawing_summary_put(
+        AccountAddress const & account,
+        ThawingSummary const & summary,
+        MDB_txn* txn)
+{
+    auto error = put(thawing_summary_db, logos::mdb_val(account), summary, txn);
+    if(error)
+    {
+        LOG_FATAL(log) << "block_store::thawing_summary_put - "
+            << "error storing ThawingSummary. account = "
+            << account.to_string();
+        trace_and_halt();
+    }
+    return error;
+}
+
 bool logos::block_store::liability_get(
         LiabilityHash const & hash,
         Liability & l,
@@ -1746,6 +2144,29 @@ bool logos::block_store::secondary_liability_del(
     return error;
 }
 
+bool logos::block_store::secondary_liability_summary_get(
+        AccountAddress const & source,
+        SecondaryLiabilitySummary & summary,
+        MDB_txn* txn)
+{
+    return get(secondary_liabilities_summary_db, logos::mdb_val(source), summary, txn);
+}
+
+bool logos::block_store::secondary_liability_summary_put(
+        AccountAddress const & source,
+        SecondaryLiabilitySummary const & summary,
+        MDB_txn* txn)
+{
+    auto error = put(secondary_liabilities_summary_db, logos::mdb_val(source), summary, txn);
+    if(error)
+    {
+        LOG_FATAL(log) << "block_store::secondary_liability_summary_put - "
+            << "error storing summary. source = " << source.to_string();
+        trace_and_halt();
+    }
+    return error;
+}
+
 bool logos::block_store::voting_power_get(
         AccountAddress const & rep,
         VotingPowerInfo & info,
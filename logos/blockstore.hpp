@@ -1,9 +1,11 @@
 #pragma once
 
+#include <logos/archive/segment_store.hpp>
 #include <logos/bootstrap/tips.hpp>
 #include <logos/consensus/messages/messages.hpp>
 #include <logos/consensus/messages/common.hpp>
 #include <logos/microblock/microblock.hpp>
+#include <logos/microblock/microblock_accumulator.hpp>
 #include <logos/request/utility.hpp>
 #include <logos/token/account.hpp>
 #include <logos/epoch/epoch.hpp>
@@ -15,6 +17,7 @@
 #include <logos/staking/thawing_funds.hpp>
 #include <logos/staking/liability.hpp>
 #include <logos/staking/voting_power.hpp>
+#include <logos/governance/governance_checkpoint.hpp>
 #include <logos/rewards/epoch_rewards.hpp>
 
 namespace logos
@@ -65,7 +68,10 @@ class block_store
 
 public:
 
-    block_store (bool &, boost::filesystem::path const &, int lmdb_max_dbs = 128);
+    /// @param history_path if not empty, the block, request and receive
+    /// history tables are kept in a separate environment at this path
+    block_store (bool &, boost::filesystem::path const &, int lmdb_max_dbs = 128,
+                 boost::filesystem::path const & history_path = boost::filesystem::path ());
 
     template<typename T> bool put(MDB_dbi&, const mdb_val &, const T &, MDB_txn *);
     template<typename T> void put(MDB_dbi& db, const Byte32Array &key_32b, const T &t, MDB_txn *tx)
@@ -128,7 +134,8 @@ public:
         LOG_TRACE(log) << __func__ << " key " << hash.to_string();
 
         mdb_val val;
-        if(mdb_get(transaction, request_db, mdb_val(hash), val))
+        std::vector<uint8_t> buf;
+        if(history_get(request_db, transaction, mdb_val(hash), val, buf))
         {
             LOG_TRACE(log) << __func__ << " mdb_get failed";
             return true;
@@ -333,6 +340,16 @@ public:
             ThawingFunds const & funds,
             MDB_txn* txn);
 
+    bool thawing_summary_get(
+            AccountAddress const & account,
+            ThawingSummary & summary,
+            MDB_txn* txn);
+
+    bool thawing_summary_put(
+            AccountAddress const & account,
+            ThawingSummary const & summary,
+            MDB_txn* txn);
+
     bool liability_get(
             LiabilityHash const & hash,
             Liability & l,
@@ -356,6 +373,16 @@ public:
             LiabilityHash const & hash,
             MDB_txn* txn);
 
+    bool secondary_liability_summary_get(
+            AccountAddress const & source,
+            SecondaryLiabilitySummary & summary,
+            MDB_txn* txn);
+
+    bool secondary_liability_summary_put(
+            AccountAddress const & source,
+            SecondaryLiabilitySummary const & summary,
+            MDB_txn* txn);
+
     bool voting_power_get(
             AccountAddress const & rep,
             VotingPowerInfo& info,
@@ -386,6 +413,32 @@ public:
     
     bool liability_del(LiabilityHash const & hash, MDB_txn* txn);
 
+    bool governance_checkpoint_put(
+            AccountAddress const & account,
+            uint32_t epoch_number,
+            GovernanceCheckpoint const & checkpoint,
+            MDB_txn* txn);
+
+    /// Get the account's latest checkpoint preceding an epoch
+    /// @param account account whose checkpoint to get [in]
+    /// @param before_epoch exclusive upper bound of the checkpoint's epoch [in]
+    /// @param epoch_number epoch of the checkpoint [out]
+    /// @param checkpoint the checkpoint [out]
+    /// @param txn transaction [in]
+    /// @returns true if the account has no checkpoint before before_epoch
+    bool governance_checkpoint_get_prior(
+            AccountAddress const & account,
+            uint32_t before_epoch,
+            uint32_t & epoch_number,
+            GovernanceCheckpoint & checkpoint,
+            MDB_txn* txn);
+
+    /// Checkpoints are complete from this epoch on. It is non-zero for
+    /// stores that hold governance requests applied before checkpoints
+    /// were kept.
+    uint32_t governance_checkpoint_start(MDB_txn* txn = 0);
+    void governance_checkpoint_start_put(uint32_t epoch_number, MDB_txn* txn);
+
     /* @param db - db to iterate
      * @param start - key to start iteration on
      * @param operation - function to execute for each record in iteration
@@ -408,7 +461,59 @@ public:
     void version_put (MDB_txn *, int);
     int version_get (MDB_txn *);
 
-    void clear (MDB_dbi, MDB_txn *t=0);
+    void clear (MDB_dbi const &, MDB_txn *t=0);
+
+    /// True for the tables kept in the history environment when it's split.
+    bool is_history (MDB_dbi const &) const;
+
+    /// The transaction to access history tables through: the companion
+    /// of transaction in the history environment if it's split, else
+    /// transaction itself.
+    MDB_txn * history_txn (MDB_txn * transaction);
+
+    /// The transaction to access the given table through.
+    MDB_txn * txn_for (MDB_dbi const &, MDB_txn * transaction);
+
+    /// Read archived blocks from segment files in directory.
+    void open_segments (boost::filesystem::path const & directory, uint32_t frame_size, size_t cached_frames);
+
+    /// Get a batch, request, micro block or epoch block record, from its
+    /// table or, once archived, from its segment.
+    /// @param transaction may be nullptr
+    /// @param value [out] the record, it points into buf if the record is
+    /// archived or transaction is nullptr
+    /// @returns true if not found
+    bool history_get (MDB_dbi const & db, MDB_txn * transaction, mdb_val const & key, mdb_val & value, std::vector<uint8_t> & buf);
+
+    /// @returns true if the record is in its table or archived
+    bool history_exists (MDB_dbi const & db, MDB_txn * transaction, mdb_val const & key);
+
+    /// The segment index entry of an archived record of db.
+    /// @returns true if the record isn't archived
+    bool segment_locate (MDB_dbi const & db, MDB_txn * transaction, mdb_val const & key, SegmentLocation & location);
+
+    SegmentTable segment_table (MDB_dbi const & db) const;
+
+    /// The last epoch whose blocks were moved to segments.
+    /// @returns true if no epoch was archived
+    bool segment_archived_get (uint32_t & epoch_number, MDB_txn * transaction);
+    void segment_archived_put (uint32_t epoch_number, MDB_txn * transaction);
+
+    /// Request blocks of archived epochs left in the database as they
+    /// were still being linked, see SegmentArchiver.
+    void segment_deferred_get (std::vector<BlockHash> & hashes, MDB_txn * transaction);
+    void segment_deferred_put (std::vector<BlockHash> const & hashes, MDB_txn * transaction);
+
+    /// Write a compacted copy of the database, without its history tables
+    /// if they are split, to destination.
+    /// @returns true on error
+    bool copy_with_compaction (boost::filesystem::path const & destination);
+
+    /// Move the history tables of a store opened without a history path
+    /// into a new environment at history_path, and drop them from this
+    /// one. The store must be reopened with history_path afterwards.
+    /// @returns true on error
+    bool split_history (boost::filesystem::path const & history_path);
 
     // The lowest ranked candidate in leading_candidates_db. Kept up to date
     std::pair<AccountAddress, CandidateInfo> min_leading_candidate;
@@ -418,6 +523,15 @@ public:
 
     logos::mdb_env environment;
 
+    /// Holds the history tables if they're split from environment.
+    std::unique_ptr<logos::mdb_env> history_environment;
+
+    /// Archived blocks, nullptr unless open_segments was called.
+    std::unique_ptr<SegmentStore> segments;
+
+    /// Request blocks persisted since the last micro block.
+    MicroBlockAccumulator micro_accumulator;
+
     /**
      * Maps block hash to Request Block
      * logos::block_hash -> RequestBlock
@@ -483,6 +597,13 @@ public:
      */
     MDB_dbi epoch_tip_db;
 
+    /**
+     * Maps the hash of a block or request moved to a segment file to its
+     * location in the segment.
+     * logos::block_hash -> SegmentLocation
+     */
+    MDB_dbi segment_index_db;
+
     /**
     * Token User Statuses
     * (Untethered accounts only)
@@ -598,6 +719,12 @@ public:
      */
     MDB_dbi thawing_db;
 
+    /**
+     * Aggregate of thawing funds per account
+     * logos::account -> ThawingSummary
+     */
+    MDB_dbi thawing_summary_db;
+
     /**
      * Liabilities
      * LiabilityHash -> Liability
@@ -620,7 +747,28 @@ public:
      */
     MDB_dbi secondary_liabilities_db;
 
+    /**
+     * Aggregate of secondary liabilities per account
+     * Account is source of liabilities
+     * logos::account -> SecondaryLiabilitySummary
+     */
+    MDB_dbi secondary_liabilities_summary_db;
+
+    /**
+     * Governance checkpoints
+     * Rep and proxy state set by an account's last such request of an epoch
+     * logos::account, epoch number (big endian) -> GovernanceCheckpoint
+     */
+    MDB_dbi governance_checkpoint_db;
+
     Log log;
+
+private:
+
+    bool open_history (boost::filesystem::path const & history_path, int lmdb_max_dbs);
+    /// Record in meta that the history tables are kept apart, so the store
+    /// isn't opened without them.
+    bool history_split_put (MDB_txn * transaction);
 };
 
 /**
@@ -128,9 +128,6 @@ namespace Bootstrap
     ////////////////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////
 
-    using LeadingFieldsStream =
-            boost::iostreams::stream_buffer<boost::iostreams::basic_array_sink<uint8_t>>;
-
     //return total message size including header
     uint32_t PullResponseSerializedLeadingFields(ConsensusType ct,
             PullResponseStatus status,
@@ -142,7 +139,7 @@ namespace Bootstrap
             buf.resize(PullResponseReserveSize);
         }
 
-        LeadingFieldsStream stream(buf.data(), PullResponseReserveSize);
+        logos::span_writer stream(buf.data(), PullResponseReserveSize);
         uint32_t payload_size = sizeof(status) + block_size;
         MessageHeader header(logos_version,
                 MessageType::PullResponse,
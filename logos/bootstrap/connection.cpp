@@ -156,7 +156,7 @@ namespace Bootstrap
                 {
                     LOG_TRACE(log) << "Socket::AsyncReceive received header data";
                     assert (size_a == MessageHeader::WireSize);
-                    logos::bufferstream stream (header_buf.data (), size_a);
+                    logos::span_reader stream (header_buf.data (), size_a);
                     bool error = false;
                     MessageHeader header(error, stream);
                     if(error || ! header.Validate())
@@ -295,7 +295,7 @@ namespace Bootstrap
                 LOG_TRACE(log) << "bootstrap_server::"<<__func__ <<" data:" << stream.str ();
             }
 #endif
-            logos::bufferstream stream (buf, header.payload_size);
+            logos::span_reader stream (buf, header.payload_size);
 
             switch (header.type)
             {
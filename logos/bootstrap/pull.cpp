@@ -186,17 +186,22 @@ namespace Bootstrap
             //TODO Peng: move my_tips forward
             // check MB in DB
 
-            state = PullerState::Batch;
-            if(!working_epoch.two_mbps)
+            auto & working_mbp = working_epoch.two_mbps?
+                                 working_epoch.next_mbp : working_epoch.cur_mbp;
+            if(working_mbp.mb != nullptr)
             {
-                assert(working_epoch.cur_mbp.mb == nullptr);
-                working_epoch.cur_mbp.mb = block;
-            }
-            else
-            {
-                assert(working_epoch.next_mbp.mb == nullptr);
-                working_epoch.next_mbp.mb = block;
+                working_mbp.checkpoints.push_back(working_mbp.mb);
             }
+            working_mbp.mb = block;
+
+            /*
+             * pull more micro blocks of the epoch before their request blocks,
+             * so that long delegate chains are split at their request tips
+             */
+            bool pull_ahead = !block->last_micro_block &&
+                    working_mbp.checkpoints.size() + 1 < MAX_MICRO_CHECKPOINTS &&
+                    block->CreateTip() < others_tips.mb;
+            state = pull_ahead ? PullerState::Micro : PullerState::Batch;
 
             LOG_TRACE(log) << "Puller::"<<__func__ << MBRequestTips_to_string(*block);
 
@@ -245,8 +250,14 @@ namespace Bootstrap
              *
              * note the definition of tip changed from "tip in DB" to "tip in DB or Cache",
              * to ease the pull generation, we still keep the logical order, i.e. BSB -> MB -> EB
+             *
+             * with a micro block, the ranges of a delegate chain arrive out of
+             * order, my bsb tips move to the micro block's once all are received
              */
-            UpdateMyBSBTip(block);
+            if(state != PullerState::Batch)
+            {
+                UpdateMyBSBTip(block);
+            }
 
             if(pull_done)
             {
@@ -259,6 +270,10 @@ namespace Bootstrap
 
                 if(working_mbp.bsb_targets.empty())//all BSBs and MB (if have one) in block_cache now
                 {
+                    if(working_mbp.mb != nullptr)
+                    {
+                        UpdateMyBSBTips(working_mbp);
+                    }
                     //check before go to next micro period
                     CheckMicroProgressAndCreateMorePulls();
                 }
@@ -346,7 +361,7 @@ namespace Bootstrap
                 bool mb_processed = !this_ptr->block_cache.IsBlockCached(digest);
                 if (mb_processed)
                 {
-                    this_ptr->UpdateMyMBTip(this_ptr->working_epoch.cur_mbp.mb);
+                    this_ptr->UpdateMyMBTip(this_ptr->working_epoch.cur_mbp);
                     this_ptr->working_epoch.cur_mbp = this_ptr->working_epoch.next_mbp;
                     this_ptr->working_epoch.two_mbps = false;
                     this_ptr->working_epoch.next_mbp.Clean();
@@ -407,7 +422,7 @@ namespace Bootstrap
             bool mb_processed = !block_cache.IsBlockCached(digest);
             if(mb_processed)
             {
-                UpdateMyMBTip(working_epoch.cur_mbp.mb);
+                UpdateMyMBTip(working_epoch.cur_mbp);
                 if(working_epoch.cur_mbp.mb->last_micro_block)
                 {
                     if(working_epoch.eb != nullptr)
@@ -524,11 +539,28 @@ namespace Bootstrap
         }
     }
 
-    void Puller::UpdateMyMBTip(MBPtr block)
+    void Puller::UpdateMyBSBTips(const MicroPeriod & mbp)
     {
         LOG_TRACE(log) << "Puller::"<<__func__;
-        assert(my_tips.mb.digest == block->previous);
-        my_tips.mb = block->CreateTip();
+        for(uint i = 0; i < NUM_DELEGATES; ++i)
+        {
+            if(my_tips.bsb_vec[i] < mbp.mb->tips[i])
+            {
+                my_tips.bsb_vec[i] = mbp.mb->tips[i];
+                if(! (my_tips.bsb_vec[i] < my_tips.bsb_vec_new_epoch[i]))
+                {
+                    my_tips.bsb_vec_new_epoch[i] = Tip();
+                }
+            }
+        }
+    }
+
+    void Puller::UpdateMyMBTip(const MicroPeriod & mbp)
+    {
+        LOG_TRACE(log) << "Puller::"<<__func__;
+        auto & first = mbp.checkpoints.empty() ? mbp.mb : mbp.checkpoints.front();
+        assert(my_tips.mb.digest == first->previous);
+        my_tips.mb = mbp.mb->CreateTip();
     }
 
     void Puller::UpdateMyEBTip(EBPtr block)
@@ -567,8 +599,10 @@ namespace Bootstrap
             {
                 assert(working_epoch.cur_mbp.bsb_targets.empty());
 
-                auto mb_tip = working_epoch.two_mbps?
-                        working_epoch.cur_mbp.mb->CreateTip():my_tips.mb;
+                auto & working_mbp = working_epoch.two_mbps?
+                                     working_epoch.next_mbp : working_epoch.cur_mbp;
+                auto mb_tip = working_mbp.mb != nullptr ? working_mbp.mb->CreateTip() :
+                        working_epoch.two_mbps ? working_epoch.cur_mbp.mb->CreateTip() : my_tips.mb;
 
                 if(mb_tip < others_tips.mb)
                 {
@@ -603,18 +637,26 @@ namespace Bootstrap
 //                                (working_mbp.mb->sequence == 0)));
                 assert(working_mbp.bsb_targets.empty());
 
+                // one pull per range of each delegate chain between checkpoints
+                auto micro_blocks(working_mbp.checkpoints);
+                micro_blocks.push_back(working_mbp.mb);
                 for(uint i = 0; i < NUM_DELEGATES; ++i)
                 {
-                    if(my_tips.bsb_vec[i] < working_mbp.mb->tips[i])
+                    auto from(my_tips.bsb_vec[i]);
+                    for(auto & mb : micro_blocks)
                     {
-                        waiting_pulls.push_back(std::make_shared<PullRequest>(
-                                ConsensusType::Request,
-                                working_epoch.epoch_num,
-                                my_tips.bsb_vec[i].digest,
-                                working_mbp.mb->tips[i].digest));
-
-                        working_mbp.bsb_targets.insert(working_mbp.mb->tips[i].digest);
-                        added_pulls = true;
+                        if(from < mb->tips[i])
+                        {
+                            waiting_pulls.push_back(std::make_shared<PullRequest>(
+                                    ConsensusType::Request,
+                                    working_epoch.epoch_num,
+                                    from.digest,
+                                    mb->tips[i].digest));
+
+                            working_mbp.bsb_targets.insert(mb->tips[i].digest);
+                            from = mb->tips[i];
+                            added_pulls = true;
+                        }
                     }
                 }
                 if(!added_pulls)
@@ -713,6 +755,27 @@ namespace Bootstrap
 
 #ifndef CONSENSUS_BLOCK_DB_RAW
 
+    /// Serialize the block after the response's leading fields, growing
+    /// buf once to its exact size.
+    /// @returns the block's size, or 0 with buf cleared if it doesn't
+    /// serialize to its WireSize, so no block is sent
+    template<typename Block>
+    uint32_t AppendBlock(const Block & block, std::vector<uint8_t> & buf)
+    {
+        auto size = block.WireSize(true, true);
+        if(logos::serialize_exact(buf, size, [&block](logos::stream & stream) {
+            block.Serialize(stream, true, true);
+        }))
+        {
+            Log log;
+            LOG_ERROR(log) << "PullRequestHandler::AppendBlock failed to serialize block "
+                           << block.Hash().to_string() << " of size " << size;
+            buf.clear();
+            return 0;
+        }
+        return size;
+    }
+
     PullRequestHandler::PullRequestHandler(PullRequest request, Store & store)
     : request(request)
     , store(store)
@@ -751,8 +814,7 @@ namespace Bootstrap
             {
                 next = block.next;
                 buf.resize(PullResponseReserveSize);
-                logos::vectorstream stream(buf);
-                return block.Serialize(stream, true, true);
+                return AppendBlock(block, buf);
             }
         }
         case ConsensusType::MicroBlock:
@@ -767,8 +829,7 @@ namespace Bootstrap
             {
                 next = block.next;
                 buf.resize(PullResponseReserveSize);
-                logos::vectorstream stream(buf);
-                return block.Serialize(stream, true, true);
+                return AppendBlock(block, buf);
             }
         }
         case ConsensusType::Epoch:
@@ -783,8 +844,7 @@ namespace Bootstrap
             {
                 next = block.next;
                 buf.resize(PullResponseReserveSize);
-                logos::vectorstream stream(buf);
-                return block.Serialize(stream, true, true);
+                return AppendBlock(block, buf);
             }
         }
         default:
@@ -20,6 +20,7 @@ namespace Bootstrap
     using AttemptPtr = std::shared_ptr<BootstrapAttempt>;
 
     constexpr uint16_t BLOCK_CACHE_TIMEOUT_MS = 10000; // 10 seconds
+    constexpr uint8_t MAX_MICRO_CHECKPOINTS = 8; // micro blocks pulled ahead of their request blocks
 
     enum class PullStatus : uint8_t
     {
@@ -103,8 +104,11 @@ namespace Bootstrap
         void CheckMicroProgressAndCreateMorePulls(bool wakeup = false);
         bool ReduceNumBlockToDownload();
 
+        struct MicroPeriod;
+
         void UpdateMyBSBTip(BSBPtr block);
-        void UpdateMyMBTip(MBPtr block);
+        void UpdateMyBSBTips(const MicroPeriod & mbp);
+        void UpdateMyMBTip(const MicroPeriod & mbp);
         void UpdateMyEBTip(EBPtr block);
 
         logos::IBlockCache & block_cache;
@@ -129,14 +133,23 @@ namespace Bootstrap
         };
         PullerState state = PullerState::Done;
 
+        /*
+         * A micro period covers one or more consecutive micro blocks, mb
+         * being the last. The request tips recorded in the earlier ones,
+         * the checkpoints, split each delegate chain into ranges that are
+         * pulled concurrently, possibly from different peers, and spliced
+         * in the block cache in whatever order they arrive.
+         */
         struct MicroPeriod
         {
             MBPtr mb;
+            std::vector<MBPtr> checkpoints;
             std::unordered_set<BlockHash> bsb_targets;
 
             void Clean()
             {
                 mb = nullptr;
+                checkpoints.clear();
                 assert(bsb_targets.empty());
             }
         };
@@ -66,7 +66,7 @@ namespace Bootstrap
     LOG_TRACE(log) << "bulk_pull_client::"<<__func__ <<"::data:" << stream.str ();
 }
 #endif
-                        logos::bufferstream stream (buf, header.payload_size);
+                        logos::span_reader stream (buf, header.payload_size);
                         pull_status = process_reply(header.pull_response_ct, stream);
                     }
 
@@ -97,7 +97,7 @@ namespace Bootstrap
                 });
     }
 
-    PullStatus PullClient::process_reply (ConsensusType ct, logos::bufferstream & stream)
+    PullStatus PullClient::process_reply (ConsensusType ct, logos::span_reader & stream)
     {
         LOG_TRACE(log) << "PullClient::"<<__func__;
         bool error = false;
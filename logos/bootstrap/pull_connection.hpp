@@ -34,7 +34,7 @@ namespace Bootstrap
 
         void receive_block ();
 
-        PullStatus process_reply (ConsensusType ct, logos::bufferstream & stream);
+        PullStatus process_reply (ConsensusType ct, logos::span_reader & stream);
 
         std::shared_ptr<ISocket> connection;
         Puller & puller;
@@ -62,7 +62,7 @@ namespace Bootstrap
                 bool error = false;
                 if(good)
                 {
-                    logos::bufferstream stream (buf, header.payload_size);
+                    logos::span_reader stream (buf, header.payload_size);
                     new (&response) TipSet(error, stream);
                     if (!error)
                     {
@@ -303,6 +303,29 @@ ConsensusContainer::OnSendRequest(vector<std::shared_ptr<DM>> &blocks)
     return proposer_epoch_manager->_request_manager->OnSendRequest(blocks);
 }
 
+logos::process_result
+ConsensusContainer::OnRequestDigest(const BlockHash & hash)
+{
+    // Most digests are new, those skip the exact checks below.
+    if(!_recent_requests.CheckAndInsert(hash))
+    {
+        return logos::process_result::progress;
+    }
+
+    if(RequestMessageHandler::GetMessageHandler().Contains(hash))
+    {
+        return logos::process_result::pending;
+    }
+
+    if(_store.request_exists(hash))
+    {
+        return logos::process_result::old;
+    }
+
+    // false positive
+    return logos::process_result::progress;
+}
+
 void
 ConsensusContainer::AttemptInitiateConsensus(ConsensusType CT)
 {
@@ -967,12 +990,25 @@ ConsensusContainer::OnP2pReceive(const void *data, size_t size)
                 return false;
             }
 
+            auto hash = request->Hash();
             LOG_DEBUG(_log) << "ConsensusContainer::OnP2pReceive-Request"
-                << ",hash=" << request->Hash().to_string();
-                 
+                << ",hash=" << hash.to_string();
+
+            //if the Request was already received and is still queued, it was
+            //propagated already; drop this copy without validating it, since
+            //the hash doesn't cover the signature and the copy may not be
+            //the one that was validated
+            if(_recent_requests.CheckAndInsert(hash)
+               && RequestMessageHandler::GetMessageHandler().Contains(hash))
+            {
+                LOG_DEBUG(_log) << "P2PRequestPropagation-"
+                    << "hash=" << hash.to_string()
+                    << ",pending,not propagating";
+                return false;
+            }
 
-            //if the Request already exists in the store, do not propagate            
-            if(_store.request_exists(request->Hash()))
+            //if the Request already exists in the store, do not propagate
+            if(_store.request_exists(hash))
             {
                 LOG_DEBUG(_log) << "P2PRequestPropagation-"
                     << "hash=" << request->Hash().to_string()
@@ -5,6 +5,7 @@
 
 #include <logos/consensus/microblock/microblock_consensus_manager.hpp>
 #include <logos/consensus/request/request_consensus_manager.hpp>
+#include <logos/consensus/request/recent_digest_filter.hpp>
 #include <logos/consensus/epoch/epoch_consensus_manager.hpp>
 #include <logos/network/epoch_peer_manager.hpp>
 #include <logos/network/consensus_netio_manager.hpp>
@@ -216,6 +217,14 @@ public:
     ///     @return responses containinig process_result and hash
     Responses OnSendRequest(std::vector<std::shared_ptr<DM>> &blocks) override;
 
+    /// Checks a request digest against recently seen requests.
+    ///
+    /// Digests missing from the recent digest filter are new; others are
+    /// confirmed against the request queue and the store.
+    ///     @param[in] hash digest of the request
+    ///     @return progress if new, pending if queued, old if stored
+    logos::process_result OnRequestDigest(const BlockHash & hash) override;
+
     /// Tells current epoch manager, if any, to initiate consensus of given type
     ///     @param[in] consensus type
     void AttemptInitiateConsensus(ConsensusType CT) override;
@@ -440,6 +449,7 @@ private:
     BindingMap                           _binding_map;         ///< map for binding connection to epoch manager
     static bool                          _validate_sig_config; ///< validate sig in BBS for added security
     ContainerP2p                         _p2p;                 ///< p2p-related data
+    RecentDigestFilter                   _recent_requests;     ///< digests of recently received requests
     umap<ConsensusType, Timer>           _timers;
     umap<ConsensusType, bool>            _timer_set;
     umap<ConsensusType, bool>            _timer_cancelled;
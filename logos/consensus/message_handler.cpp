@@ -1,9 +1,93 @@
 #include <logos/consensus/message_handler.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <thread>
+
+template<ConsensusType CT>
+constexpr size_t MessageHandler<CT>::INGRESS_SHARDS;
+template<ConsensusType CT>
+constexpr size_t MessageHandler<CT>::DEDUPE_STRIPES;
+
 template<ConsensusType CT>
 MessageHandler<CT>::MessageHandler()
 {}
 
+template<ConsensusType CT>
+auto MessageHandler<CT>::GetDedupeStripe(const BlockHash & hash) -> DedupeStripe &
+{
+    // std::hash<uint256_union> uses the leading bytes, which also pick
+    // the bucket within the stripe's set; use a trailing byte instead.
+    return _dedupe[hash.bytes.back() % DEDUPE_STRIPES];
+}
+
+template<ConsensusType CT>
+auto MessageHandler<CT>::GetIngressShard() -> IngressShard &
+{
+    return _ingress[std::hash<std::thread::id>()(std::this_thread::get_id()) % INGRESS_SHARDS];
+}
+
+template<ConsensusType CT>
+void MessageHandler<CT>::DrainIngress()
+{
+    if(!_ingress_size.load())
+    {
+        return;
+    }
+
+    std::vector<Entry> drained;
+    for(auto & shard : _ingress)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        std::move(shard.entries.begin(), shard.entries.end(), std::back_inserter(drained));
+        shard.entries.clear();
+    }
+    _ingress_size -= drained.size();
+
+    // Each shard is in arrival order already; restore it across shards.
+    std::sort(drained.begin(), drained.end(), [](const Entry & a, const Entry & b)
+    {
+        return a.arrival < b.arrival;
+    });
+
+    for(auto & entry : drained)
+    {
+        _entries.push_back(std::move(entry));
+    }
+}
+
+template<ConsensusType CT>
+void MessageHandler<CT>::ForgetHash(const BlockHash & hash)
+{
+    auto & stripe = GetDedupeStripe(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    stripe.hashes.erase(hash);
+}
+
+template<ConsensusType CT>
+void MessageHandler<CT>::ForgetHashes(const std::vector<BlockHash> & hashes)
+{
+    HashStripes stripes;
+    for(auto & hash : hashes)
+    {
+        stripes[hash.bytes.back() % DEDUPE_STRIPES].push_back(hash);
+    }
+
+    for(size_t i = 0; i < DEDUPE_STRIPES; ++i)
+    {
+        if(stripes[i].empty())
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(_dedupe[i].mutex);
+        for(auto & hash : stripes[i])
+        {
+            _dedupe[i].hashes.erase(hash);
+        }
+    }
+}
+
 template<ConsensusType CT>
 void MessageHandler<CT>::OnMessage(const MessagePtr & message, const Seconds & seconds)
 {
@@ -16,12 +100,15 @@ void MessageHandler<CT>::OnMessage(const MessagePtr & message, const TimePoint &
     auto hash = message->Hash();
     // TODO: implement GetHash to avoid repeated hashing for MB/E
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if(_entries. template get<1>().find(hash) != _entries. template get<1>().end())
     {
-        LOG_WARN(_log) << "MessageHandler<" << ConsensusToName(CT)
-                       << ">::OnMessage - Ignoring duplicate message with hash: " << hash.to_string();
-        return;
+        auto & stripe = GetDedupeStripe(hash);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        if(!stripe.hashes.insert(hash).second)
+        {
+            LOG_WARN(_log) << "MessageHandler<" << ConsensusToName(CT)
+                           << ">::OnMessage - Ignoring duplicate message with hash: " << hash.to_string();
+            return;
+        }
     }
 
     // For MB/EB, persistence manager (Backup) / Archiver (Primary) checks guarantee that messages arrive
@@ -29,13 +116,18 @@ void MessageHandler<CT>::OnMessage(const MessagePtr & message, const TimePoint &
     LOG_DEBUG (_log) << "MessageHandler<" << ConsensusToName(CT) << ">::OnMessage - timeout is " << tp << ", "
                      << "hash is " << hash.to_string()
                      << message->ToJson();
-    _entries.push_back(Entry{hash, message, tp});
+
+    auto & shard = GetIngressShard();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.entries.push_back(Entry{hash, message, tp, _arrivals++});
+    _ingress_size++;
 }
 
 template<ConsensusType CT>
 typename MessageHandler<CT>::MessagePtr MessageHandler<CT>::GetFront()
 {
     std::lock_guard<std::mutex> lock(_mutex);
+    DrainIngress();
     auto it = _entries.begin();
     if (it == _entries.end()) return nullptr;
     return it->block;
@@ -44,24 +136,32 @@ typename MessageHandler<CT>::MessagePtr MessageHandler<CT>::GetFront()
 template<ConsensusType CT>
 void MessageHandler<CT>::OnPostCommit(std::shared_ptr<PrePrepareMessage<ConsensusType::Request>> block)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    auto & hashed = _entries. template get<1>();
+    std::vector<BlockHash> erased;
+    erased.reserve(block->requests.size());
 
-    for(auto req_ptr : block->requests)
     {
-        auto hash = req_ptr->GetHash();
+        std::lock_guard<std::mutex> lock(_mutex);
+        DrainIngress();
+        auto & hashed = _entries. template get<1>();
 
-        if(hashed.find(hash) != hashed.end())
+        for(auto & req_ptr : block->requests)
         {
-            hashed.erase(hash);
+            auto hash = req_ptr->GetHash();
+            if(hashed.erase(hash))
+            {
+                erased.push_back(hash);
+            }
         }
     }
+
+    ForgetHashes(erased);
 }
 
 template<ConsensusType CT>
 bool MessageHandler<CT>::PrimaryEmpty()
 {
     std::lock_guard<std::mutex> lock(_mutex);
+    DrainIngress();
     auto &expiration_index = _entries. template get<2>();
     auto it = expiration_index.lower_bound(Min_DT);
     auto end = expiration_index.upper_bound(Clock::now());
@@ -72,6 +172,7 @@ template<ConsensusType CT>
 auto MessageHandler<CT>::GetImminentTimeout() -> const TimePoint &
 {
     std::lock_guard<std::mutex> lock(_mutex);
+    DrainIngress();
     auto &expiration_index = _entries. template get<2>();
     auto it = expiration_index.lower_bound(Clock::now());
     if (it == expiration_index.end()) return Min_DT;
@@ -81,17 +182,29 @@ auto MessageHandler<CT>::GetImminentTimeout() -> const TimePoint &
 template<ConsensusType CT>
 bool MessageHandler<CT>::Contains(const BlockHash & hash)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    auto & hashed = _entries. template get<1>();
-
-    return hashed.find(hash) != hashed.end();
+    // Every queued or ingressing hash is in the dedupe set.
+    auto & stripe = GetDedupeStripe(hash);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    return stripe.hashes.find(hash) != stripe.hashes.end();
 }
 
 template<ConsensusType CT>
 void MessageHandler<CT>::Clear()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _entries.erase(_entries.begin(), _entries.end());
+    std::vector<BlockHash> erased;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        DrainIngress();
+        erased.reserve(_entries.size());
+        for(auto & entry : _entries)
+        {
+            erased.push_back(entry.hash);
+        }
+        _entries.erase(_entries.begin(), _entries.end());
+    }
+
+    ForgetHashes(erased);
 }
 
 /// Below are benchmarking methods, deprecated for now
@@ -107,6 +220,7 @@ template<ConsensusType CT>
 bool MessageHandler<CT>::Empty()
 {
     std::lock_guard<std::mutex> lock(_mutex);
+    DrainIngress();
     return _entries.empty();
 }
 
@@ -118,24 +232,33 @@ template class MessageHandler<ConsensusType::Epoch>;
 
 void RequestMessageHandler::MoveToTarget(RequestInternalQueue & queue, size_t size)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    auto &expiration_index = _entries. template get<2>();
-    auto end = expiration_index.upper_bound(Clock::now());  // strictly greater than
+    std::vector<BlockHash> moved;
 
-    for(auto pos = expiration_index.lower_bound(Min_DT); pos != end && size != 0; size--)
     {
-        LOG_DEBUG(_log) << "RequestMessageHandler::MoveToTarget - moving " << pos->block->ToJson();
-        // keep inserting and removing until at capacity or end
-        queue.PushBack(std::static_pointer_cast<Request>(pos->block));
-        pos = expiration_index.erase(pos);
+        std::lock_guard<std::mutex> lock(_mutex);
+        DrainIngress();
+        auto &expiration_index = _entries. template get<2>();
+        auto end = expiration_index.upper_bound(Clock::now());  // strictly greater than
+
+        for(auto pos = expiration_index.lower_bound(Min_DT); pos != end && size != 0; size--)
+        {
+            LOG_DEBUG(_log) << "RequestMessageHandler::MoveToTarget - moving " << pos->block->ToJson();
+            // keep inserting and removing until at capacity or end
+            queue.PushBack(std::static_pointer_cast<Request>(pos->block));
+            moved.push_back(pos->hash);
+            pos = expiration_index.erase(pos);
+        }
+        // finally add empty delimiter to signify end of batch
+        queue.PushBack(std::shared_ptr<Request>(new Request()));
     }
-    // finally add empty delimiter to signify end of batch
-    queue.PushBack(std::shared_ptr<Request>(new Request()));
+
+    ForgetHashes(moved);
 }
 
 bool MicroBlockMessageHandler::GetQueuedSequence(EpochSeq & epoch_seq)
 {
     std::lock_guard<std::mutex> lock(_mutex);
+    DrainIngress();
     auto & sequence = _entries. template get<0>();
     auto it = sequence.end();
     if (it == sequence.begin())
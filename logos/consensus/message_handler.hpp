@@ -6,7 +6,11 @@
 #include <logos/lib/epoch_time_util.hpp>
 #include <logos/lib/log.hpp>
 
+#include <unordered_set>
 #include <memory>
+#include <atomic>
+#include <vector>
+#include <array>
 #include <list>
 
 #include <boost/multi_index/hashed_index.hpp>
@@ -26,6 +30,11 @@ class RequestInternalQueue;
 /// 1) incoming requests / archive blocks,
 /// 2) secondary waiting list, and
 /// 3) backups
+///
+/// Producers don't contend on the queue's mutex: incoming messages are
+/// deduplicated against a striped hash set and appended to one of several
+/// ingress shards picked by the producing thread. Consumers merge the
+/// shards into the queue under the mutex before reading it.
 template<ConsensusType CT>
 class MessageHandler
 {
@@ -63,11 +72,13 @@ public:
     std::enable_if_t<PCT != ConsensusType::Request, void> OnPostCommit(std::shared_ptr<PrePrepare> block)
     {
         std::lock_guard<std::mutex> lock(_mutex);
+        DrainIngress();
         auto & hashed = _entries. template get <1> ();
         auto hash = block->Hash();
         auto n_erased = hashed.erase(hash);
         if (n_erased)
         {
+            ForgetHash(hash);
             LOG_DEBUG (_log) << "MessageHandler<" << ConsensusToName(CT) << ">::OnPostCommit - erased " << hash.to_string();
         }
         else
@@ -83,6 +94,7 @@ public:
                     LOG_ERROR(_log) << "MessageHandler<" << ConsensusToName(CT)
                                     << ">::OnPostCommit - queued conflicting archival block detected: "
                                     << it->block->ToJson();
+                    ForgetHash(it->hash);
                     _entries.erase(it);
                     break;
                 }
@@ -92,6 +104,7 @@ public:
     }
 
     /// Attempts to erase all contents from post-committed message from queue
+    /// in a single pass under the queue's lock
     ///
     /// @param[in] shared pointer to PrePrepare whose requests we wish to erase
     void OnPostCommit(std::shared_ptr<PrePrepareMessage<ConsensusType::Request>>);
@@ -107,7 +120,7 @@ public:
     /// (defined in boost posix_time)
     const TimePoint & GetImminentTimeout();
 
-    /// Checks if queue contains the given hash value
+    /// Checks if queue contains the given hash value, without taking the queue's lock
     ///
     /// @param[in] hash to check
     /// @return true if exists
@@ -128,8 +141,32 @@ private:
         BlockHash  hash;
         MessagePtr block;
         TimePoint  expiration;
+        uint64_t   arrival;   ///< orders entries merged from different shards
+    };
+
+    static constexpr size_t INGRESS_SHARDS = 16;
+    static constexpr size_t DEDUPE_STRIPES = 64;
+
+    struct IngressShard
+    {
+        std::mutex         mutex;
+        std::vector<Entry> entries;
+    };
+
+    struct DedupeStripe
+    {
+        std::mutex                    mutex;
+        std::unordered_set<BlockHash> hashes;
     };
 
+    using HashStripes = std::array<std::vector<BlockHash>, DEDUPE_STRIPES>;
+
+    /// @returns the stripe of the dedupe set holding the hash
+    DedupeStripe & GetDedupeStripe(const BlockHash & hash);
+
+    /// @returns the ingress shard of the calling thread
+    IngressShard & GetIngressShard();
+
     using Entries   =
             boost::multi_index_container<
                 Entry,
@@ -142,9 +179,23 @@ private:
 
 protected:
 
-    std::mutex _mutex;
-    Log        _log;
-    Entries    _entries;
+    /// Merge the ingress shards into the queue; _mutex must be held.
+    void DrainIngress();
+
+    /// Remove a hash erased from the queue from the dedupe set.
+    void ForgetHash(const BlockHash & hash);
+
+    /// Remove hashes erased from the queue from the dedupe set,
+    /// locking each stripe once.
+    void ForgetHashes(const std::vector<BlockHash> & hashes);
+
+    std::mutex                                _mutex;
+    Log                                       _log;
+    Entries                                   _entries;
+    std::array<IngressShard, INGRESS_SHARDS>  _ingress;
+    std::atomic<size_t>                       _ingress_size{0};
+    std::atomic<uint64_t>                     _arrivals{0};
+    std::array<DedupeStripe, DEDUPE_STRIPES>  _dedupe;
 };
 
 class RequestMessageHandler : public MessageHandler<ConsensusType::Request>
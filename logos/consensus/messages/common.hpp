@@ -9,6 +9,7 @@
 #include <blake2/blake2.h>
 
 #include <logos/lib/utility.hpp>
+#include <logos/lib/span_stream.hpp>
 #include <logos/consensus/messages/byte_arrays.hpp>
 #include <boost/iostreams/stream_buffer.hpp>
 
@@ -111,6 +112,8 @@ struct AggSignature
 
     ParicipationMap map;
     DelegateSig     sig;
+
+    static constexpr uint32_t WireSize = sizeof(uint64_t) + sizeof(DelegateSig);
 };
 
 
@@ -221,6 +224,14 @@ struct PrePrepareCommon
     uint64_t    timestamp;
     mutable BlockHash   previous;
     DelegateSig preprepare_sig;
+
+    static constexpr uint32_t WireSize = sizeof(primary_delegate) +
+                                         sizeof(epoch_number) +
+                                         sizeof(delegates_epoch_number) +
+                                         sizeof(sequence) +
+                                         sizeof(timestamp) +
+                                         HASH_SIZE +
+                                         sizeof(DelegateSig);
 };
 
 using HeaderStream = boost::iostreams::stream_buffer<boost::iostreams::basic_array_sink<uint8_t>>;
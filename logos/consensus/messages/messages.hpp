@@ -84,14 +84,18 @@ struct PrePrepareMessage : public MessagePrequel<MessageType::Pre_Prepare, CT>,
     void Serialize(std::vector<uint8_t> & buf, bool with_appendix = true) const
     {
         assert(buf.empty());
+        auto size = WireSize(with_appendix);
+        MessagePrequel<MessageType::Pre_Prepare, CT>::payload_size = size - MessagePrequelSize;
+
+        auto error = logos::serialize_exact(buf, size, [this, with_appendix](logos::stream & stream) {
+            Serialize(stream, with_appendix);
+        });
+        if(error)
         {
-            logos::vectorstream stream(buf);
-            MessagePrequel<MessageType::Pre_Prepare, CT>::payload_size =
-                    Serialize(stream, with_appendix) - MessagePrequelSize;
+            Log log;
+            LOG_FATAL(log) << "PrePrepareMessage::Serialize - size doesn't match WireSize " << size;
+            trace_and_halt();
         }
-
-        HeaderStream header_stream(buf.data(), MessagePrequelSize);
-        MessagePrequel<MessageType::Pre_Prepare, CT>::Serialize(header_stream);
     }
 
     uint32_t Serialize(logos::stream & stream, bool with_appendix) const
@@ -100,6 +104,11 @@ struct PrePrepareMessage : public MessagePrequel<MessageType::Pre_Prepare, CT>,
                 ConsensusBlock<CT>::Serialize(stream, with_appendix);
     }
 
+    uint32_t WireSize(bool with_appendix) const
+    {
+        return MessagePrequelSize + ConsensusBlock<CT>::WireSize(with_appendix);
+    }
+
     void SerializeJson(boost::property_tree::ptree & tree) const
     {
         ConsensusBlock<CT>::SerializeJson(tree);
@@ -165,7 +174,7 @@ struct PostCommittedBlock : public MessagePrequel<MessageType::Post_Committed_Bl
 
     PostCommittedBlock(bool & error, logos::mdb_val & mdbval)
     {
-        logos::bufferstream stream(reinterpret_cast<uint8_t const *> (mdbval.data()), mdbval.size());
+        logos::span_reader stream(reinterpret_cast<uint8_t const *> (mdbval.data()), mdbval.size());
         MessagePrequel<MessageType::Post_Committed_Block, CT> prequel(error, stream);
         if(error)
             return;
@@ -175,9 +184,14 @@ struct PostCommittedBlock : public MessagePrequel<MessageType::Post_Committed_Bl
     logos::mdb_val to_mdb_val(std::vector<uint8_t> &buf) const
     {
         assert(buf.empty());
-        {
-            logos::vectorstream stream(buf);
+        auto error = logos::serialize_exact(buf, WireSize(false, true), [this](logos::stream & stream) {
             Serialize(stream, false, true);
+        });
+        if(error)
+        {
+            Log log;
+            LOG_FATAL(log) << "PostCommittedBlock::to_mdb_val - size doesn't match WireSize " << buf.size();
+            trace_and_halt();
         }
         return logos::mdb_val(buf.size(), buf.data());
     }
@@ -228,14 +242,26 @@ struct PostCommittedBlock : public MessagePrequel<MessageType::Post_Committed_Bl
     void Serialize(std::vector<uint8_t> & buf, bool with_appendix, bool with_next) const
     {
         assert(buf.empty());
+        auto size = WireSize(with_appendix, with_next);
+        MessagePrequel<MessageType::Post_Committed_Block, CT>::payload_size = size - MessagePrequelSize;
+
+        auto error = logos::serialize_exact(buf, size, [this, with_appendix, with_next](logos::stream & stream) {
+            Serialize(stream, with_appendix, with_next);
+        });
+        if(error)
         {
-            logos::vectorstream stream(buf);
-            MessagePrequel<MessageType::Post_Committed_Block, CT>::payload_size =
-                    Serialize(stream, with_appendix, with_next) - MessagePrequelSize;
+            Log log;
+            LOG_FATAL(log) << "PostCommittedBlock::Serialize - size doesn't match WireSize " << size;
+            trace_and_halt();
         }
+    }
 
-        HeaderStream header_stream(buf.data(), MessagePrequelSize);
-        MessagePrequel<MessageType::Post_Committed_Block, CT>::Serialize(header_stream);
+    uint32_t WireSize(bool with_appendix, bool with_next) const
+    {
+        return MessagePrequelSize +
+               ConsensusBlock<CT>::WireSize(with_appendix) +
+               2 * AggSignature::WireSize +
+               (with_next ? HASH_SIZE : 0);
     }
 
     Tip CreateTip() const
@@ -34,16 +34,22 @@ RequestBlock::RequestBlock(bool & error, logos::stream & stream, bool with_reque
 
     if( with_requests )
     {
-        for(uint64_t i = 0; i < size; ++i)
+        // Hash the requests together rather than in their constructors.
         {
-            auto val = DeserializeRequest(error, stream);
-            if(error)
+            Request::DeferDigests defer;
+            for(uint64_t i = 0; i < size; ++i)
             {
-                return;
+                auto val = DeserializeRequest(error, stream);
+                if(error)
+                {
+                    return;
+                }
+                assert(val != nullptr);
+                requests.push_back(val);
             }
-            assert(val != nullptr);
-            requests.push_back(val);
         }
+
+        Request::ComputeDigests(requests);
     }
 }
 
@@ -114,3 +120,20 @@ uint32_t RequestBlock::Serialize(logos::stream & stream, bool with_requests) con
 
     return s;
 }
+
+uint32_t RequestBlock::WireSize(bool with_requests) const
+{
+    uint32_t s = PrePrepareCommon::WireSize +
+                 sizeof(uint16_t) +
+                 requests.size() * HASH_SIZE;
+
+    if(with_requests)
+    {
+        for(auto & request : requests)
+        {
+            s += request->StreamSize();
+        }
+    }
+
+    return s;
+}
@@ -42,6 +42,11 @@ struct RequestBlock : PrePrepareCommon
     /// @returns the number of bytes serialized
     uint32_t Serialize(logos::stream & stream, bool with_requests) const;
 
+    /// The exact number of bytes Serialize writes
+    /// @param with_requests if the state blocks should be serialize
+    /// @returns the serialized size
+    uint32_t WireSize(bool with_requests) const;
+
     RequestList     requests;
     RequestHashList hashes;
 };
@@ -2,11 +2,17 @@
 
 namespace logos {
 
-BlockCache::BlockCache(boost::asio::io_service & service, Store &store, std::queue<BlockHash> *unit_test_q)
+BlockCache::BlockCache(boost::asio::io_service & service, Store &store, std::queue<BlockHash> *unit_test_q,
+                       unsigned validation_threads)
     : _store(store)
     , _write_q(service, store, this, unit_test_q)
     , _block_container(_write_q)
 {
+    // Unit test validation reads state the write thread updates unlocked.
+    if (validation_threads > 1 && !unit_test_q)
+    {
+        _validation_pool.reset(new ValidationPool(std::min<unsigned>(validation_threads, NUM_DELEGATES)));
+    }
 }
 
 BlockCache::add_result BlockCache::AddEpochBlock(EBPtr block)
@@ -177,67 +183,7 @@ void BlockCache::Validate(uint8_t rb_idx)
     {
         if (ptr.rptr)
         {
-            RBPtr &block = ptr.rptr->block;
-            ValidationStatus &status = ptr.rptr->status;
-            LOG_TRACE(_log) << "BlockCache::"<<__func__
-                            << (ptr.rptr->direct_write ? ":R:direct writing " : ":R:verifying ")
-                            << block->CreateTip().to_string();
-
-            if ((success = ptr.rptr->direct_write || _write_q.VerifyContent(block, &status)))
-            {
-                _write_q.StoreBlock(block);
-                _block_container.BlockDelete(block->Hash());
-            }
-            else
-            {
-                //TODO order of validation
-                LOG_TRACE(_log) << "BlockCache::Validate RB status: "
-                        << ProcessResultToString(status.reason);
-                switch (ProcessResultToDependency(status.reason))
-                {
-                case logos::process_result_dependency::previous_block:
-                    _block_container.AddHashDependency(block->previous, ptr);
-                    break;
-                case logos::process_result_dependency::general_error_code:
-                    for (uint32_t i = 0; i < block->requests.size(); ++i)
-                    {
-                        switch (ProcessResultToDependency(status.requests[i]))
-                        {
-                        case logos::process_result_dependency::progress:
-                            continue;
-                        case logos::process_result_dependency::previous_block:
-                            _block_container.AddHashDependency(block->requests[i]->previous, ptr);
-                            break;
-                        case logos::process_result_dependency::sender_account:
-                            _block_container.AddHashDependency(block->requests[i]->GetAccount(), ptr);
-                            break;
-                        default:
-                            LOG_FATAL(_log) << "BlockCache::Validate RB status: request i=" << i
-                                            << " error_code=" << ProcessResultToString(status.requests[i])
-                                            << " block " << block->CreateTip().to_string();
-                            //TODO should not be here unless bad delegate set
-                            trace_and_halt();
-                            break;
-                        }
-                    }
-                    break;
-                default:
-                    //Since the agg-sigs are already verified,
-                    //we expect gap-like reasons.
-                    //For any other reason, we log them, and investigate.
-                    LOG_FATAL(_log) << "BlockCache::Validate RB status: "
-                                    << ProcessResultToString(status.reason)
-                                    << " block " << block->CreateTip().to_string();
-                    //TODO should not be here unless bad delegate set
-                    trace_and_halt();
-                    //Throw the block out, otherwise it blocks the rest.
-                    //_block_container.BlockDelete(block->Hash());//not enough
-                    //success = true;
-                    //TODO recall?
-                    //TODO detect double spend?
-                    break;
-                }
-            }
+            success = ValidateRequestBlocks(ptr);
         }
         else if (ptr.mptr)
         {
@@ -333,4 +279,123 @@ void BlockCache::Validate(uint8_t rb_idx)
     LOG_TRACE(_log) << "BlockCache::"<<__func__<<"}";
 }
 
+bool BlockCache::ValidateRequestBlocks(PendingBlockContainer::ChainPtr ptr)
+{
+    std::vector<PendingBlockContainer::ChainPtr> round;
+    if (_validation_pool)
+    {
+        _block_container.GetConcurrentRequestBlocks(ptr, _validation_pool->Size(), round);
+    }
+    else
+    {
+        round.push_back(ptr);
+    }
+
+    // not std::vector<bool>, results are written concurrently
+    std::vector<uint8_t> results(round.size(), false);
+    auto validate = [this, &round, &results](size_t i)
+    {
+        auto &pending = *round[i].rptr;
+        LOG_TRACE(_log) << "BlockCache::Validate"
+                        << (pending.direct_write ? ":R:direct writing " : ":R:verifying ")
+                        << pending.block->CreateTip().to_string();
+
+        if (pending.direct_write)
+        {
+            results[i] = true;
+            return;
+        }
+
+        // The whole block is validated against one snapshot of the database.
+        logos::read_snapshot snapshot(_store.environment);
+        results[i] = _write_q.VerifyContent(pending.block, &pending.status);
+    };
+
+    if (round.size() > 1)
+    {
+        _validation_pool->Run(round.size(), validate);
+    }
+    else
+    {
+        validate(0);
+    }
+
+    // Blocks of a round touch disjoint accounts, so the order they are written in
+    // doesn't change the result; it is still kept deterministic.
+    for (size_t i = 0; i < round.size(); ++i)
+    {
+        RBPtr &block = round[i].rptr->block;
+        if (results[i])
+        {
+            _write_q.StoreBlock(block);
+            _block_container.BlockDelete(block->Hash());
+        }
+        else
+        {
+            AddRequestBlockDependencies(round[i]);
+        }
+
+        if (i > 0)
+        {
+            _block_container.ReleaseRequestBlock(round[i], results[i]);
+        }
+    }
+
+    return results[0];
+}
+
+void BlockCache::AddRequestBlockDependencies(PendingBlockContainer::ChainPtr ptr)
+{
+    RBPtr &block = ptr.rptr->block;
+    ValidationStatus &status = ptr.rptr->status;
+
+    //TODO order of validation
+    LOG_TRACE(_log) << "BlockCache::Validate RB status: "
+            << ProcessResultToString(status.reason);
+    switch (ProcessResultToDependency(status.reason))
+    {
+    case logos::process_result_dependency::previous_block:
+        _block_container.AddHashDependency(block->previous, ptr);
+        break;
+    case logos::process_result_dependency::general_error_code:
+        for (uint32_t i = 0; i < block->requests.size(); ++i)
+        {
+            switch (ProcessResultToDependency(status.requests[i]))
+            {
+            case logos::process_result_dependency::progress:
+                continue;
+            case logos::process_result_dependency::previous_block:
+                _block_container.AddHashDependency(block->requests[i]->previous, ptr);
+                break;
+            case logos::process_result_dependency::sender_account:
+                _block_container.AddHashDependency(block->requests[i]->GetAccount(), ptr);
+                break;
+            default:
+                LOG_FATAL(_log) << "BlockCache::Validate RB status: request i=" << i
+                                << " error_code=" << ProcessResultToString(status.requests[i])
+                                << " block " << block->CreateTip().to_string();
+                //TODO should not be here unless bad delegate set
+                trace_and_halt();
+                break;
+            }
+        }
+        break;
+    default:
+        //Since the agg-sigs are already verified,
+        //we expect gap-like reasons.
+        //For any other reason, we log them, and investigate.
+        LOG_FATAL(_log) << "BlockCache::Validate RB status: "
+                        << ProcessResultToString(status.reason)
+                        << " block " << block->CreateTip().to_string();
+        //TODO should not be here unless bad delegate set
+        trace_and_halt();
+        //Throw the block out, otherwise it blocks the rest.
+        //_block_container.BlockDelete(block->Hash());//not enough
+        //success = true;
+        //TODO recall?
+        //TODO detect double spend?
+        break;
+    }
+}
+
 }
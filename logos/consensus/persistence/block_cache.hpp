@@ -20,6 +20,7 @@
 
 #include "block_container.hpp"
 #include "block_write_queue.hpp"
+#include "validation_pool.hpp"
 
 namespace logos {
 
@@ -90,8 +91,11 @@ public:
     /**
      * constructor
      * @param store the database
+     * @param validation_threads number of threads validating request blocks of
+     *        different delegate chains concurrently, 1 to validate on the calling thread only
      */
-    BlockCache(boost::asio::io_service & service, Store & store, std::queue<BlockHash> *unit_test_q = 0);
+    BlockCache(boost::asio::io_service & service, Store & store, std::queue<BlockHash> *unit_test_q = 0,
+               unsigned validation_threads = 1);
 
     /**
      * (inherited) add an epoch block to the cache
@@ -147,9 +151,20 @@ private:
      */
     void Validate(uint8_t bsb_idx = 0);
 
+    /*
+     * Validates the request block in ptr, along with the heads of other delegate chains
+     * that don't conflict with it if validation threads are configured. Valid blocks are
+     * queued for writing in a deterministic order, ptr's first.
+     * Returns true if the request block in ptr is valid.
+     */
+    bool ValidateRequestBlocks(PendingBlockContainer::ChainPtr ptr);
+
+    void AddRequestBlockDependencies(PendingBlockContainer::ChainPtr ptr);
+
     block_store &                   _store;
     BlockWriteQueue                 _write_q;
     PendingBlockContainer           _block_container;
+    std::unique_ptr<ValidationPool> _validation_pool;
 
     Log                             _log;
 };
@@ -1,5 +1,7 @@
 #include "block_container.hpp"
 
+#include <algorithm>
+
 namespace logos {
 
 bool PendingBlockContainer::IsBlockCached(const BlockHash &hash)
@@ -625,4 +627,135 @@ bool PendingBlockContainer::GetNextBlock(ChainPtr &ptr, uint8_t &rb_idx, bool su
     return false;
 }
 
+
+bool PendingBlockContainer::GetTouchedAccounts(const Request &request, AccountSet &accounts)
+{
+    accounts.insert(request.origin);
+    accounts.insert(request.GetAccount());
+    accounts.insert(request.GetSource());
+
+    switch (request.type)
+    {
+    case RequestType::Send:
+        for(auto &t : static_cast<const Send &>(request).transactions)
+        {
+            accounts.insert(t.destination);
+        }
+        break;
+    case RequestType::TokenSend:
+        for(auto &t : static_cast<const TokenSend &>(request).transactions)
+        {
+            accounts.insert(t.destination);
+        }
+        break;
+    case RequestType::Revoke:
+        accounts.insert(static_cast<const Revoke &>(request).transaction.destination);
+        break;
+    case RequestType::Distribute:
+        accounts.insert(static_cast<const Distribute &>(request).transaction.destination);
+        break;
+    case RequestType::WithdrawFee:
+        accounts.insert(static_cast<const WithdrawFee &>(request).transaction.destination);
+        break;
+    case RequestType::WithdrawLogos:
+        accounts.insert(static_cast<const WithdrawLogos &>(request).transaction.destination);
+        break;
+    case RequestType::IssueAdditional:
+    case RequestType::ChangeSetting:
+    case RequestType::ImmuteSetting:
+    case RequestType::AdjustFee:
+    case RequestType::UpdateIssuerInfo:
+    case RequestType::UpdateController:
+    case RequestType::Burn:
+        break;
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+bool PendingBlockContainer::GetTouchedAccounts(const ApprovedRB &block, AccountSet &accounts)
+{
+    for (auto & request : block.requests)
+    {
+        if (!GetTouchedAccounts(*request, accounts))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void PendingBlockContainer::GetConcurrentRequestBlocks(const ChainPtr &ptr, size_t max, std::vector<ChainPtr> &round)
+{
+    assert(ptr.rptr);
+    round.push_back(ptr);
+
+    AccountSet accounts;
+    if (!GetTouchedAccounts(*ptr.rptr->block, accounts))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lck (_chains_mutex);
+
+    auto e = _epochs.begin();
+    for (; e != _epochs.end() && e->epoch_num != ptr.rptr->block->epoch_number; ++e);
+    if (e == _epochs.end())
+    {
+        return;
+    }
+
+    uint8_t first = ptr.rptr->block->primary_delegate;
+    for (uint8_t i = 1; i < NUM_DELEGATES && round.size() < max; ++i)
+    {
+        auto &chain = e->rbs[(first + i) % NUM_DELEGATES];
+        if (chain.empty()
+                || !chain.front()->reliances.empty()
+                || chain.front()->lock)
+        {
+            continue;
+        }
+
+        RPtr head = chain.front();
+        AccountSet head_accounts;
+        if (!GetTouchedAccounts(*head->block, head_accounts)
+                || std::any_of(head_accounts.begin(), head_accounts.end(),
+                               [&accounts](const AccountAddress &a){ return accounts.count(a); }))
+        {
+            continue;
+        }
+
+        accounts.insert(head_accounts.begin(), head_accounts.end());
+        head->lock = true;
+        round.emplace_back(head);
+        LOG_TRACE(_log) << "BlockCache:Concurrent:R: " << head->block->CreateTip().to_string();
+    }
+}
+
+void PendingBlockContainer::ReleaseRequestBlock(const ChainPtr &ptr, bool success)
+{
+    assert(ptr.rptr);
+    std::lock_guard<std::mutex> lck (_chains_mutex);
+
+    ptr.rptr->lock = false;
+    if (!success)
+    {
+        return;
+    }
+
+    for (auto &e : _epochs)
+    {
+        if (e.epoch_num == ptr.rptr->block->epoch_number)
+        {
+            auto &chain = e.rbs[ptr.rptr->block->primary_delegate];
+            assert(!chain.empty() && chain.front() == ptr.rptr);
+            chain.pop_front();
+            break;
+        }
+    }
+}
+
 }
@@ -226,7 +226,39 @@ public:
      */
     bool GetNextBlock(ChainPtr &ptr, uint8_t &rb_idx, bool success);
 
+    /*
+     * Collects request blocks that can be validated concurrently with the request block
+     * returned in ptr by GetNextBlock: the heads of the other delegate chains of the same
+     * epoch that are ready for validation and touch none of the accounts touched by the
+     * blocks collected before them. Chains are visited in order starting after ptr's, and
+     * round receives ptr followed by at most max - 1 blocks. The collected blocks are
+     * locked, each must be handed back with ReleaseRequestBlock.
+     */
+    void GetConcurrentRequestBlocks(const ChainPtr &ptr, size_t max, std::vector<ChainPtr> &round);
+
+    /*
+     * Unlocks a block collected by GetConcurrentRequestBlocks, and removes it from its
+     * chain if it was validated successfully.
+     */
+    void ReleaseRequestBlock(const ChainPtr &ptr, bool success);
+
+    using AccountSet = std::unordered_set<AccountAddress>;
+
+    /*
+     * Adds the accounts whose state the request reads or writes to accounts.
+     * Returns false if the request also touches state shared beyond those accounts.
+     */
+    static bool GetTouchedAccounts(const Request &request, AccountSet &accounts);
+
 private:
+
+    /*
+     * Adds the accounts whose state the block's requests read or write to accounts.
+     * Returns false if the block also touches state shared beyond those accounts,
+     * such as elections, staking and rewards, and so has to be validated alone.
+     */
+    static bool GetTouchedAccounts(const ApprovedRB &block, AccountSet &accounts);
+
     bool DeleteHashDependencies(const BlockHash &hash, std::list<ChainPtr> &chains);
     void MarkForRevalidation(const BlockHash &hash, std::list<ChainPtr> &chains);
     bool DeleteDependenciesAndMarkForRevalidation(const BlockHash &hash);
@@ -13,6 +13,10 @@
 #include <logos/node/websocket.hpp>
 
 #include <numeric>
+#include <array>
+
+std::mutex PersistenceManager<ECT>::_plan_mutex;
+std::shared_ptr<const EpochTransitionPlan> PersistenceManager<ECT>::_plan;
 
 PersistenceManager<ECT>::PersistenceManager(Store & store,
                                             ReservationsPtr,
@@ -176,6 +180,8 @@ PersistenceManager<ECT>::Validate(
             return false;
         }
 
+        PrepareTransition(epoch);
+
         if (status)
             status->progress = EVP_END;
     }
@@ -201,7 +207,17 @@ PersistenceManager<ECT>::ApplyUpdates(
     BlockHash epoch_hash = block.Hash();
     bool transition = EpochVotingManager::ENABLE_ELECTIONS;
 
-    UpdateThawing(block, transaction);
+    // Blocks that weren't validated by this node are planned inline
+    auto plan = TakeTransitionPlan(epoch_hash);
+
+    if (plan)
+    {
+        UpdateThawing(block, plan->retiring, transaction);
+    }
+    else
+    {
+        UpdateThawing(block, transaction);
+    }
 
     if(_store.epoch_put(block, transaction) || _store.epoch_tip_put(block.CreateTip(), transaction))
     {
@@ -243,10 +259,93 @@ PersistenceManager<ECT>::ApplyUpdates(
 
     if(block.transaction_fee_pool > 0)
     {
-        ApplyRewards(block, epoch_hash, transaction);
+        if (plan)
+        {
+            ApplyRewards(block, epoch_hash, plan->rewards, transaction);
+        }
+        else
+        {
+            ApplyRewards(block, epoch_hash, transaction);
+        }
+    }
+
+    if (plan)
+    {
+        UpdateGlobalRewards(block, plan->new_logos, transaction);
+    }
+    else
+    {
+        UpdateGlobalRewards(block, transaction);
+    }
+}
+
+void PersistenceManager<ECT>::PrepareTransition(const PrePrepare & message)
+{
+    auto plan = std::make_shared<EpochTransitionPlan>();
+    if (PlanTransition(message, message.Hash(), *plan))
+    {
+        LOG_WARN(_log) << "PersistenceManager<ECT>::PrepareTransition failed to plan transition of epoch "
+                       << message.epoch_number << ", it will be planned on commit";
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_plan_mutex);
+    _plan = plan;
+}
+
+std::shared_ptr<const EpochTransitionPlan> PersistenceManager<ECT>::TakeTransitionPlan(const BlockHash & hash)
+{
+    std::lock_guard<std::mutex> lock(_plan_mutex);
+    if (!_plan || _plan->epoch_hash != hash)
+    {
+        return nullptr;
+    }
+
+    auto plan = _plan;
+    _plan.reset();
+    return plan;
+}
+
+bool PersistenceManager<ECT>::PlanTransition(const Epoch & block,
+                                             const BlockHash & hash,
+                                             EpochTransitionPlan & plan,
+                                             MDB_txn * txn)
+{
+    ApprovedEB previous;
+    if (_store.epoch_get(block.previous, previous, txn))
+    {
+        return true;
+    }
+
+    plan.epoch_hash = hash;
+
+    std::unordered_set<AccountAddress> new_dels;
+    for(auto & del : block.delegates)
+    {
+        new_dels.insert(del.account);
+    }
+
+    for(auto & del : previous.delegates)
+    {
+        if(new_dels.find(del.account) == new_dels.end())
+        {
+            plan.retiring.push_back(del.account);
+        }
+    }
+
+    if (block.epoch_number <= GENESIS_EPOCH)
+    {
+        return false;
     }
 
-    UpdateGlobalRewards(block, transaction);
+    if (block.transaction_fee_pool > 0 && PlanRewards(block, previous, plan.rewards, txn))
+    {
+        return true;
+    }
+
+    plan.new_logos = block.total_supply - previous.total_supply;
+
+    return false;
 }
 
 void
@@ -323,20 +422,32 @@ void PersistenceManager<ECT>::UpdateThawing(ApprovedEB const & block, MDB_txn* t
         new_dels.insert(del.account);
     }
 
-
+    std::vector<AccountAddress> retiring;
     for(auto del : prev_epoch.delegates)
     {
         if(new_dels.find(del.account) == new_dels.end())
         {
-            //epoch_number+2 because delegate is retired
-            //in the epoch following current epoch
-            StakingManager::GetInstance()->SetExpirationOfFrozen(
-                    del.account,
-                    block.epoch_number+2,
-                    txn);
+            retiring.push_back(del.account);
         }
     }
 
+    UpdateThawing(block, retiring, txn);
+}
+
+void PersistenceManager<ECT>::UpdateThawing(ApprovedEB const & block,
+                                            const std::vector<AccountAddress> & retiring,
+                                            MDB_txn* txn)
+{
+    for(auto & account : retiring)
+    {
+        //epoch_number+2 because delegate is retired
+        //in the epoch following current epoch
+        StakingManager::GetInstance()->SetExpirationOfFrozen(
+                account,
+                block.epoch_number+2,
+                txn);
+    }
+
     for(auto del : block.delegates)
     {
         //Mark any funds that began thawing in previous epoch
@@ -474,11 +585,8 @@ void PersistenceManager<ECT>::ApplyRewards(const ApprovedEB & block, const Block
         trace_and_halt();
     }
 
-    // Retrieve the antepenultimate epoch to access
-    // each delegate's raw stake which determine
-    // to the rewards it earns for the current
-    // epoch.
-    if(_store.epoch_get(prev.previous, prev, txn))
+    std::vector<EpochTransitionPlan::DelegateReward> rewards;
+    if(PlanRewards(block, prev, rewards, txn))
     {
         LOG_FATAL(_log) << "PersistenceManager<ECT>::ApplyRewards - "
                         << "failed to find antepenultimate epoch block for epoch number "
@@ -487,21 +595,49 @@ void PersistenceManager<ECT>::ApplyRewards(const ApprovedEB & block, const Block
         trace_and_halt();
     }
 
-    // Use this comparison function to sort the delegates
-    // according to stake.
-    auto stake_cmp = [](const auto & a, const auto & b)
+    ApplyRewards(block, hash, rewards, txn);
+}
+
+bool PersistenceManager<ECT>::PlanRewards(const Epoch & block,
+                                          const ApprovedEB & previous,
+                                          std::vector<EpochTransitionPlan::DelegateReward> & rewards,
+                                          MDB_txn * txn)
+{
+    ApprovedEB prev;
+
+    // Retrieve the antepenultimate epoch to access
+    // each delegate's raw stake which determine
+    // to the rewards it earns for the current
+    // epoch.
+    if(_store.epoch_get(previous.previous, prev, txn))
     {
-        if(a.raw_stake != b.raw_stake)
+        return true;
+    }
+
+    // Sort the delegates according to stake, ties are
+    // broken by hash. Each delegate is hashed once
+    // rather than on every comparison.
+    std::array<BlockHash, NUM_DELEGATES> hashes;
+    std::array<uint8_t, NUM_DELEGATES> order;
+    for(uint8_t i = 0; i < NUM_DELEGATES; ++i)
+    {
+        hashes[i] = Blake2bHash(prev.delegates[i]);
+        order[i] = i;
+    }
+
+    auto stake_cmp = [&prev, &hashes](uint8_t a, uint8_t b)
+    {
+        if(prev.delegates[a].raw_stake != prev.delegates[b].raw_stake)
         {
-            return a.raw_stake > b.raw_stake;
+            return prev.delegates[a].raw_stake > prev.delegates[b].raw_stake;
         }
         else
         {
-            return Blake2bHash(a).number() > Blake2bHash(b).number();
+            return hashes[b] < hashes[a];
         }
     };
 
-    std::sort(std::begin(prev.delegates), std::end(prev.delegates), stake_cmp);
+    std::sort(std::begin(order), std::end(order), stake_cmp);
 
     auto acc_stake = [](const auto & a, const auto & b)
     {
@@ -520,7 +656,7 @@ void PersistenceManager<ECT>::ApplyRewards(const ApprovedEB & block, const Block
     // personal stake.
     for(int i = 0; i < NUM_DELEGATES; ++i)
     {
-        auto & d = prev.delegates[i];
+        auto & d = prev.delegates[order[i]];
 
         if(remaining_pool == 0)
         {
@@ -536,6 +672,25 @@ void PersistenceManager<ECT>::ApplyRewards(const ApprovedEB & block, const Block
         auto earnings = Rational(d.raw_stake.number(), total_stake.number()) * fee_pool.number();
         remaining_pool -= earnings;
 
+        Reward reward = Reward((earnings.numerator() / earnings.denominator()).convert_to<logos::uint128_t>(),
+                               Rational(earnings.numerator() % earnings.denominator(),
+                                        earnings.denominator()));
+
+        rewards.push_back({d.account, reward});
+    }
+
+    return false;
+}
+
+void PersistenceManager<ECT>::ApplyRewards(const ApprovedEB & block,
+                                           const BlockHash & hash,
+                                           const std::vector<EpochTransitionPlan::DelegateReward> & rewards,
+                                           MDB_txn * txn)
+{
+    for(size_t i = 0; i < rewards.size(); ++i)
+    {
+        auto & d = rewards[i];
+
         logos::account_info info;
         if(_store.account_get(d.account, info, txn))
         {
@@ -557,13 +712,9 @@ void PersistenceManager<ECT>::ApplyRewards(const ApprovedEB & block, const Block
             }
         };
 
-        Reward reward = Reward((earnings.numerator() / earnings.denominator()).convert_to<logos::uint128_t>(),
-                               Rational(earnings.numerator() % earnings.denominator(),
-                                        earnings.denominator()));
-
-        info.dust += std::get<1>(reward);
+        info.dust += std::get<1>(d.reward);
 
-        auto deposit_amount = std::get<0>(reward);
+        auto deposit_amount = std::get<0>(d.reward);
 
         if(info.dust.numerator() >= info.dust.denominator())
         {
@@ -613,8 +764,16 @@ void PersistenceManager<ECT>::UpdateGlobalRewards(const ApprovedEB & block, MDB_
             trace_and_halt();
         }
 
-        Amount new_logos = block.total_supply - previous.total_supply;
+        UpdateGlobalRewards(block, block.total_supply - previous.total_supply, txn);
+    }
+}
+
+void PersistenceManager<ECT>::UpdateGlobalRewards(const ApprovedEB & block, const Amount & new_logos, MDB_txn * txn)
+{
+    auto reward_manager = EpochRewardsManager::GetInstance();
 
+    if(reward_manager->GlobalRewardsAvailable(block.epoch_number, txn))
+    {
         reward_manager->SetGlobalReward(block.epoch_number,
                                         new_logos,
                                         txn);
@@ -5,11 +5,32 @@
 
 #include <logos/consensus/persistence/persistence_manager.hpp>
 #include <unordered_set>
+#include <mutex>
 
 static constexpr ConsensusType ECT = ConsensusType::Epoch;
 
 class Reservations;
 
+/// Epoch transition work that depends only on the epoch block and the
+/// epoch blocks preceding it.
+///
+/// The plan is computed when the epoch block is validated, ahead of its
+/// commit, so the commit's write transaction only updates the accounts
+/// and databases it has to.
+struct EpochTransitionPlan
+{
+    struct DelegateReward
+    {
+        AccountAddress account;
+        Reward         reward;  ///< whole and fractional fee pool share
+    };
+
+    BlockHash                   epoch_hash;
+    std::vector<AccountAddress> retiring;   ///< previous epoch's delegates not in this one
+    std::vector<DelegateReward> rewards;    ///< fee pool shares, in distribution order
+    Amount                      new_logos;  ///< logos issued since the previous epoch
+};
+
 template<>
 class PersistenceManager<ECT> : public Persistence
 {
@@ -74,7 +95,45 @@ public:
     void AddReelectionCandidates(uint32_t next_epoch_num, MDB_txn* txn);
     void TransitionCandidatesDBNextEpoch(MDB_txn* txn, uint32_t next_epoch_num);
     void UpdateThawing(ApprovedEB const & block, MDB_txn* txn);
+    void UpdateThawing(ApprovedEB const & block, const std::vector<AccountAddress> & retiring, MDB_txn* txn);
 
     void ApplyRewards(const ApprovedEB & block, const BlockHash & hash, MDB_txn* txn);
+    void ApplyRewards(const ApprovedEB & block,
+                      const BlockHash & hash,
+                      const std::vector<EpochTransitionPlan::DelegateReward> & rewards,
+                      MDB_txn* txn);
     void UpdateGlobalRewards(const ApprovedEB & block, MDB_txn* txn);
+    void UpdateGlobalRewards(const ApprovedEB & block, const Amount & new_logos, MDB_txn* txn);
+
+    /// Compute the transition plan of an epoch block
+    /// @param block epoch block [in]
+    /// @param hash hash of the epoch block [in]
+    /// @param plan receives the plan [out]
+    /// @param txn transaction to read through, optional [in]
+    /// @returns true if a preceding epoch block can't be read
+    bool PlanTransition(const Epoch & block, const BlockHash & hash, EpochTransitionPlan & plan, MDB_txn* txn = nullptr);
+
+    /// Compute the fee pool share of each delegate of the antepenultimate epoch
+    /// @param block epoch block [in]
+    /// @param previous epoch block preceding block [in]
+    /// @param rewards receives the shares in distribution order [out]
+    /// @param txn transaction to read through, optional [in]
+    /// @returns true if the antepenultimate epoch block can't be read
+    bool PlanRewards(const Epoch & block,
+                     const ApprovedEB & previous,
+                     std::vector<EpochTransitionPlan::DelegateReward> & rewards,
+                     MDB_txn* txn = nullptr);
+
+protected:
+
+    /// Compute and keep the plan of a validated epoch block for its commit
+    void PrepareTransition(const PrePrepare & message);
+
+    /// @returns the prepared plan of the epoch block, nullptr if there is none
+    std::shared_ptr<const EpochTransitionPlan> TakeTransitionPlan(const BlockHash & hash);
+
+private:
+
+    static std::mutex                                 _plan_mutex;
+    static std::shared_ptr<const EpochTransitionPlan> _plan;
 };
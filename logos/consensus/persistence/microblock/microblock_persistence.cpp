@@ -178,34 +178,39 @@ PersistenceManager<MBCT>::ApplyUpdates(
     const ApprovedMB & block,
     uint8_t)
 {
-    logos::transaction transaction(_store.environment, nullptr, true);
-
-    // See comments in request_persistence.cpp
-    if (BlockExists(block))
     {
-        LOG_DEBUG(_log) << "PersistenceManager<MBCT>::ApplyUpdates - micro block already exists, ignoring";
-        return;
-    }
+        logos::transaction transaction(_store.environment, nullptr, true);
 
-    BlockHash hash = block.Hash();
-    if( _store.micro_block_put(block, transaction) ||
-            _store.micro_block_tip_put(block.CreateTip(), transaction))
-    {
-        LOG_FATAL(_log) << "PersistenceManager<MBCT>::ApplyUpdates failed to put block or tip"
-                                << hash.to_string();
-        trace_and_halt();
-    }
+        // See comments in request_persistence.cpp
+        if (BlockExists(block))
+        {
+            LOG_DEBUG(_log) << "PersistenceManager<MBCT>::ApplyUpdates - micro block already exists, ignoring";
+            return;
+        }
 
-    if(_store.consensus_block_update_next(block.previous, hash, ConsensusType::MicroBlock, transaction))
-    {
-        LOG_FATAL(_log) << "PersistenceManager<MBCT>::ApplyUpdates failed to get previous block "
-                        << block.previous.to_string();
-        trace_and_halt();
+        BlockHash hash = block.Hash();
+        if( _store.micro_block_put(block, transaction) ||
+                _store.micro_block_tip_put(block.CreateTip(), transaction))
+        {
+            LOG_FATAL(_log) << "PersistenceManager<MBCT>::ApplyUpdates failed to put block or tip"
+                                    << hash.to_string();
+            trace_and_halt();
+        }
+
+        if(_store.consensus_block_update_next(block.previous, hash, ConsensusType::MicroBlock, transaction))
+        {
+            LOG_FATAL(_log) << "PersistenceManager<MBCT>::ApplyUpdates failed to get previous block "
+                            << block.previous.to_string();
+            trace_and_halt();
+        }
+        LOG_INFO(_log) << "PersistenceManager<MBCT>::ApplyUpdates hash: " << hash.to_string()
+                       << " previous " << block.previous.to_string();
+
+        logos_global::OnNewBlock<MBCT>(block);
     }
-    LOG_INFO(_log) << "PersistenceManager<MBCT>::ApplyUpdates hash: " << hash.to_string()
-                   << " previous " << block.previous.to_string();
 
-    logos_global::OnNewBlock<MBCT>(block);
+    // After commit, chains that aren't covered are read back from the database.
+    _store.micro_accumulator.Cut(block, _store);
 }
 
 bool PersistenceManager<MBCT>::BlockExists(
@@ -17,6 +17,26 @@
 #include <logos/node/websocket.hpp>
 
 std::mutex PersistenceManager<R>::_write_mutex;
+PersistenceManager<R>::ValidationContexts PersistenceManager<R>::_validation_contexts;
+std::deque<BlockHash> PersistenceManager<R>::_validation_context_order;
+constexpr size_t PersistenceManager<R>::MAX_VALIDATION_CONTEXTS;
+
+// Collect the reservations held by a request: its account and, for
+// Revoke and TokenSend, the source's token user id.
+static void AddReservations(std::shared_ptr<const Request> request, Reservations::Batch & batch)
+{
+    batch.emplace_back(request->GetAccount(), request->digest);
+
+    if(request->type == RequestType::Revoke || request->type == RequestType::TokenSend)
+    {
+        auto token_request = dynamic_pointer_cast<const TokenRequest>(request);
+        assert(token_request);
+
+        batch.emplace_back(GetTokenUserID(token_request->token_id,
+                                          token_request->GetSource()),
+                           request->digest);
+    }
+}
 
 // TODO: Dynamic can be changed to static if we do type validation
 //       in the constructors of ALL the request types.
@@ -62,6 +82,11 @@ void PersistenceManager<R>::ApplyUpdates(const ApprovedRB & message,
     // Ultimately we want to use the same global queue for direct consensus, P2P, and bootstrapping.
 
     std::lock_guard<std::mutex> lock (_write_mutex);
+
+    // Present if this node validated the block as a backup.
+    ValidationContext context;
+    TakeValidationContext(batch_hash, context);
+
     if (BlockExists(message))
     {
         LOG_DEBUG(_log) << "PersistenceManager<R>::ApplyUpdates - request block already exists, ignoring";
@@ -70,10 +95,7 @@ void PersistenceManager<R>::ApplyUpdates(const ApprovedRB & message,
         // for the same block (particularly if consensus is in p2p mode). 
         // Delegate would reserve when receiving the preprepare, but on
         // post-commit, the block already exists. Need to release reservation
-        for(uint16_t i = 0; i < message.requests.size(); ++i)
-        {
-            Release(message.requests[i]);
-        }
+        ReleaseReservations(message, context);
 
         return;
     }
@@ -97,32 +119,134 @@ void PersistenceManager<R>::ApplyUpdates(const ApprovedRB & message,
         //exists elsewhere
         logos::transaction transaction(_store.environment, nullptr, true);
         StoreRequestBlock(message, transaction, delegate_id);
-        ApplyRequestBlock(message, transaction);
+        ApplyRequestBlock(message, transaction, &context);
     }
 
+    _store.micro_accumulator.Add(delegate_id, message);
+
     // SYL Integration: clear reservation AFTER flushing to LMDB to ensure safety
-    for(uint16_t i = 0; i < message.requests.size(); ++i)
+    ReleaseReservations(message, context);
+}
+
+void PersistenceManager<R>::ReleaseReservations(const ApprovedRB & message,
+                                                ValidationContext & context)
+{
+    // Reuse the reservations collected during validation if every
+    // request of the block passed it.
+    Reservations::Batch reservations;
+    if(context.validated == message.requests.size())
     {
-        auto request = message.requests[i];
-        Release(request);
+        reservations.swap(context.reservations);
+    }
+    else
+    {
+        for(uint16_t i = 0; i < message.requests.size(); ++i)
+        {
+            AddReservations(message.requests[i], reservations);
+        }
     }
+    _reservations->Release(reservations);
 }
 
-void PersistenceManager<R>::Release(RequestPtr request)
+void PersistenceManager<R>::PutValidationContext(const BlockHash & hash,
+                                                 ValidationContext && context)
 {
-    _reservations->Release(request->GetAccount(),request->digest);
+    if(_validation_contexts.find(hash) == _validation_contexts.end())
+    {
+        _validation_context_order.push_back(hash);
+    }
+    _validation_contexts[hash] = std::move(context);
 
-    if(request->type == RequestType::Revoke || request->type == RequestType::TokenSend)
+    // Blocks that never commit, or commit elsewhere, age out.
+    while(_validation_context_order.size() > MAX_VALIDATION_CONTEXTS)
     {
-        auto token_request = dynamic_pointer_cast<const TokenRequest>(request);
-        assert(token_request);
+        _validation_contexts.erase(_validation_context_order.front());
+        _validation_context_order.pop_front();
+    }
+}
 
-        auto token_user_id = GetTokenUserID(token_request->token_id,
-                                            token_request->GetSource());
+bool PersistenceManager<R>::TakeValidationContext(const BlockHash & hash,
+                                                  ValidationContext & context)
+{
+    auto entry = _validation_contexts.find(hash);
+    if(entry == _validation_contexts.end())
+    {
+        return true;
+    }
 
-        // Also release the TokenUserID reservation.
-        _reservations->Release(token_user_id,request->digest);
+    context = std::move(entry->second);
+    _validation_contexts.erase(entry);
+    _validation_context_order.erase(std::find(_validation_context_order.begin(),
+                                              _validation_context_order.end(),
+                                              hash));
+    return false;
+}
+
+bool PersistenceManager<R>::GetAccount(const AccountAddress & address,
+                                       std::shared_ptr<logos::Account> & info,
+                                       ValidationContext * context)
+{
+    logos::mdb_val record;
+    if(_store.get(_store.account_db, logos::mdb_val(address), record, nullptr))
+    {
+        return true;
+    }
+
+    bool error = false;
+    info = DeserializeAccount(error, record);
+    if(!error && context)
+    {
+        auto data = reinterpret_cast<const uint8_t *>(record.data());
+        context->accounts[address] = {std::vector<uint8_t>(data, data + record.size()), info};
     }
+    return error;
+}
+
+bool PersistenceManager<R>::GetAccount(const AccountAddress & address,
+                                       std::shared_ptr<logos::Account> & info,
+                                       MDB_txn * transaction,
+                                       ValidationContext * context)
+{
+    logos::mdb_val record;
+    if(_store.get(_store.account_db, logos::mdb_val(address), record, transaction))
+    {
+        return true;
+    }
+
+    if(context)
+    {
+        auto validated = context->accounts.find(address);
+        if(validated != context->accounts.end())
+        {
+            // Requests applied since validation, e.g. a send to this
+            // account earlier in the block, change the record.
+            auto & recorded = validated->second.record;
+            auto data = reinterpret_cast<const uint8_t *>(record.data());
+            bool unchanged = recorded.size() == record.size() &&
+                             std::equal(recorded.begin(), recorded.end(), data);
+            if(unchanged)
+            {
+                info = validated->second.info;
+            }
+            context->accounts.erase(validated);
+            if(unchanged)
+            {
+                return false;
+            }
+        }
+    }
+
+    bool error = false;
+    info = DeserializeAccount(error, record);
+    return error;
+}
+
+void PersistenceManager<R>::Release(RequestPtr request)
+{
+    // Also releases the TokenUserID reservation of Revoke and TokenSend.
+    Reservations::Batch reservations;
+    AddReservations(request, reservations);
+    _reservations->Release(reservations);
 }
 
 bool PersistenceManager<R>::BlockExists(
@@ -179,7 +303,8 @@ bool PersistenceManager<R>::ValidateRequest(
     uint32_t cur_epoch_num,
     logos::process_return & result,
     bool allow_duplicates,
-    bool prelim)
+    bool prelim,
+    ValidationContext * context)
 {
     auto hash = request->GetHash();
     LOG_INFO(_log) << "PersistenceManager::ValidateRequest - validating request " << hash.to_string();
@@ -219,7 +344,7 @@ bool PersistenceManager<R>::ValidateRequest(
     std::shared_ptr<logos::Account> info;
 
     // The account doesn't exist
-    if (_store.account_get(request->GetAccount(), info))
+    if (GetAccount(request->GetAccount(), info, context))
     {
         // We can only get here if this is an administrative
         // token request, which means an invalid token ID
@@ -508,9 +633,10 @@ bool PersistenceManager<R>::ValidateSingleRequest(
 
 // Use this for batched transactions validation (either PrepareNextBatch or backup validation)
 bool PersistenceManager<R>::ValidateAndUpdate(
-    RequestPtr request, uint32_t cur_epoch_num, logos::process_return & result, bool allow_duplicates)
+    RequestPtr request, uint32_t cur_epoch_num, logos::process_return & result, bool allow_duplicates,
+    ValidationContext * context)
 {
-    auto success (ValidateRequest(request, cur_epoch_num, result, allow_duplicates, false));
+    auto success (ValidateRequest(request, cur_epoch_num, result, allow_duplicates, false, context));
 
     LOG_INFO(_log) << "PersistenceManager::ValidateAndUpdate - "
                    << "request is : " << request->Hash().to_string()
@@ -519,18 +645,16 @@ bool PersistenceManager<R>::ValidateAndUpdate(
 
     if (success)
     {
-        _reservations->UpdateReservation(request->GetHash(), request->GetAccount());
+        // Also updates the TokenUserID reservation of Revoke and TokenSend.
+        Reservations::Batch reservations;
+        AddReservations(request, reservations);
+        _reservations->UpdateReservations(reservations);
 
-        if(request->type == RequestType::Revoke || request->type == RequestType::TokenSend)
+        if(context)
         {
-            auto token_request = dynamic_pointer_cast<const TokenRequest>(request);
-            assert(token_request);
-
-            auto token_user_id = GetTokenUserID(token_request->token_id,
-                                                token_request->GetSource());
-
-            // Also update the TokenUserID reservation.
-            _reservations->UpdateReservation(request->GetHash(), token_user_id);
+            context->reservations.insert(context->reservations.end(),
+                                         reservations.begin(), reservations.end());
+            ++context->validated;
         }
     }
 
@@ -545,12 +669,15 @@ bool PersistenceManager<R>::ValidateBatch(
     bool need_bootstrap = false;
     logos::process_return ignored_result;
     std::lock_guard<std::mutex> lock (_write_mutex);
+    // Validate the whole batch against one read snapshot.
+    logos::read_snapshot snapshot(_store.environment);
+    ValidationContext context;
     for(uint64_t i = 0; i < message.requests.size(); ++i)
     {
 #ifdef TEST_REJECT
-        if(!ValidateAndUpdate(message.requests[i], message.epoch_number, ignored_result, true) || bool(message.requests[i].hash().number() & 1))
+        if(!ValidateAndUpdate(message.requests[i], message.epoch_number, ignored_result, true, &context) || bool(message.requests[i].hash().number() & 1))
 #else
-        if(!ValidateAndUpdate(message.requests[i], message.epoch_number, ignored_result, true))
+        if(!ValidateAndUpdate(message.requests[i], message.epoch_number, ignored_result, true, &context))
 #endif
         {
             LOG_WARN(_log) << "PersistenceManager<R>::Validate - Rejecting " << message.requests[i]->GetHash().to_string();
@@ -569,6 +696,9 @@ bool PersistenceManager<R>::ValidateBatch(
             }
         }
     }
+    // Reused by ApplyUpdates if this block commits unchanged.
+    PutValidationContext(message.Hash(), std::move(context));
+
     if(need_bootstrap)
     {
     	// TODO: high speed Bootstrapping
@@ -588,7 +718,10 @@ bool PersistenceManager<R>::Validate(const PrePrepare & message,
     if (!status || status->progress < RVP_REQUESTS_DONE)
     {
         bool valid = true;
-        std::lock_guard<std::mutex> lock (_write_mutex);
+        // No _write_mutex: a block is applied in a single write transaction,
+        // so the snapshot sees either all or none of it. This lets BlockCache
+        // validate blocks of different delegate chains concurrently.
+        logos::read_snapshot snapshot(_store.environment);
 
         for(uint16_t i = 0; i < message.requests.size(); ++i)
         {
@@ -965,7 +1098,8 @@ void PersistenceManager<R>::StoreRequestBlock(const ApprovedRB & message,
 
 void PersistenceManager<R>::ApplyRequestBlock(
     const ApprovedRB & message,
-    MDB_txn * transaction)
+    MDB_txn * transaction,
+    ValidationContext * context)
 {
     for(uint16_t i = 0; i < message.requests.size(); ++i)
     {
@@ -975,21 +1109,23 @@ void PersistenceManager<R>::ApplyRequestBlock(
         ApplyRequest(message.requests[i],
                      message.timestamp,
                      message.epoch_number,
-                     transaction);
+                     transaction,
+                     context);
     }
 }
 
 void PersistenceManager<R>::ApplyRequest(RequestPtr request,
                                          uint64_t timestamp,
                                          uint32_t cur_epoch_num,
-                                         MDB_txn * transaction)
+                                         MDB_txn * transaction,
+                                         ValidationContext * context)
 {
 
     LOG_INFO(_log) << "PersistenceManager::ApplyRequest -"
                    << request->Hash().to_string();
 
     std::shared_ptr<logos::Account> info;
-    auto account_error(_store.account_get(request->GetAccount(), info, transaction));
+    auto account_error(GetAccount(request->GetAccount(), info, transaction, context));
 
     if(account_error)
     {
@@ -1807,6 +1943,23 @@ void PersistenceManager<R>::ApplySend(const Transaction<AmountType> &send,
     }
 }
 
+void PersistenceManager<R>::PutGovernanceCheckpoint(const Governance & request, MDB_txn * transaction)
+{
+    if(!GovernanceCheckpoint::IsCheckpointed(request.type))
+    {
+        return;
+    }
+
+    // A later request of the same epoch replaces the checkpoint.
+    if(_store.governance_checkpoint_put(request.origin, request.epoch_num, GovernanceCheckpoint(request), transaction))
+    {
+        LOG_FATAL(_log) << "PersistenceManager::PutGovernanceCheckpoint - "
+                        << "Failed to store checkpoint for account: "
+                        << request.origin.to_string();
+        trace_and_halt();
+    }
+}
+
 void PersistenceManager<R>::ApplyRequest(
         const StartRepresenting& request,
         logos::account_info& info,
@@ -1817,6 +1970,7 @@ void PersistenceManager<R>::ApplyRequest(
     RepInfo rep(request);
     assert(!_store.rep_put(request.origin,rep,txn));
     assert(!_store.request_put(request,txn));
+    PutGovernanceCheckpoint(request, txn);
 
     if(request.set_stake)
     {
@@ -1844,6 +1998,7 @@ void PersistenceManager<R>::ApplyRequest(
     assert(!_store.rep_put(request.origin,rep,txn));
     assert(!_store.rep_mark_remove(request.origin, txn));
     assert(!_store.request_put(request,txn));
+    PutGovernanceCheckpoint(request, txn);
     if(request.set_stake)
     {
         StakingManager::GetInstance()->Stake(
@@ -1950,6 +2105,7 @@ void PersistenceManager<R>::ApplyRequest(
         assert(!_store.candidate_put(request.origin,candidate,txn));
     }
     assert(!_store.request_put(request,txn));
+    PutGovernanceCheckpoint(request, txn);
     if(request.set_stake)
     {
         StakingManager::GetInstance()->Stake(
@@ -2014,6 +2170,7 @@ void PersistenceManager<R>::ApplyRequest(
     {
         trace_and_halt();
     }
+    PutGovernanceCheckpoint(request, txn);
     StakingManager::GetInstance()->Stake(
             request.origin,
             info,
@@ -2892,6 +3049,199 @@ Reward PersistenceManager<R>::ProcessClaim(const std::shared_ptr<const Claim> cl
 
     Rational sum = 0;
 
+    // Update the state of the account to determine
+    // how to harvest rewards for epochs in the range
+    // [base + 1, peak].
+    auto update_state = [&](RequestType type, const AccountAddress & rep, const Amount & lock_proxy)
+    {
+        switch(type)
+        {
+            case RequestType::Proxy:
+            {
+                if(lock_proxy.is_zero())
+                {
+                    current_rep = {0};
+                    staked = {0};
+                }
+                else
+                {
+                    current_rep = rep;
+                    staked = lock_proxy;
+                }
+
+                is_rep = false;
+
+                break;
+            }
+            case RequestType::AnnounceCandidacy:
+            case RequestType::StartRepresenting:
+                current_rep = {0};
+                is_rep = true;
+                break;
+            case RequestType::StopRepresenting:
+                is_rep = false;
+                break;
+            default:
+                LOG_FATAL(_log) << "Unexpected message type encountered in governance subchain:"
+                                << GetRequestTypeField(type);
+                trace_and_halt();
+        }
+    };
+
+    auto harvest = [&](uint32_t base)
+    {
+        bool has_rep = !current_rep.is_zero();
+
+        // The account has a representative and is
+        // a representative. Should never occur.
+        if(has_rep && is_rep)
+        {
+            LOG_FATAL(_log) << "PersistenceManager::ProcessClaim - "
+                            << "Inconsistent account state while processing "
+                            << "claim for account: "
+                            << claim->origin.to_account();
+            trace_and_halt();
+        }
+
+        // There may be rewards to harvest for
+        // the epoch.
+        if(has_rep || is_rep)
+        {
+
+            auto rewards_manager = EpochRewardsManager::GetInstance();
+
+            // Iterate over all the epochs affected by the
+            // user's current status.
+            for(uint32_t epoch = base + 1; epoch <= peak; ++epoch)
+            {
+
+                // Rewards from this epoch have already
+                // been claimed.
+                if(epoch <= info.claim_epoch)
+                {
+                    continue;
+                }
+
+                auto rep_address = [&]()
+                {
+                    if(is_rep)
+                    {
+                        return claim->origin;
+                    }
+
+                    return current_rep;
+                };
+
+                // This rep participated in voting for the epoch and
+                // is therefore entitled to rewards.
+                if(rewards_manager->RewardsAvailable(rep_address(), epoch, transaction))
+                {
+                    auto rep_info = rewards_manager->GetRewardsInfo(rep_address(), epoch, transaction);
+
+                    // This rep's portion of global rewards hasn't
+                    // yet been determined.
+                    if(!rep_info.initialized)
+                    {
+
+                        // There are still global rewards available
+                        // to distribute to this rep.
+                        if(rewards_manager->GlobalRewardsAvailable(epoch, transaction))
+                        {
+                            auto global_info = rewards_manager->GetGlobalRewardsInfo(epoch,
+                                                                                     transaction);
+
+                            auto rep_pool = Rational(rep_info.total_stake.number(),
+                                                     global_info.total_stake.number()) * global_info.total_reward.number();
+
+                            rewards_manager->HarvestGlobalReward(epoch,
+                                                                 rep_pool,
+                                                                 global_info,
+                                                                 transaction);
+
+                            rep_info.total_reward = rep_pool;
+                            rep_info.remaining_reward = rep_pool;
+                        }
+
+                        else
+                        {
+                            LOG_FATAL(_log) << "PersistenceManager::ProcessClaim - "
+                                            << "No global rewards available for uninitialized "
+                                            << "rep reward pool. Rep address: "
+                                            << rep_address().to_account();
+                            trace_and_halt();
+                        }
+
+                        rep_info.initialized = true;
+                    }
+
+                    // This manipulates the stake amounts used in determining
+                    // rep and locked proxy rewards in order to adhere to the
+                    // prescribed levy_percentage.
+                    auto self_stake = [&]()
+                    {
+                        logos::uint256_t hecto = 100;
+                        logos::uint256_t result;
+
+                        if(is_rep)
+                        {
+                            logos::uint256_t factor = hecto - rep_info.levy_percentage;
+                            logos::uint256_t proxy_stake = rep_info.total_stake.number() - rep_info.self_stake.number();
+
+                            result = rep_info.self_stake.number() +
+                                     ((factor * proxy_stake) / 100);
+                        }
+
+                        else
+                        {
+                            result = (logos::uint256_t(staked.number()) *
+                                      logos::uint256_t(rep_info.levy_percentage)) / hecto;
+                        }
+
+                        return result.convert_to<logos::uint128_t>();
+                    };
+
+                    auto reward = Rational(self_stake(), rep_info.total_stake.number()) * rep_info.total_reward;
+
+                    rewards_manager->HarvestReward(rep_address(),
+                                                   epoch,
+                                                   reward,
+                                                   rep_info,
+                                                   transaction);
+
+                    // Finally, update the sum with the
+                    // earnings from this epoch.
+                    sum += reward;
+                }
+            }
+        }
+    };
+
+    // Checkpoints hold the state set by the account's last rep or proxy
+    // changing request of each epoch, which is the request the walk
+    // below would pick for that epoch, so follow them while they're
+    // complete.
+    auto checkpoint_start = _store.governance_checkpoint_start(transaction);
+    GovernanceCheckpoint checkpoint;
+    uint32_t checkpoint_epoch;
+
+    while(peak > info.claim_epoch
+          && !_store.governance_checkpoint_get_prior(claim->origin, peak, checkpoint_epoch, checkpoint, transaction)
+          && checkpoint_epoch >= checkpoint_start)
+    {
+        update_state(checkpoint.type, checkpoint.rep, checkpoint.lock_proxy);
+        harvest(checkpoint_epoch);
+
+        peak = checkpoint_epoch;
+        current_hash = checkpoint.previous;
+    }
+
+    // Requests applied before checkpoints were kept are found by walking
+    // the governance subchain.
+    if(!checkpoint_start)
+    {
+        current_hash.clear();
+    }
+
     auto advance_chain = [&]()
     {
         current_hash = dynamic_pointer_cast<Governance>(current_request)->governance_subchain_prev;
@@ -2914,10 +3264,6 @@ Reward PersistenceManager<R>::ProcessClaim(const std::shared_ptr<const Claim> cl
         // rewards in epoch base + 1;
         if(base < peak)
         {
-
-            // Update the state of the account to determine
-            // how to harvest rewards for epochs in the range
-            // [base + 1, peak].
             switch(current_request->type)
             {
                 case RequestType::Proxy:
@@ -2925,164 +3271,20 @@ Reward PersistenceManager<R>::ProcessClaim(const std::shared_ptr<const Claim> cl
                     auto proxy = dynamic_pointer_cast<Proxy>(current_request);
                     assert(proxy);
 
-                    if(proxy->lock_proxy.is_zero())
-                    {
-                        current_rep = {0};
-                        staked = {0};
-                    }
-                    else
-                    {
-                        current_rep = proxy->rep;
-                        staked = proxy->lock_proxy;
-                    }
-
-                    is_rep = false;
-
+                    update_state(proxy->type, proxy->rep, proxy->lock_proxy);
                     break;
                 }
-                case RequestType::AnnounceCandidacy:
-                case RequestType::StartRepresenting:
-                    current_rep = {0};
-                    is_rep = true;
-                    break;
-                case RequestType::StopRepresenting:
-                    is_rep = false;
-                    break;
                 case RequestType::Stake:
                 case RequestType::Unstake:
                 case RequestType::ElectionVote:
                 case RequestType::RenounceCandidacy:
                     continue;
                 default:
-                    LOG_FATAL(_log) << "Unexpected message type encountered in governance subchain:"
-                                    << GetRequestTypeField(current_request->type);
-                    trace_and_halt();
-            }
-
-            bool has_rep = !current_rep.is_zero();
-
-            // The account has a representative and is
-            // a representative. Should never occur.
-            if(has_rep && is_rep)
-            {
-                LOG_FATAL(_log) << "PersistenceManager::ProcessClaim - "
-                                << "Inconsistent account state while processing "
-                                << "claim for account: "
-                                << claim->origin.to_account();
-                trace_and_halt();
+                    update_state(current_request->type, 0, 0);
+                    break;
             }
 
-            // There may be rewards to harvest for
-            // the epoch.
-            if(has_rep || is_rep)
-            {
-
-                auto rewards_manager = EpochRewardsManager::GetInstance();
-
-                // Iterate over all the epochs affected by the
-                // user's current status.
-                for(uint32_t epoch = base + 1; epoch <= peak; ++epoch)
-                {
-
-                    // Rewards from this epoch have already
-                    // been claimed.
-                    if(epoch <= info.claim_epoch)
-                    {
-                        continue;
-                    }
-
-                    auto rep_address = [&]()
-                    {
-                        if(is_rep)
-                        {
-                            return claim->origin;
-                        }
-
-                        return current_rep;
-                    };
-
-                    // This rep participated in voting for the epoch and
-                    // is therefore entitled to rewards.
-                    if(rewards_manager->RewardsAvailable(rep_address(), epoch, transaction))
-                    {
-                        auto rep_info = rewards_manager->GetRewardsInfo(rep_address(), epoch, transaction);
-
-                        // This rep's portion of global rewards hasn't
-                        // yet been determined.
-                        if(!rep_info.initialized)
-                        {
-
-                            // There are still global rewards available
-                            // to distribute to this rep.
-                            if(rewards_manager->GlobalRewardsAvailable(epoch, transaction))
-                            {
-                                auto global_info = rewards_manager->GetGlobalRewardsInfo(epoch,
-                                                                                         transaction);
-
-                                auto rep_pool = Rational(rep_info.total_stake.number(),
-                                                         global_info.total_stake.number()) * global_info.total_reward.number();
-
-                                rewards_manager->HarvestGlobalReward(epoch,
-                                                                     rep_pool,
-                                                                     global_info,
-                                                                     transaction);
-
-                                rep_info.total_reward = rep_pool;
-                                rep_info.remaining_reward = rep_pool;
-                            }
-
-                            else
-                            {
-                                LOG_FATAL(_log) << "PersistenceManager::ProcessClaim - "
-                                                << "No global rewards available for uninitialized "
-                                                << "rep reward pool. Rep address: "
-                                                << rep_address().to_account();
-                                trace_and_halt();
-                            }
-
-                            rep_info.initialized = true;
-                        }
-
-                        // This manipulates the stake amounts used in determining
-                        // rep and locked proxy rewards in order to adhere to the
-                        // prescribed levy_percentage.
-                        auto self_stake = [&]()
-                        {
-                            logos::uint256_t hecto = 100;
-                            logos::uint256_t result;
-
-                            if(is_rep)
-                            {
-                                logos::uint256_t factor = hecto - rep_info.levy_percentage;
-                                logos::uint256_t proxy_stake = rep_info.total_stake.number() - rep_info.self_stake.number();
-
-                                result = rep_info.self_stake.number() +
-                                         ((factor * proxy_stake) / 100);
-                            }
-
-                            else
-                            {
-                                result = (logos::uint256_t(staked.number()) *
-                                          logos::uint256_t(rep_info.levy_percentage)) / hecto;
-                            }
-
-                            return result.convert_to<logos::uint128_t>();
-                        };
-
-                        auto reward = Rational(self_stake(), rep_info.total_stake.number()) * rep_info.total_reward;
-
-                        rewards_manager->HarvestReward(rep_address(),
-                                                       epoch,
-                                                       reward,
-                                                       rep_info,
-                                                       transaction);
-
-                        // Finally, update the sum with the
-                        // earnings from this epoch.
-                        sum += reward;
-                    }
-                }
-            }
+            harvest(base);
 
             peak = base;
         }
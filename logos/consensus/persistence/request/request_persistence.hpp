@@ -4,9 +4,13 @@
 #pragma once
 
 #include <logos/consensus/persistence/persistence_manager.hpp>
+#include <logos/consensus/persistence/reservations.hpp>
 #include <logos/epoch/epoch_handler.hpp>
 #include <logos/rewards/claim.hpp>
 
+#include <deque>
+#include <unordered_map>
+
 const ConsensusType R = ConsensusType::Request;
 
 using boost::multiprecision::uint128_t;
@@ -37,6 +41,25 @@ protected:
 
     public:
 
+    /// State read while a backup validates a PrePrepare, reused when the
+    /// same block is applied after post-commit. An account is reused only
+    /// if its serialized record hasn't changed since, otherwise it is read
+    /// and decoded again.
+    struct ValidationContext
+    {
+        struct ValidatedAccount
+        {
+            std::vector<uint8_t>            record; ///< serialized account as validated
+            std::shared_ptr<logos::Account> info;   ///< decoded from record, read only during validation
+        };
+
+        std::unordered_map<AccountAddress, ValidatedAccount> accounts;
+        Reservations::Batch                                  reservations; ///< of the requests validated
+        uint16_t                                             validated = 0;
+    };
+
+    static constexpr size_t MAX_VALIDATION_CONTEXTS = 64;
+
     PersistenceManager(
             Store & store,
             ReservationsPtr reservations,
@@ -56,7 +79,8 @@ protected:
             uint32_t cur_epoch_num,
             logos::process_return & result,
             bool allow_duplicates = true,
-            bool prelim = false);
+            bool prelim = false,
+            ValidationContext * context = nullptr);
 
     virtual bool ValidateSingleRequest(
             RequestPtr request,
@@ -68,7 +92,8 @@ protected:
             RequestPtr request,
             uint32_t cur_epoch_num,
             logos::process_return & result,
-            bool allow_duplicates = true);
+            bool allow_duplicates = true,
+            ValidationContext * context = nullptr);
 
     bool ValidateBatch(const PrePrepare & message, RejectionMap & rejection_map);
 
@@ -178,7 +203,8 @@ protected:
     void ApplyRequest(RequestPtr request,
                       uint64_t timestamp,
                       uint32_t cur_epoch_num,
-                      MDB_txn * transaction);
+                      MDB_txn * transaction,
+                      ValidationContext * context = nullptr);
 
     void Release(RequestPtr request);
 
@@ -200,7 +226,29 @@ private:
             const Amount & token_total);
 
     void ApplyRequestBlock(const ApprovedRB & message,
-            MDB_txn * transaction);
+            MDB_txn * transaction,
+            ValidationContext * context = nullptr);
+
+    /// Get a request's account while validating it, recording it in context
+    bool GetAccount(const AccountAddress & address,
+                    std::shared_ptr<logos::Account> & info,
+                    ValidationContext * context);
+
+    /// Get a request's account while applying it, reusing the one recorded
+    /// in context if it is unchanged
+    bool GetAccount(const AccountAddress & address,
+                    std::shared_ptr<logos::Account> & info,
+                    MDB_txn * transaction,
+                    ValidationContext * context);
+
+    /// Keep the context of a validated block, evicting the oldest
+    static void PutValidationContext(const BlockHash & hash, ValidationContext && context);
+
+    /// Take the context of a block being applied, returns true if none
+    static bool TakeValidationContext(const BlockHash & hash, ValidationContext & context);
+
+    /// Release the reservations of a block's requests
+    void ReleaseReservations(const ApprovedRB & message, ValidationContext & context);
 
 
     template<typename SendType>
@@ -238,7 +286,14 @@ private:
                         logos::account_info & info,
                         MDB_txn * transaction);
 
-    Log               _log;
-    ReservationsPtr   _reservations;
-    static std::mutex _write_mutex;
+    /// Record the request's rep and proxy state for claims, if it changes it
+    void PutGovernanceCheckpoint(const Governance & request, MDB_txn * transaction);
+
+    using ValidationContexts = std::unordered_map<BlockHash, ValidationContext>;
+
+    Log                              _log;
+    ReservationsPtr                  _reservations;
+    static std::mutex                _write_mutex;
+    static ValidationContexts        _validation_contexts;       ///< guarded by _write_mutex
+    static std::deque<BlockHash>     _validation_context_order;  ///< oldest first
 };
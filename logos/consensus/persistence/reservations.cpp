@@ -5,18 +5,78 @@
 #include <logos/consensus/consensus_container.hpp>
 #include <logos/node/node.hpp>
 
-ReservationCache Reservations::_cache;
+constexpr size_t Reservations::STRIPES;
+std::array<Reservations::Stripe, Reservations::STRIPES> Reservations::_stripes;
+
+Reservations::Stripe &
+Reservations::GetStripe(const AccountAddress & account)
+{
+    // std::hash<uint256_union> uses the leading bytes, which also pick
+    // the bucket within the stripe's map; use a trailing byte instead.
+    return _stripes[account.bytes.back() % STRIPES];
+}
+
+void
+Reservations::GroupByStripe(const Batch & batch, StripeIndices & indices)
+{
+    for(size_t i = 0; i < batch.size(); ++i)
+    {
+        indices[batch[i].first.bytes.back() % STRIPES].push_back(i);
+    }
+}
+
+void
+Reservations::CanAcquire(const Batch & batch,
+                         bool allow_duplicates,
+                         std::vector<bool> & results)
+{
+    results.assign(batch.size(), false);
+    for(size_t i = 0; i < batch.size(); ++i)
+    {
+        results[i] = CanAcquire(batch[i].first, batch[i].second, allow_duplicates);
+    }
+}
 
 void
 Reservations::Release(
         const AccountAddress & account, const BlockHash& hash)
 {
-    auto iter = _cache.find(account);
-    if(iter!= _cache.end())
+    auto & stripe = GetStripe(account);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    ReleaseLocked(stripe, account, hash);
+}
+
+void
+Reservations::Release(const Batch & batch)
+{
+    StripeIndices indices;
+    GroupByStripe(batch, indices);
+
+    for(size_t s = 0; s < STRIPES; ++s)
+    {
+        if(indices[s].empty())
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(_stripes[s].mutex);
+        for(auto i : indices[s])
+        {
+            ReleaseLocked(_stripes[s], batch[i].first, batch[i].second);
+        }
+    }
+}
+
+void
+Reservations::ReleaseLocked(
+        Stripe & stripe, const AccountAddress & account, const BlockHash& hash)
+{
+    auto iter = stripe.cache.find(account);
+    if(iter!= stripe.cache.end())
     {
         if(iter->second.reservation == hash)
         {
-            _cache.erase(account);
+            stripe.cache.erase(iter);
         }
         else
         {
@@ -27,7 +87,7 @@ Reservations::Release(
                 << ", hash attempting to release = "
                 << hash.to_string()
                 << ", account = " << account.to_string();
-        
+
         }
     }
 }
@@ -38,11 +98,76 @@ bool
 ConsensusReservations::CanAcquire(const AccountAddress & account,
                                   const BlockHash & hash,
                                   bool allow_duplicates)
+{
+    bool bootstrap = false;
+    bool result;
+    {
+        auto & stripe = GetStripe(account);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        result = CanAcquireLocked(stripe, account, hash, allow_duplicates,
+                                  ConsensusContainer::GetCurEpochNumber(), bootstrap);
+    }
+
+    if(bootstrap)
+    {
+        // Check bootstrap since we might have died and now fallen behind
+        // TODO: high speed Bootstrapping
+        LOG_DEBUG(_log) << "ConsensusReservations::CanAcquire"
+                        << " Try Bootstrap...";
+        logos_global::Bootstrap();
+    }
+
+    return result;
+}
+
+void
+ConsensusReservations::CanAcquire(const Batch & batch,
+                                  bool allow_duplicates,
+                                  std::vector<bool> & results)
+{
+    StripeIndices indices;
+    GroupByStripe(batch, indices);
+    results.assign(batch.size(), false);
+
+    auto current_epoch = ConsensusContainer::GetCurEpochNumber();
+    bool bootstrap = false;
+
+    for(size_t s = 0; s < STRIPES; ++s)
+    {
+        if(indices[s].empty())
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(_stripes[s].mutex);
+        for(auto i : indices[s])
+        {
+            results[i] = CanAcquireLocked(_stripes[s], batch[i].first, batch[i].second,
+                                          allow_duplicates, current_epoch, bootstrap);
+        }
+    }
+
+    if(bootstrap)
+    {
+        LOG_DEBUG(_log) << "ConsensusReservations::CanAcquire"
+                        << " Try Bootstrap...";
+        logos_global::Bootstrap();
+    }
+}
+
+bool
+ConsensusReservations::CanAcquireLocked(Stripe & stripe,
+                                        const AccountAddress & account,
+                                        const BlockHash & hash,
+                                        bool allow_duplicates,
+                                        uint32_t current_epoch,
+                                        bool & bootstrap)
 {
     logos::reservation_info info;
 
     // Check cache
-    if(_cache.find(account) == _cache.end())
+    auto iter = stripe.cache.find(account);
+    if(iter == stripe.cache.end())
     {
         // Not in LMDB either
         if (_store.reservation_get(account, info))
@@ -51,12 +176,9 @@ ConsensusReservations::CanAcquire(const AccountAddress & account,
         }
         else // populate cache with database reservation
         {
-            _cache[account] = info;
-            // Check bootstrap since we might have died and now fallen behind
-            // TODO: high speed Bootstrapping
-            LOG_DEBUG(_log) << "ConsensusReservations::CanAcquire"
-                        << " Try Bootstrap...";
-            logos_global::Bootstrap();
+            stripe.cache[account] = info;
+            // The caller bootstraps once the stripe is unlocked.
+            bootstrap = true;
             return false;
         }
     }
@@ -69,13 +191,12 @@ ConsensusReservations::CanAcquire(const AccountAddress & account,
                        << account.to_string()
                        << " which is already in the Reservations cache.";
 
-        info = _cache[account];
+        info = iter->second;
     }
 
     // Reservation exists
     if (info.reservation != hash)
     {
-        uint32_t current_epoch = ConsensusContainer::GetCurEpochNumber();
         // Return false if this block conflicts with an existing reservation that hasn't expired.
         // If account info check succeeds, it will be reserved later in UpdateReservation.
         return current_epoch >= info.reservation_epoch + PersistenceManager<R>::RESERVATION_PERIOD;
@@ -90,17 +211,50 @@ void
 ConsensusReservations::UpdateReservation(const BlockHash & hash,
                                          const AccountAddress & account)
 {
-    uint32_t current_epoch = ConsensusContainer::GetCurEpochNumber();
+    auto & stripe = GetStripe(account);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    UpdateReservationLocked(stripe, hash, account, ConsensusContainer::GetCurEpochNumber());
+}
+
+void
+ConsensusReservations::UpdateReservations(const Batch & batch)
+{
+    StripeIndices indices;
+    GroupByStripe(batch, indices);
+
+    auto current_epoch = ConsensusContainer::GetCurEpochNumber();
 
-    if(_cache.find(account) != _cache.end() &&
-           _cache[account].reservation != hash)
+    for(size_t s = 0; s < STRIPES; ++s)
+    {
+        if(indices[s].empty())
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(_stripes[s].mutex);
+        for(auto i : indices[s])
+        {
+            UpdateReservationLocked(_stripes[s], batch[i].second, batch[i].first, current_epoch);
+        }
+    }
+}
+
+void
+ConsensusReservations::UpdateReservationLocked(Stripe & stripe,
+                                               const BlockHash & hash,
+                                               const AccountAddress & account,
+                                               uint32_t current_epoch)
+{
+    auto iter = stripe.cache.find(account);
+    if(iter != stripe.cache.end() &&
+           iter->second.reservation != hash)
     {
-        if (_cache[account].reservation_epoch + PersistenceManager<R>::RESERVATION_PERIOD > current_epoch)
+        if (iter->second.reservation_epoch + PersistenceManager<R>::RESERVATION_PERIOD > current_epoch)
         {
             LOG_FATAL(_log) << "ConsensusReservations::UpdateReservation - update called before reservation epoch expiration!";
             trace_and_halt();
         }
     }
     logos::reservation_info updated_reservation {hash, current_epoch};
-    _cache[account] = updated_reservation;
+    stripe.cache[account] = updated_reservation;
 }
@@ -7,6 +7,10 @@
 #include <logos/common.hpp>
 
 #include <unordered_map>
+#include <utility>
+#include <vector>
+#include <array>
+#include <mutex>
 
 namespace
 {
@@ -27,6 +31,15 @@ protected:
 
 public:
 
+    /// An account (or token user id) and the hash reserving it.
+    using Reservation = std::pair<AccountAddress, BlockHash>;
+    using Batch       = std::vector<Reservation>;
+
+    /// The cache is split into independently locked stripes so that
+    /// concurrent validation and persistence of unrelated accounts
+    /// don't serialize on a single lock.
+    static constexpr size_t STRIPES = 64;
+
     explicit Reservations(Store & store)
         : _store(store)
     {}
@@ -36,16 +49,50 @@ public:
                             const BlockHash & hash,
                             bool allow_duplicates) {return true;}
 
+    /// Check a batch of reservations, e.g. those of a whole PrePrepare,
+    /// locking each stripe once.
+    ///     @param batch reservations to check
+    ///     @param allow_duplicates whether a matching reservation may be reacquired
+    ///     @param results receives the CanAcquire result of each entry [out]
+    virtual void CanAcquire(const Batch & batch,
+                            bool allow_duplicates,
+                            std::vector<bool> & results);
+
     virtual void Release(const AccountAddress & account,
                          const BlockHash& hash);
 
+    /// Release a batch of reservations, locking each stripe once.
+    virtual void Release(const Batch & batch);
+
     virtual void UpdateReservation(const BlockHash & hash,
                                    const AccountAddress & account) {}
+
+    /// Update a batch of reservations, in order, locking each stripe once.
+    virtual void UpdateReservations(const Batch & batch) {}
+
 protected:
 
-    static ReservationCache _cache;
-    Store &                 _store;
-    Log                     _log;
+    struct Stripe
+    {
+        std::mutex       mutex;
+        ReservationCache cache;
+    };
+
+    using StripeIndices = std::array<std::vector<size_t>, STRIPES>;
+
+    /// @returns the stripe holding the account's reservation
+    static Stripe & GetStripe(const AccountAddress & account);
+
+    /// Group the entries of a batch by stripe, preserving their order.
+    static void GroupByStripe(const Batch & batch, StripeIndices & indices);
+
+    void ReleaseLocked(Stripe & stripe,
+                       const AccountAddress & account,
+                       const BlockHash & hash);
+
+    static std::array<Stripe, STRIPES> _stripes;
+    Store &                            _store;
+    Log                                _log;
 };
 
 class ConsensusReservations : public Reservations
@@ -77,8 +124,29 @@ public:
                     const BlockHash & hash,
                     bool allow_duplicates) override;
 
+    void CanAcquire(const Batch & batch,
+                    bool allow_duplicates,
+                    std::vector<bool> & results) override;
+
     // Can only be called after checking CanAcquire to ensure we don't corrupt reservation
     void UpdateReservation(const BlockHash & hash,
                            const AccountAddress & account) override;
 
+    void UpdateReservations(const Batch & batch) override;
+
+private:
+
+    /// CanAcquire with the account's stripe locked.
+    ///     @param bootstrap set if the reservation was only found in the database [out]
+    bool CanAcquireLocked(Stripe & stripe,
+                          const AccountAddress & account,
+                          const BlockHash & hash,
+                          bool allow_duplicates,
+                          uint32_t current_epoch,
+                          bool & bootstrap);
+
+    void UpdateReservationLocked(Stripe & stripe,
+                                 const BlockHash & hash,
+                                 const AccountAddress & account,
+                                 uint32_t current_epoch);
 };
@@ -0,0 +1,94 @@
+/// @file
+/// This file contains the implementation of ValidationPool.
+
+#include <logos/consensus/persistence/validation_pool.hpp>
+
+ValidationPool::ValidationPool(unsigned threads)
+{
+    for(unsigned i = 1; i < threads; ++i)
+    {
+        _threads.emplace_back([this](){ Worker(); });
+    }
+}
+
+ValidationPool::~ValidationPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+    }
+    _start.notify_all();
+
+    for(auto & thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+void ValidationPool::Run(size_t count, const Task & task)
+{
+    std::lock_guard<std::mutex> run_lock(_run_mutex);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _task = &task;
+        _count = count;
+        _next = 0;
+        _finished = 0;
+        ++_generation;
+    }
+    _start.notify_all();
+
+    Work();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done.wait(lock, [this](){ return _finished == _count; });
+    _task = nullptr;
+}
+
+void ValidationPool::Worker()
+{
+    uint64_t generation = 0;
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while(true)
+    {
+        _start.wait(lock, [this, generation](){ return _stopped || _generation != generation; });
+        if(_stopped)
+        {
+            return;
+        }
+
+        generation = _generation;
+        lock.unlock();
+        Work();
+        lock.lock();
+    }
+}
+
+void ValidationPool::Work()
+{
+    while(true)
+    {
+        const Task * task;
+        size_t index;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(!_task || _next == _count)
+            {
+                return;
+            }
+            task = _task;
+            index = _next++;
+        }
+
+        (*task)(index);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(++_finished == _count)
+        {
+            _done.notify_all();
+        }
+    }
+}
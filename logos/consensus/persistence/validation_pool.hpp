@@ -0,0 +1,59 @@
+/// @file
+/// This file contains the declaration of ValidationPool, the fork/join
+/// thread pool BlockCache uses to validate request blocks of different
+/// delegate chains concurrently.
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+class ValidationPool
+{
+public:
+
+    using Task = std::function<void(size_t)>;
+
+    /// Class constructor
+    ///     @param threads total number of threads validating concurrently,
+    ///                    including the thread calling Run
+    explicit ValidationPool(unsigned threads);
+
+    ~ValidationPool();
+
+    /// Run task(0) ... task(count - 1) and wait until all of them return.
+    ///
+    /// Tasks are claimed in index order by the pool's threads and by the
+    /// calling thread. Concurrent calls are serialized.
+    ///     @param count number of tasks
+    ///     @param task the task, called with the index of each
+    void Run(size_t count, const Task & task);
+
+    /// @returns the number of tasks that can run concurrently
+    unsigned Size() const
+    {
+        return _threads.size() + 1;
+    }
+
+private:
+
+    void Worker();
+
+    /// Run claimed tasks of the current Run call until none are left.
+    void Work();
+
+    std::mutex               _run_mutex;
+    std::mutex               _mutex;
+    std::condition_variable  _start;
+    std::condition_variable  _done;
+    const Task *             _task       = nullptr;
+    size_t                   _count      = 0;
+    size_t                   _next       = 0;
+    size_t                   _finished   = 0;
+    uint64_t                 _generation = 0;
+    bool                     _stopped    = false;
+    std::vector<std::thread> _threads;
+};
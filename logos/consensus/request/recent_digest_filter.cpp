@@ -0,0 +1,128 @@
+/// @file
+/// This file contains the implementation of RecentDigestFilter.
+
+#include <logos/consensus/request/recent_digest_filter.hpp>
+
+#include <algorithm>
+
+constexpr size_t RecentDigestFilter::DEFAULT_CAPACITY;
+constexpr std::chrono::seconds RecentDigestFilter::DEFAULT_ROTATION;
+constexpr size_t RecentDigestFilter::BLOCK_WORDS;
+constexpr size_t RecentDigestFilter::PROBES;
+constexpr size_t RecentDigestFilter::BITS_PER_DIGEST;
+
+namespace
+{
+
+// Bit offset within a block of the given probe, taken from the digest.
+inline size_t probe_bit(const BlockHash & digest, size_t probe)
+{
+    return (digest.qwords[1] >> (probe * 9)) & 511;
+}
+
+}
+
+RecentDigestFilter::RecentDigestFilter(size_t capacity, std::chrono::seconds rotation)
+    : _capacity(std::max<size_t>(capacity, 1))
+    , _rotation(std::chrono::duration_cast<Clock::duration>(rotation))
+    , _blocks((_capacity * BITS_PER_DIGEST + BLOCK_WORDS * 64 - 1) / (BLOCK_WORDS * 64))
+    , _rotated(Clock::now().time_since_epoch().count())
+{
+    for(auto & generation : _generations)
+    {
+        generation.words.reset(new std::atomic<uint64_t>[_blocks * BLOCK_WORDS]);
+        for(size_t i = 0; i < _blocks * BLOCK_WORDS; ++i)
+        {
+            generation.words[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::atomic<uint64_t> *
+RecentDigestFilter::Block(const Generation & generation, const BlockHash & digest) const
+{
+    return &generation.words[(digest.qwords[0] % _blocks) * BLOCK_WORDS];
+}
+
+bool
+RecentDigestFilter::Test(const Generation & generation, const BlockHash & digest) const
+{
+    auto block = Block(generation, digest);
+    for(size_t probe = 0; probe < PROBES; ++probe)
+    {
+        auto bit = probe_bit(digest, probe);
+        if(!(block[bit / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (bit % 64))))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+RecentDigestFilter::MayContain(const BlockHash & digest) const
+{
+    auto current = _current.load(std::memory_order_acquire);
+    return Test(_generations[current], digest) || Test(_generations[current ^ 1], digest);
+}
+
+bool
+RecentDigestFilter::CheckAndInsert(const BlockHash & digest)
+{
+    auto current = _current.load(std::memory_order_acquire);
+    auto & generation = _generations[current];
+    auto block = Block(generation, digest);
+
+    bool seen = true;
+    for(size_t probe = 0; probe < PROBES; ++probe)
+    {
+        auto bit = probe_bit(digest, probe);
+        auto mask = uint64_t(1) << (bit % 64);
+        if(!(block[bit / 64].fetch_or(mask, std::memory_order_relaxed) & mask))
+        {
+            seen = false;
+        }
+    }
+
+    if(seen)
+    {
+        return true;
+    }
+
+    if(generation.inserted.fetch_add(1, std::memory_order_relaxed) + 1 >= _capacity
+       || Clock::now().time_since_epoch().count() - _rotated.load(std::memory_order_relaxed) >= _rotation.count())
+    {
+        Rotate();
+    }
+
+    return Test(_generations[current ^ 1], digest);
+}
+
+void
+RecentDigestFilter::Rotate()
+{
+    std::unique_lock<std::mutex> lock(_rotate_mutex, std::try_to_lock);
+    if(!lock.owns_lock())
+    {
+        return;
+    }
+
+    auto current = _current.load(std::memory_order_acquire);
+    if(_generations[current].inserted.load(std::memory_order_relaxed) < _capacity
+       && Clock::now().time_since_epoch().count() - _rotated.load(std::memory_order_relaxed) < _rotation.count())
+    {
+        return;
+    }
+
+    // Concurrent lookups may miss digests of the generation being cleared;
+    // those requests just take the regular, fully checked path.
+    auto & next = _generations[current ^ 1];
+    for(size_t i = 0; i < _blocks * BLOCK_WORDS; ++i)
+    {
+        next.words[i].store(0, std::memory_order_relaxed);
+    }
+    next.inserted.store(0, std::memory_order_relaxed);
+
+    _rotated.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    _current.store(current ^ 1, std::memory_order_release);
+}
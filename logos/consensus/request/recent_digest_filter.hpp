@@ -0,0 +1,80 @@
+/// @file
+/// This file contains the declaration of RecentDigestFilter, a bounded,
+/// time-rotating filter of recently seen request digests.
+#pragma once
+
+#include <logos/lib/numbers.hpp>
+#include <logos/lib/hash.hpp>
+
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <array>
+#include <mutex>
+
+/// Blocked Bloom filter of request digests seen in the last one to two
+/// generations.
+///
+/// Each digest sets a few bits within a single cache line block. Digests
+/// are Blake2b outputs already, so the block and bits are taken from the
+/// digest directly instead of being rehashed. The filter keeps two
+/// generations and clears the older one whenever the newer one fills up
+/// or ages out, which bounds both its memory and its false positive rate.
+///
+/// A hit only means the digest was probably seen and must be confirmed
+/// with an exact check. A miss means the digest wasn't seen within the
+/// window, except for rare misses racing with a rotation.
+class RecentDigestFilter
+{
+    using Clock = std::chrono::steady_clock;
+
+public:
+
+    static constexpr size_t               DEFAULT_CAPACITY = 1 << 20;
+    static constexpr std::chrono::seconds DEFAULT_ROTATION{60};
+
+    /// Class constructor
+    ///     @param capacity digests per generation
+    ///     @param rotation maximum age of a generation
+    RecentDigestFilter(size_t capacity = DEFAULT_CAPACITY,
+                       std::chrono::seconds rotation = DEFAULT_ROTATION);
+
+    /// Record a digest.
+    ///     @param digest request digest
+    ///     @return true if the digest may have been recorded before
+    bool CheckAndInsert(const BlockHash & digest);
+
+    /// @returns true if the digest may have been recorded before
+    bool MayContain(const BlockHash & digest) const;
+
+private:
+
+    static constexpr size_t BLOCK_WORDS = 8; ///< 512 bit blocks
+    static constexpr size_t PROBES      = 4; ///< bits set per digest
+    static constexpr size_t BITS_PER_DIGEST = 16;
+
+    using Words = std::unique_ptr<std::atomic<uint64_t>[]>;
+
+    struct Generation
+    {
+        Words               words;
+        std::atomic<size_t> inserted{0};
+    };
+
+    /// @returns true if all of the digest's bits are set in the generation
+    bool Test(const Generation & generation, const BlockHash & digest) const;
+
+    /// Clear the older generation and make it the current one, unless
+    /// another thread is already doing so.
+    void Rotate();
+
+    std::atomic<uint64_t> * Block(const Generation & generation, const BlockHash & digest) const;
+
+    const size_t                   _capacity;
+    const Clock::duration          _rotation;
+    const size_t                   _blocks;
+    std::array<Generation, 2>      _generations;
+    std::atomic<size_t>            _current{0};
+    std::atomic<Clock::rep>        _rotated;
+    std::mutex                     _rotate_mutex;
+};
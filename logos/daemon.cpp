@@ -5,6 +5,7 @@
 #include <iostream>
 #include <logos/node/working.hpp>
 #include <logos/tx_acceptor/tx_acceptor.hpp>
+#include <logos/snapshot/state_snapshot.hpp>
 
 logos_daemon::daemon_config::daemon_config (boost::filesystem::path const & application_path_a) :
 rpc_enable (false)
@@ -111,14 +112,15 @@ void logos_daemon::daemon::run (boost::filesystem::path const & data_path, const
     logos_daemon::daemon_config config (data_path);
     auto config_path ((data_path / "config.json"));
     std::fstream config_file;
-    std::unique_ptr<logos::thread_runner> runner;
     auto error (logos::fetch_object (config, config_path, config_file));
     if (!error)
     {
         config.p2p_conf = p2p_conf;
         config.node.logging.init (data_path);
         config_file.close ();
-        boost::asio::io_service service;
+        // Consensus, persistence, bootstrap and RPC work each run on their own lane.
+        auto lanes (std::make_shared<ExecutorLanes> (config.node.lanes_config));
+        auto & service (lanes->GetService (Lane::Consensus));
 
         logos::alarm alarm (service);
         logos::node_init init;
@@ -134,17 +136,25 @@ void logos_daemon::daemon::run (boost::filesystem::path const & data_path, const
                 }
             };
             config.node.p2p_conf = config.p2p_conf;
-            auto node (std::make_shared<logos::node> (init, service, data_path, alarm, config.node/*, opencl_work*/));
+            // A fresh node starts from the configured state snapshot, if any,
+            // and bootstraps only the blocks following it.
+            if (StateSnapshot::ImportConfigured (data_path, config.node.snapshot_config, config.node.lmdb_max_dbs,
+                                                  config.node.history_path (data_path)))
+            {
+                std::cerr << "Error importing state snapshot\n";
+                return;
+            }
+            auto node (std::make_shared<logos::node> (init, service, data_path, alarm, config.node/*, opencl_work*/, lanes));
             if (!init.error ())
             {
                 node->start ();
-                std::unique_ptr<logos::rpc> rpc = get_rpc (service, *node, config.rpc);
+                std::unique_ptr<logos::rpc> rpc = get_rpc (lanes->GetService (Lane::Rpc), *node, config.rpc);
                 if (rpc && config.rpc_enable)
                 {
                     rpc->start ();
                 }
-                runner = std::make_unique<logos::thread_runner> (service, node->config.io_threads);
-                runner->join ();
+                lanes->Start ();
+                lanes->Join ();
             }
             else
             {
@@ -280,6 +280,14 @@ public:
         s += logos::write(stream, is_extension);
         return s;
     }
+
+    uint32_t WireSize(bool with_appendix) const
+    {
+        // Epoch blocks are rare, and the delegates' ECIES keys vary in size.
+        return logos::serialized_size([this, with_appendix](logos::stream & stream) {
+            Serialize(stream, with_appendix);
+        });
+    }
     /// JSON representation of Epoch (primarily for RPC messages)
     std::string ToJson() const;
     void SerializeJson(boost::property_tree::ptree &) const;
@@ -0,0 +1,66 @@
+/// @file
+/// This file contains the implementation of GovernanceCheckpoint.
+
+#include <logos/governance/governance_checkpoint.hpp>
+
+GovernanceCheckpoint::GovernanceCheckpoint()
+    : type(RequestType::Unknown)
+    , rep(0)
+    , lock_proxy(0)
+    , previous(0)
+{}
+
+GovernanceCheckpoint::GovernanceCheckpoint(const Governance & request)
+    : type(request.type)
+    , rep(0)
+    , lock_proxy(0)
+    , previous(request.governance_subchain_prev)
+{
+    if(type == RequestType::Proxy)
+    {
+        auto & proxy = static_cast<const Proxy &>(request);
+        rep = proxy.rep;
+        lock_proxy = proxy.lock_proxy;
+    }
+}
+
+bool GovernanceCheckpoint::IsCheckpointed(RequestType type)
+{
+    switch(type)
+    {
+        case RequestType::Proxy:
+        case RequestType::AnnounceCandidacy:
+        case RequestType::StartRepresenting:
+        case RequestType::StopRepresenting:
+            return true;
+        default:
+            return false;
+    }
+}
+
+logos::mdb_val GovernanceCheckpoint::to_mdb_val(std::vector<uint8_t>& buf) const
+{
+    assert(buf.empty());
+    {
+        logos::vectorstream stream(buf);
+        Serialize(stream);
+    }
+    return logos::mdb_val(buf.size(), buf.data());
+}
+
+uint32_t GovernanceCheckpoint::Serialize(logos::stream & stream) const
+{
+    uint32_t s = logos::write(stream, type);
+    s += logos::write(stream, rep);
+    s += logos::write(stream, lock_proxy);
+    s += logos::write(stream, previous);
+    return s;
+}
+
+bool GovernanceCheckpoint::Deserialize(logos::stream & stream)
+{
+    return logos::read(stream, type)
+        || logos::read(stream, rep)
+        || logos::read(stream, lock_proxy)
+        || logos::read(stream, previous);
+}
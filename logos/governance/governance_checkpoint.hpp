@@ -0,0 +1,33 @@
+/// @file
+/// This file contains the declaration of GovernanceCheckpoint, the
+/// per-epoch governance state of an account used to process claims.
+#pragma once
+
+#include <logos/governance/requests.hpp>
+
+/// The effect of an account's last rep or proxy changing governance
+/// request of an epoch.
+///
+/// Checkpoints are stored per account and epoch, so a claim visits one
+/// checkpoint per epoch the account's state changed in instead of
+/// every request of its governance subchain.
+struct GovernanceCheckpoint
+{
+    GovernanceCheckpoint();
+
+    GovernanceCheckpoint(const Governance & request);
+
+    /// @returns true if requests of the type change the state used by claims
+    static bool IsCheckpointed(RequestType type);
+
+    logos::mdb_val to_mdb_val(std::vector<uint8_t>& buf) const;
+
+    uint32_t Serialize(logos::stream & stream) const;
+
+    bool Deserialize(logos::stream & stream);
+
+    RequestType    type;
+    AccountAddress rep;         ///< proxied rep, set by Proxy only
+    Amount         lock_proxy;  ///< amount locked proxied, set by Proxy only
+    BlockHash      previous;    ///< governance_subchain_prev of the request
+};
@@ -0,0 +1,184 @@
+///
+/// @file
+/// This file contains the implementation of the LZ77 block compressor
+///
+#include <logos/lib/lz.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+    constexpr size_t MIN_MATCH    = 4;
+    constexpr size_t MAX_OFFSET   = std::numeric_limits<uint16_t>::max();
+    constexpr size_t HASH_BITS    = 14;
+    constexpr uint32_t NO_MATCH   = std::numeric_limits<uint32_t>::max();
+    constexpr uint8_t COUNT_MASK  = 0x0f;
+
+    uint32_t Read32(const uint8_t * p)
+    {
+        uint32_t value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    size_t HashOf(uint32_t value)
+    {
+        return (value * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    void WriteCount(std::vector<uint8_t> & out, size_t count)
+    {
+        for(; count >= 255; count -= 255)
+        {
+            out.push_back(255);
+        }
+        out.push_back(count);
+    }
+
+    bool ReadCount(const uint8_t * data, size_t size, size_t & pos, size_t & count)
+    {
+        uint8_t byte;
+        do
+        {
+            if(pos == size)
+            {
+                return true;
+            }
+            byte = data[pos++];
+            count += byte;
+        } while(byte == 255);
+        return false;
+    }
+
+    void Sequence(std::vector<uint8_t> & out,
+                  const uint8_t * literals,
+                  size_t literal_count,
+                  size_t match_length,
+                  size_t offset)
+    {
+        auto token_pos = out.size();
+        out.push_back(0);
+
+        uint8_t token = std::min<size_t>(literal_count, COUNT_MASK) << 4;
+        if(literal_count >= COUNT_MASK)
+        {
+            WriteCount(out, literal_count - COUNT_MASK);
+        }
+        out.insert(out.end(), literals, literals + literal_count);
+
+        if(match_length)
+        {
+            out.push_back(offset & 0xff);
+            out.push_back(offset >> 8);
+            auto length = match_length - MIN_MATCH;
+            token |= std::min<size_t>(length, COUNT_MASK);
+            if(length >= COUNT_MASK)
+            {
+                WriteCount(out, length - COUNT_MASK);
+            }
+        }
+
+        out[token_pos] = token;
+    }
+
+}
+
+void lz::Compress(const uint8_t * data, size_t size, std::vector<uint8_t> & out)
+{
+    assert(size < NO_MATCH);
+
+    std::vector<uint32_t> table(size_t(1) << HASH_BITS, NO_MATCH);
+    size_t anchor = 0;
+    size_t pos = 0;
+
+    while(pos + MIN_MATCH <= size)
+    {
+        auto value = Read32(data + pos);
+        auto & slot = table[HashOf(value)];
+        size_t candidate = slot;
+        slot = pos;
+
+        if(candidate == NO_MATCH || pos - candidate > MAX_OFFSET || Read32(data + candidate) != value)
+        {
+            ++pos;
+            continue;
+        }
+
+        size_t length = MIN_MATCH;
+        while(pos + length < size && data[candidate + length] == data[pos + length])
+        {
+            ++length;
+        }
+
+        Sequence(out, data + anchor, pos - anchor, length, pos - candidate);
+        pos += length;
+        anchor = pos;
+    }
+
+    Sequence(out, data + anchor, size - anchor, 0, 0);
+}
+
+bool lz::Decompress(const uint8_t * data, size_t size, uint8_t * out, size_t out_size)
+{
+    size_t pos = 0;
+    size_t out_pos = 0;
+
+    while(pos < size)
+    {
+        uint8_t token = data[pos++];
+
+        size_t literals = token >> 4;
+        if(literals == COUNT_MASK && ReadCount(data, size, pos, literals))
+        {
+            return true;
+        }
+        if(literals > size - pos || literals > out_size - out_pos)
+        {
+            return true;
+        }
+        memcpy(out + out_pos, data + pos, literals);
+        pos += literals;
+        out_pos += literals;
+
+        // Only the last sequence has no match.
+        if(pos == size)
+        {
+            break;
+        }
+
+        if(size - pos < 2)
+        {
+            return true;
+        }
+        size_t offset = data[pos] | (size_t(data[pos + 1]) << 8);
+        pos += 2;
+        if(offset == 0 || offset > out_pos)
+        {
+            return true;
+        }
+
+        size_t length = token & COUNT_MASK;
+        if(length == COUNT_MASK && ReadCount(data, size, pos, length))
+        {
+            return true;
+        }
+        length += MIN_MATCH;
+        if(length > out_size - out_pos)
+        {
+            return true;
+        }
+
+        // The match may overlap the bytes it produces.
+        auto from = out + out_pos - offset;
+        for(size_t i = 0; i < length; ++i)
+        {
+            out[out_pos + i] = from[i];
+        }
+        out_pos += length;
+    }
+
+    return out_pos != out_size;
+}
@@ -0,0 +1,35 @@
+///
+/// @file
+/// This file contains the declaration of a byte oriented LZ77 block
+/// compressor, used for archived block segments
+///
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lz {
+
+    /// Compress a block.
+    ///
+    /// The output is a series of sequences, each a token byte holding the
+    /// literal count and the match length, the literals, then a two byte
+    /// little endian match offset. Counts that don't fit the token's four
+    /// bits continue in bytes of 255 ended by a smaller one. The last
+    /// sequence has no match. Matches are searched with a single probe
+    /// hash table, trading ratio for speed.
+    /// @param data [in] the block
+    /// @param size [in] its size, less than 4GB
+    /// @param out [in,out] the compressed block is appended to it
+    void Compress(const uint8_t * data, size_t size, std::vector<uint8_t> & out);
+
+    /// Decompress a block.
+    /// @param data [in] the compressed block
+    /// @param size [in] its size
+    /// @param out [out] receives the block
+    /// @param out_size [in] the exact size of the block
+    /// @returns true if data is malformed or doesn't decompress to out_size bytes
+    bool Decompress(const uint8_t * data, size_t size, uint8_t * out, size_t out_size);
+
+}
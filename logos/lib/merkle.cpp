@@ -5,6 +5,19 @@
 #include <logos/lib/merkle.hpp>
 #include <blake2/blake2.h>
 
+#include <algorithm>
+#include <atomic>
+
+namespace {
+    std::atomic<merkle::Builder> builder(merkle::Builder::Batched);
+
+    // Pairs are hashed straight from the level, as one 64 byte message
+    static_assert(sizeof(BlockHash) == HASH_SIZE, "BlockHash must be packed");
+
+    // Pairs passed to blake2b_mb per call
+    constexpr size_t LEVEL_CHUNK = 64;
+}
+
 namespace merkle {
     BlockHash
     Hash(HashDataProviderCb data_provider) {
@@ -46,6 +59,12 @@ namespace merkle {
       if (merkle.size() == 0) {
         return BlockHash();
       }
+      if (GetBuilder() == Builder::Batched) {
+        vector<BlockHash> parents;
+        while (merkle.size() > 1)
+          HashLevel(merkle, parents);
+        return merkle[0];
+      }
       while (merkle.size() > 1) {
         if (merkle.size() % 2) // make the number of nodes even
           merkle.push_back(merkle.back()); // add the last node
@@ -59,6 +78,22 @@ namespace merkle {
     BlockHash
     MerkleHelper(
         HashIteratorProviderCb iterator_provider) {
+      if (GetBuilder() == Builder::Batched) {
+        vector<BlockHash> merkle;
+        iterator_provider([&](const BlockHash &hash)mutable -> void {
+            merkle.push_back(hash);
+        });
+        if (merkle.empty()) {
+          return BlockHash();
+        }
+        // the leaves are always hashed, a single leaf with itself
+        vector<BlockHash> parents;
+        HashLevel(merkle, parents);
+        while (merkle.size() > 1)
+          HashLevel(merkle, parents);
+        return merkle[0];
+      }
+
       vector<BlockHash> merkle;
       BlockHash previous_hash;
       int cnt = 0;
@@ -78,4 +113,41 @@ namespace merkle {
 
       return MerkleRoot(merkle);
     }
+
+    void
+    SetBuilder(Builder b) {
+      builder = b;
+    }
+
+    Builder
+    GetBuilder() {
+      return builder;
+    }
+
+    void
+    HashLevel(
+        vector<BlockHash> &level,
+        vector<BlockHash> &parents) {
+      if (level.size() % 2) // make the number of nodes even
+        level.push_back(level.back());
+
+      auto count = level.size() / 2;
+      parents.resize(count);
+
+      uint8_t *out[LEVEL_CHUNK];
+      const uint8_t *in[LEVEL_CHUNK];
+      size_t inlen[LEVEL_CHUNK];
+      for (size_t i = 0; i < count; i += LEVEL_CHUNK) {
+        auto n = std::min(LEVEL_CHUNK, count - i);
+        for (size_t j = 0; j < n; ++j) {
+          out[j] = parents[i + j].data();
+          in[j] = level[2 * (i + j)].data();
+          inlen[j] = 2 * sizeof(BlockHash);
+        }
+        auto status(blake2b_mb(out, sizeof(BlockHash), in, inlen, n));
+        assert (status == 0);
+      }
+
+      level.swap(parents);
+    }
 }
@@ -13,6 +13,13 @@ using namespace std;
 
 namespace merkle {
 
+    /// How parent nodes are hashed
+    enum class Builder : uint8_t
+    {
+        Serial,     ///< one pair at a time through Hash(h1, h2)
+        Batched     ///< a level at a time with the multi-buffer blake2b_mb
+    };
+
     using HashUpdaterCb             = function<void(const void *, size_t)>;
     using HashDataProviderCb        = function<void(HashUpdaterCb)>;
     using HashReceiverCb            = function<void(const BlockHash&)>;
@@ -48,4 +55,18 @@ namespace merkle {
     /// @returns Merkle tree root
     BlockHash
     MerkleHelper(HashIteratorProviderCb iterator_provider);
+
+    /// Select how MerkleRoot and MerkleHelper hash parent nodes. Both
+    /// builders compute the same root, Batched is the default.
+    /// @param builder to use from now on
+    void SetBuilder(Builder builder);
+
+    /// @returns the builder in use
+    Builder GetBuilder();
+
+    /// Replace a level of the tree with its parent level, hashing the pairs
+    /// with blake2b_mb. An odd last node is paired with itself.
+    /// @param level [in,out] nodes of the level, overwritten with their parents
+    /// @param parents scratch space, reused across calls
+    void HashLevel(vector<BlockHash> &level, vector<BlockHash> &parents);
 }
\ No newline at end of file
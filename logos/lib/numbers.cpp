@@ -9,6 +9,8 @@
 #include <cryptopp/aes.h>
 #include <cryptopp/modes.h>
 
+#include <boost/endian/conversion.hpp>
+
 thread_local CryptoPP::AutoSeededRandomPool logos::random_pool;
 
 namespace
@@ -36,6 +38,79 @@ uint8_t account_decode (char value)
     auto result (account_reverse[value - 0x30] - 0x30);
     return result;
 }
+
+// The unions hold big-endian numbers, so qwords converted to native order
+// are 64-bit limbs, most significant first. Arithmetic on limbs wraps
+// around like the fixed width boost types it replaces.
+inline uint64_t to_limb (uint64_t qword_a)
+{
+    return boost::endian::big_to_native (qword_a);
+}
+inline uint64_t to_qword (uint64_t limb_a)
+{
+    return boost::endian::native_to_big (limb_a);
+}
+template <size_t N>
+int limbs_compare (std::array<uint64_t, N> const & a, std::array<uint64_t, N> const & b)
+{
+    int result (0);
+    for (size_t i (0); i < N && result == 0; ++i)
+    {
+        auto x (to_limb (a[i]));
+        auto y (to_limb (b[i]));
+        result = (x > y) - (x < y);
+    }
+    return result;
+}
+template <size_t N>
+std::array<uint64_t, N> limbs_add (std::array<uint64_t, N> const & a, std::array<uint64_t, N> const & b)
+{
+    std::array<uint64_t, N> result;
+    uint64_t carry (0);
+    for (size_t i (N); i-- > 0;)
+    {
+        auto x (to_limb (a[i]));
+        auto sum (x + to_limb (b[i]));
+        uint64_t carry_out (sum < x);
+        sum += carry;
+        carry_out |= sum < carry;
+        result[i] = to_qword (sum);
+        carry = carry_out;
+    }
+    return result;
+}
+template <size_t N>
+std::array<uint64_t, N> limbs_subtract (std::array<uint64_t, N> const & a, std::array<uint64_t, N> const & b)
+{
+    std::array<uint64_t, N> result;
+    uint64_t borrow (0);
+    for (size_t i (N); i-- > 0;)
+    {
+        auto x (to_limb (a[i]));
+        auto y (to_limb (b[i]));
+        auto difference (x - y);
+        uint64_t borrow_out (x < y);
+        borrow_out |= difference < borrow;
+        difference -= borrow;
+        result[i] = to_qword (difference);
+        borrow = borrow_out;
+    }
+    return result;
+}
+#ifdef __SIZEOF_INT128__
+using native_uint128 = unsigned __int128;
+inline native_uint128 to_native (logos::uint128_union const & value_a)
+{
+    return (native_uint128 (to_limb (value_a.qwords[0])) << 64) | to_limb (value_a.qwords[1]);
+}
+inline logos::uint128_union from_native (native_uint128 value_a)
+{
+    logos::uint128_union result;
+    result.qwords[0] = to_qword (static_cast<uint64_t> (value_a >> 64));
+    result.qwords[1] = to_qword (static_cast<uint64_t> (value_a));
+    return result;
+}
+#endif
 }
 
 void logos::uint256_union::encode_account (std::string & destination_a) const
@@ -166,7 +241,7 @@ std::string logos::uint256_union::to_string () const
 
 bool logos::uint256_union::operator< (logos::uint256_union const & other_a) const
 {
-    return number () < other_a.number ();
+    return limbs_compare (qwords, other_a.qwords) < 0;
 }
 
 logos::uint256_union & logos::uint256_union::operator^= (logos::uint256_union const & other_a)
@@ -192,12 +267,16 @@ logos::uint256_union logos::uint256_union::operator^ (logos::uint256_union const
 
 logos::uint256_union logos::uint256_union::operator+ (logos::uint256_union const & other_a) const
 {
-    return {number () + other_a.number ()};
+    logos::uint256_union result;
+    result.qwords = limbs_add (qwords, other_a.qwords);
+    return result;
 }
 
 logos::uint256_union logos::uint256_union::operator- (logos::uint256_union const & other_a) const
 {
-    return {number () - other_a.number ()};
+    logos::uint256_union result;
+    result.qwords = limbs_subtract (qwords, other_a.qwords);
+    return result;
 }
 
 
@@ -213,13 +292,11 @@ void logos::uint256_union::clear ()
 
 logos::uint256_t logos::uint256_union::number () const
 {
-    logos::uint256_t result;
-    auto shift (0);
-    for (auto i (bytes.begin ()), n (bytes.end ()); i != n; ++i)
+    logos::uint256_t result (to_limb (qwords[0]));
+    for (auto i (qwords.begin () + 1), n (qwords.end ()); i != n; ++i)
     {
-        result <<= shift;
-        result |= *i;
-        shift = 8;
+        result <<= 64;
+        result |= to_limb (*i);
     }
     return result;
 }
@@ -450,12 +527,9 @@ logos::uint128_union::uint128_union (uint64_t value_a)
 
 logos::uint128_union::uint128_union (logos::uint128_t const & value_a)
 {
-    logos::uint128_t number_l (value_a);
-    for (auto i (bytes.rbegin ()), n (bytes.rend ()); i != n; ++i)
-    {
-        *i = static_cast<uint8_t> (number_l & static_cast<uint8_t> (0xff));
-        number_l >>= 8;
-    }
+    logos::uint128_t const mask (std::numeric_limits<uint64_t>::max ());
+    qwords[0] = to_qword (static_cast<uint64_t> (value_a >> 64));
+    qwords[1] = to_qword (static_cast<uint64_t> (value_a & mask));
 }
 
 bool logos::uint128_union::Deserialize (logos::stream & stream)
@@ -480,33 +554,55 @@ bool logos::uint128_union::operator!= (logos::uint128_union const & other_a) con
 
 bool logos::uint128_union::operator< (logos::uint128_union const & other_a) const
 {
-    return number () < other_a.number ();
+    return limbs_compare (qwords, other_a.qwords) < 0;
 }
 
 bool logos::uint128_union::operator> (logos::uint128_union const & other_a) const
 {
-    return number () > other_a.number ();
+    return limbs_compare (qwords, other_a.qwords) > 0;
 }
 
 bool logos::uint128_union::operator<= (logos::uint128_union const & other_a) const
 {
-    return number () <= other_a.number ();
+    return limbs_compare (qwords, other_a.qwords) <= 0;
 }
 
 bool logos::uint128_union::operator>= (logos::uint128_union const & other_a) const
 {
-    return number () >= other_a.number ();
+    return limbs_compare (qwords, other_a.qwords) >= 0;
 }
 
+#ifdef __SIZEOF_INT128__
 
 logos::uint128_union logos::uint128_union::operator+ (logos::uint128_union const & other_a) const
 {
-    return {number () + other_a.number ()};
+    return from_native (to_native (*this) + to_native (other_a));
 }
 
 logos::uint128_union logos::uint128_union::operator- (logos::uint128_union const & other_a) const
 {
-    return {number () - other_a.number ()};
+    return from_native (to_native (*this) - to_native (other_a));
+}
+
+logos::uint128_union logos::uint128_union::operator* (logos::uint128_union const & other_a) const
+{
+    return from_native (to_native (*this) * to_native (other_a));
+}
+
+#else
+
+logos::uint128_union logos::uint128_union::operator+ (logos::uint128_union const & other_a) const
+{
+    logos::uint128_union result;
+    result.qwords = limbs_add (qwords, other_a.qwords);
+    return result;
+}
+
+logos::uint128_union logos::uint128_union::operator- (logos::uint128_union const & other_a) const
+{
+    logos::uint128_union result;
+    result.qwords = limbs_subtract (qwords, other_a.qwords);
+    return result;
 }
 
 logos::uint128_union logos::uint128_union::operator* (logos::uint128_union const & other_a) const
@@ -514,28 +610,25 @@ logos::uint128_union logos::uint128_union::operator* (logos::uint128_union const
     return {number () * other_a.number ()};
 }
 
+#endif
+
 logos::uint128_union & logos::uint128_union::operator+=(const logos::uint128_union & other)
 {
-    *this = {number() + other.number()};
+    *this = *this + other;
     return *this;
 }
 
 logos::uint128_union & logos::uint128_union::operator-=(const logos::uint128_union & other)
 {
-    *this = {number() - other.number()};
+    *this = *this - other;
     return *this;
 }
 
 logos::uint128_t logos::uint128_union::number () const
 {
-    logos::uint128_t result;
-    auto shift (0);
-    for (auto i (bytes.begin ()), n (bytes.end ()); i != n; ++i)
-    {
-        result <<= shift;
-        result |= *i;
-        shift = 8;
-    }
+    logos::uint128_t result (to_limb (qwords[0]));
+    result <<= 64;
+    result |= to_limb (qwords[1]);
     return result;
 }
 
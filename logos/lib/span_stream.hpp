@@ -0,0 +1,229 @@
+/// @file
+/// This file contains logos::stream implementations over caller owned,
+/// contiguous memory: span_writer and span_reader, and size_counter, which
+/// measures a serialization without storing it.
+///
+/// Unlike bufferstream and vectorstream, these stage nothing in an internal
+/// buffer: every field is copied straight to or from its final location,
+/// and a writer never grows its destination, so a buffer sized up front with
+/// size_counter (or a WireSize method) is filled with a single allocation.
+/// Fields still go through logos::stream's virtual xsputn and xsgetn, as
+/// the Serialize methods take a logos::stream.
+#pragma once
+
+#include <logos/lib/numbers.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace logos
+{
+
+/// Writes into a fixed range. A write that doesn't fit is truncated, the
+/// short count is returned to the caller and the writer is marked as
+/// overflowed.
+class span_writer : public logos::stream
+{
+public:
+    span_writer (uint8_t * data_a, size_t size_a)
+    {
+        setp (data_a, data_a + size_a);
+    }
+
+    /// Bytes written so far.
+    size_t size () const
+    {
+        return pptr () - pbase ();
+    }
+
+    /// Bytes left in the range.
+    size_t remaining () const
+    {
+        return epptr () - pptr ();
+    }
+
+    bool overflowed () const
+    {
+        return overflowed_;
+    }
+
+protected:
+    std::streamsize xsputn (uint8_t const * data_a, std::streamsize count_a) override
+    {
+        auto count (std::min<std::streamsize> (count_a, remaining ()));
+        std::memcpy (pptr (), data_a, count);
+        advance (count);
+        overflowed_ |= count != count_a;
+        return count;
+    }
+
+    int_type overflow (int_type c_a) override
+    {
+        overflowed_ |= !traits_type::eq_int_type (c_a, traits_type::eof ());
+        return traits_type::eof ();
+    }
+
+    pos_type seekoff (off_type off_a, std::ios_base::seekdir dir_a, std::ios_base::openmode which_a) override
+    {
+        // Only telling the put position is supported.
+        if (off_a != 0 || dir_a != std::ios_base::cur || !(which_a & std::ios_base::out))
+        {
+            return pos_type (off_type (-1));
+        }
+        return pos_type (off_type (size ()));
+    }
+
+private:
+    void advance (size_t count_a)
+    {
+        // pbump takes an int; step in chunks for ranges past 2GB.
+        while (count_a)
+        {
+            auto step (std::min<size_t> (count_a, std::numeric_limits<int>::max ()));
+            pbump (static_cast<int> (step));
+            count_a -= step;
+        }
+    }
+
+    bool overflowed_ = false;
+};
+
+/// Reads from a fixed range that outlives the reader. Supports the same
+/// seeking on the get position as bufferstream.
+class span_reader : public logos::stream
+{
+public:
+    span_reader (uint8_t const * data_a, size_t size_a)
+    {
+        // The get area is never written through.
+        auto data (const_cast<uint8_t *> (data_a));
+        setg (data, data, data + size_a);
+    }
+
+    /// Bytes consumed so far.
+    size_t offset () const
+    {
+        return gptr () - eback ();
+    }
+
+    /// Bytes left to read.
+    size_t remaining () const
+    {
+        return egptr () - gptr ();
+    }
+
+protected:
+    std::streamsize xsgetn (uint8_t * data_a, std::streamsize count_a) override
+    {
+        auto count (std::min<std::streamsize> (count_a, remaining ()));
+        std::memcpy (data_a, gptr (), count);
+        skip (count);
+        return count;
+    }
+
+    std::streamsize showmanyc () override
+    {
+        return remaining () ? std::streamsize (remaining ()) : -1;
+    }
+
+    pos_type seekoff (off_type off_a, std::ios_base::seekdir dir_a, std::ios_base::openmode which_a) override
+    {
+        if (!(which_a & std::ios_base::in) || (which_a & std::ios_base::out))
+        {
+            return pos_type (off_type (-1));
+        }
+
+        off_type base (0);
+        switch (dir_a)
+        {
+            case std::ios_base::beg:
+                break;
+            case std::ios_base::cur:
+                base = offset ();
+                break;
+            case std::ios_base::end:
+                base = egptr () - eback ();
+                break;
+            default:
+                return pos_type (off_type (-1));
+        }
+
+        auto position (base + off_a);
+        if (position < 0 || position > egptr () - eback ())
+        {
+            return pos_type (off_type (-1));
+        }
+
+        setg (eback (), eback () + position, egptr ());
+        return pos_type (position);
+    }
+
+    pos_type seekpos (pos_type position_a, std::ios_base::openmode which_a) override
+    {
+        return seekoff (off_type (position_a), std::ios_base::beg, which_a);
+    }
+
+private:
+    void skip (size_t count_a)
+    {
+        setg (eback (), gptr () + count_a, egptr ());
+    }
+};
+
+/// Counts the bytes written to it without storing them.
+class size_counter : public logos::stream
+{
+public:
+    uint64_t size () const
+    {
+        return size_;
+    }
+
+protected:
+    std::streamsize xsputn (uint8_t const *, std::streamsize count_a) override
+    {
+        size_ += count_a;
+        return count_a;
+    }
+
+    int_type overflow (int_type c_a) override
+    {
+        if (traits_type::eq_int_type (c_a, traits_type::eof ()))
+        {
+            return traits_type::not_eof (c_a);
+        }
+        ++size_;
+        return c_a;
+    }
+
+private:
+    uint64_t size_ = 0;
+};
+
+/// The number of bytes serialize_a writes to a stream.
+template <typename Serializer>
+uint64_t serialized_size (Serializer const & serialize_a)
+{
+    size_counter counter;
+    serialize_a (static_cast<logos::stream &> (counter));
+    return counter.size ();
+}
+
+/// Append exactly size_a bytes to buf_a, written by serialize_a, growing
+/// buf_a once.
+/// @returns true if serialize_a didn't write exactly size_a bytes
+template <typename Serializer>
+bool serialize_exact (std::vector<uint8_t> & buf_a, size_t size_a, Serializer const & serialize_a)
+{
+    auto offset (buf_a.size ());
+    buf_a.resize (offset + size_a);
+
+    span_writer stream (buf_a.data () + offset, size_a);
+    serialize_a (static_cast<logos::stream &> (stream));
+
+    return stream.overflowed () || stream.size () != size_a;
+}
+
+}
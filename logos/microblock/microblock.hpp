@@ -66,6 +66,14 @@ struct MicroBlock : PrePrepareCommon
     void SerializeJson(boost::property_tree::ptree &) const;
     uint32_t Serialize(logos::stream & stream, bool with_appendix) const;
 
+    uint32_t WireSize(bool with_appendix) const
+    {
+        return PrePrepareCommon::WireSize +
+               sizeof(last_micro_block) +
+               sizeof(number_batch_blocks) +
+               NUM_DELEGATES * Tip::WireSize;
+    }
+
     uint8_t   last_micro_block;    ///< The last microblock in the epoch
     uint32_t  number_batch_blocks; ///< Number of batch blocks in the microblock
     Tip       tips[NUM_DELEGATES]; ///< Delegate's batch block tips
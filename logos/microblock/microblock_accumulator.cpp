@@ -0,0 +1,149 @@
+/// @file
+/// This file contains the definition of MicroBlockAccumulator.
+#include <logos/microblock/microblock_accumulator.hpp>
+#include <logos/blockstore.hpp>
+
+#include <algorithm>
+
+void
+MicroBlockAccumulator::Chain::Reset(
+        const BlockHash & hash)
+{
+    base = hash;
+    covered = false;
+    entries.clear();
+}
+
+void
+MicroBlockAccumulator::Add(
+        uint8_t delegate,
+        const ApprovedRB & block)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto & chain = _chains[delegate];
+    if (!chain.covered)
+    {
+        return;
+    }
+
+    // A chain recovered from the database may already hold the block.
+    BlockHash hash = block.Hash();
+    auto found = std::find_if(chain.entries.rbegin(), chain.entries.rend(), [&hash](const Entry & entry){
+        return entry.tip.digest == hash;
+    });
+    if (found != chain.entries.rend())
+    {
+        return;
+    }
+
+    if (block.previous != chain.Last())
+    {
+        LOG_DEBUG(_log) << "MicroBlockAccumulator::Add - request block " << hash.to_string()
+                        << " doesn't extend delegate " << (int)delegate << "'s chain";
+        chain.Reset(chain.base);
+        return;
+    }
+
+    chain.entries.push_back({block.timestamp, block.CreateTip()});
+}
+
+void
+MicroBlockAccumulator::Cut(
+        const ApprovedMB & block,
+        Store & store)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (uint8_t delegate = 0; delegate < NUM_DELEGATES; ++delegate)
+    {
+        auto & chain = _chains[delegate];
+        const BlockHash & tip = block.tips[delegate].digest;
+
+        if (chain.covered && chain.base == tip)
+        {
+            continue;
+        }
+
+        if (chain.covered)
+        {
+            auto found = std::find_if(chain.entries.begin(), chain.entries.end(), [&tip](const Entry & entry){
+                return entry.tip.digest == tip;
+            });
+            if (found != chain.entries.end())
+            {
+                chain.entries.erase(chain.entries.begin(), found + 1);
+                chain.base = tip;
+                continue;
+            }
+        }
+
+        chain.Reset(tip);
+        Recover(delegate, store);
+    }
+}
+
+void
+MicroBlockAccumulator::Recover(
+        uint8_t delegate,
+        Store & store)
+{
+    // Blocks committed while this runs are added after it, as Add waits
+    // for the lock.
+    auto & chain = _chains[delegate];
+    if (chain.base.is_zero())
+    {
+        return;
+    }
+
+    ApprovedRB batch;
+    if (store.request_block_get(chain.base, batch))
+    {
+        LOG_ERROR(_log) << "MicroBlockAccumulator::Recover - failed to get request block "
+                        << chain.base.to_string();
+        return;
+    }
+
+    for (BlockHash hash = batch.next; !hash.is_zero(); hash = batch.next)
+    {
+        if (store.request_block_get(hash, batch))
+        {
+            LOG_ERROR(_log) << "MicroBlockAccumulator::Recover - failed to get request block "
+                            << hash.to_string();
+            chain.entries.clear();
+            return;
+        }
+        chain.entries.push_back({batch.timestamp, batch.CreateTip()});
+    }
+
+    chain.covered = true;
+}
+
+bool
+MicroBlockAccumulator::Finalize(
+        const BatchTips & start,
+        uint64_t cutoff,
+        BatchTips & tips,
+        uint32_t & num_blocks) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (uint8_t delegate = 0; delegate < NUM_DELEGATES; ++delegate)
+    {
+        if (!_chains[delegate].covered || _chains[delegate].base != start[delegate].digest)
+        {
+            return true;
+        }
+    }
+
+    num_blocks = 0;
+    for (uint8_t delegate = 0; delegate < NUM_DELEGATES; ++delegate)
+    {
+        auto & entries = _chains[delegate].entries;
+        auto end = std::find_if(entries.begin(), entries.end(), [cutoff](const Entry & entry){
+            return entry.timestamp >= cutoff;
+        });
+
+        tips[delegate] = end == entries.begin() ? start[delegate] : (end - 1)->tip;
+        num_blocks += end - entries.begin();
+    }
+
+    return false;
+}
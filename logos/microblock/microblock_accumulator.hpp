@@ -0,0 +1,85 @@
+/// @file
+/// This file contains the declaration of MicroBlockAccumulator, which tracks
+/// the request blocks of the open micro period as they are persisted.
+#pragma once
+
+#include <logos/consensus/messages/messages.hpp>
+#include <logos/microblock/microblock.hpp>
+#include <logos/lib/log.hpp>
+
+#include <deque>
+#include <mutex>
+
+namespace logos {
+    class block_store;
+}
+
+/// Request blocks persisted since the last micro block, per delegate in
+/// chain order, so a micro block is cut from memory instead of by walking
+/// every delegate's chain in the database.
+///
+/// A delegate's chain is covered while every block stored after its micro
+/// block tip was added, in order. It stops being covered when a block
+/// doesn't extend it, e.g. across an epoch boundary before the chains are
+/// linked, and is recovered from the database when the next micro block
+/// is applied. Finalize fails unless every chain is covered, in which case
+/// the caller walks the database as before.
+class MicroBlockAccumulator
+{
+    using Store = logos::block_store;
+
+public:
+
+    /// Called once a request block's write transaction is committed.
+    ///     @param delegate the block's primary
+    ///     @param block the request block
+    void Add(uint8_t delegate, const ApprovedRB & block);
+
+    /// Called once a micro block's write transaction is committed, drops
+    /// the request blocks it cut.
+    ///     @param block the micro block
+    ///     @param store to recover chains that aren't covered
+    void Cut(const ApprovedMB & block, Store & store);
+
+    /// Cut the request blocks with a timestamp before cutoff, which is what
+    /// MicroBlockHandler::GetTipsFast selects.
+    ///     @param start previous micro block tips [in]
+    ///     @param cutoff in milliseconds [in]
+    ///     @param tips new request block tips [out]
+    ///     @param num_blocks number of selected request blocks [out]
+    ///     @returns true if a chain isn't covered from start
+    bool Finalize(const BatchTips & start,
+                  uint64_t cutoff,
+                  BatchTips & tips,
+                  uint32_t & num_blocks) const;
+
+private:
+
+    struct Entry
+    {
+        uint64_t timestamp;
+        Tip      tip;
+    };
+
+    struct Chain
+    {
+        /// Forget the chain after base.
+        void Reset(const BlockHash & hash);
+
+        const BlockHash & Last() const
+        {
+            return entries.empty() ? base : entries.back().tip.digest;
+        }
+
+        BlockHash         base;            ///< the tip of the last micro block
+        bool              covered = false; ///< entries hold every block stored after base
+        std::deque<Entry> entries;
+    };
+
+    /// Rebuild a chain from the blocks stored after base.
+    void Recover(uint8_t delegate, Store & store);
+
+    mutable std::mutex         _mutex;
+    Chain                      _chains[NUM_DELEGATES];
+    Log                        _log;
+};
@@ -244,8 +244,13 @@ MicroBlockHandler::Build(
     }
     // Microblock cut off time is the previous microblock's proposed time;
     // start points to the first block after the previous, i.e. previous.next
-    else
+    // The accumulator holds the request blocks stored since the previous micro block,
+    // unless a chain was broken, e.g. after start up; walk the database then.
+    else if (_store.micro_accumulator.Finalize(previous_micro_block.tips,
+                                               GetCutOffTimeMsec(previous_micro_block.timestamp),
+                                               block.tips, block.number_batch_blocks))
     {
+        LOG_DEBUG(_log) << "MicroBlockHandler::Build - request block chains not accumulated, walking the database";
         GetTipsFast(previous_micro_block.tips, previous_micro_block.timestamp, block.tips, block.number_batch_blocks);
         // Note: if building the last micro block, GetTipsFast still works because previous epoch's request block tips
         // aren't connected to the current epoch's request block chain yet
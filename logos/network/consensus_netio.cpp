@@ -355,7 +355,7 @@ ConsensusNetIO::OnPrequel(const uint8_t * data)
     LOG_INFO(_log) << "ConsensusNetIO::OnPrequel - "
         << CommonInfoToLog();
     bool error = false;
-    logos::bufferstream stream(data, MessagePrequelSize);
+    logos::span_reader stream(data, MessagePrequelSize);
     Prequel msg_prequel(error, stream);
     if(error)
     {
@@ -460,7 +460,7 @@ ConsensusNetIO::OnData(const uint8_t * data,
             << " payload=" << payload_size;
 
     bool error = false;
-    logos::bufferstream stream(data, payload_size);
+    logos::span_reader stream(data, payload_size);
 
     LOG_DEBUG(_log) << "ConsensusNetIO::OnData - received message type " << MessageToName(message_type)
                     << " for consensus type " << ConsensusToName(consensus_type)
@@ -812,7 +812,7 @@ ConsensusNetIO::OnMessage(std::shared_ptr<MessageBase> message,
 
 template<template <ConsensusType> class T>
 std::shared_ptr<MessageBase>
-ConsensusNetIO::make(ConsensusType consensus_type, logos::bufferstream &stream, uint8_t version)
+ConsensusNetIO::make(ConsensusType consensus_type, logos::span_reader &stream, uint8_t version)
 {
     bool error = false;
     std::shared_ptr<MessageBase> msg;
@@ -847,7 +847,7 @@ std::shared_ptr<MessageBase>
 ConsensusNetIO::Parse(const uint8_t * data, uint8_t version, MessageType message_type,
                       ConsensusType consensus_type, uint32_t payload_size)
 {
-    logos::bufferstream stream(data, payload_size);
+    logos::span_reader stream(data, payload_size);
     std::shared_ptr<MessageBase> msg = nullptr;
 
     switch (message_type)
@@ -321,7 +321,7 @@ private:
 
     template<template <ConsensusType> class T>
     std::shared_ptr<MessageBase>
-    make(ConsensusType consensus_type, logos::bufferstream &stream, uint8_t version);
+    make(ConsensusType consensus_type, logos::span_reader &stream, uint8_t version);
 
     std::shared_ptr<Socket>        _socket;               ///< Connected socket
     std::atomic_bool               _connected;            ///< is the socket is connected?
@@ -14,7 +14,27 @@ NetIOSend::AsyncSend(std::shared_ptr<std::vector<uint8_t>> buf)
         return false;
     }
 
-    _queued_writes.push_back(buf);
+    _queued_writes.push_back({buf, boost::asio::buffer(buf->data(), buf->size())});
+
+    if (!_sending)
+    {
+        AsyncSendBuffered();
+    }
+
+    return true;
+}
+
+bool
+NetIOSend::AsyncSend(std::vector<QueuedWrite> buffers)
+{
+    std::lock_guard<std::mutex> lock(_send_mutex);
+
+    if (nullptr == _socket)
+    {
+        return false;
+    }
+
+    _queued_writes.insert(_queued_writes.end(), buffers.begin(), buffers.end());
 
     if (!_sending)
     {
@@ -47,11 +67,11 @@ NetIOSend::AsyncSendBuffered()
     if (_queue_reservation)
     {
         _sending = true;
-        std::vector<boost::asio::const_buffer> bufs;
+        Buffers bufs;
 
-        for (auto b: _queued_writes)
+        for (auto & b: _queued_writes)
         {
-            bufs.push_back(boost::asio::buffer(b->data(), b->size()));
+            bufs.push_back(b.buffer);
         }
 
         std::weak_ptr<NetIOSend> this_w = shared_from_this();
@@ -17,7 +17,16 @@ class NetIOSend : public Self<NetIOSend>
 {
     using Socket        = boost::asio::ip::tcp::socket;
     using Error         = boost::system::error_code;
-    using QueuedWrites  = std::list<std::shared_ptr<std::vector<uint8_t>>>;
+    using Buffers       = std::vector<boost::asio::const_buffer>;
+public:
+    /// A queued buffer and the object that keeps its memory alive
+    struct QueuedWrite
+    {
+        std::shared_ptr<const void> owner;
+        boost::asio::const_buffer   buffer;
+    };
+private:
+    using QueuedWrites  = std::list<QueuedWrite>;
 public:
     /// Class constructor
     /// @param socket to write to
@@ -31,6 +40,13 @@ public:
     /// @return false if the socket is null, true otherwise
     bool AsyncSend(std::shared_ptr<std::vector<uint8_t>> buf);
 
+    /// Send the buffers, in order and without copying them. The memory they
+    /// reference must be kept alive by the owners, which are held until the
+    /// buffers are written.
+    /// @param buffers to write, with their owners [in]
+    /// @return false if the socket is null, true otherwise
+    bool AsyncSend(std::vector<QueuedWrite> buffers);
+
     operator std::shared_ptr<Socket> () {return _socket;}
 
 protected:
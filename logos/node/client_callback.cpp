@@ -1,5 +1,7 @@
 #include <logos/node/client_callback.hpp>
 
+#include <boost/asio/connect.hpp>
+
 std::shared_ptr<BlocksCallback> BlocksCallback::_instance = nullptr;
 
 ClientCallback::ClientCallback(Service & service,
@@ -14,22 +16,37 @@ ClientCallback::ClientCallback(Service & service,
     , _callback_logging (callback_logging)
 {}
 
+constexpr std::chrono::seconds BlocksCallback::RETRY_DELAY;
+
 BlocksCallback::BlocksCallback(Service & service,
                                const std::string & callback_address,
                                const uint16_t & callback_port,
                                const std::string & callback_target,
-                               const bool & callback_logging)
+                               const bool & callback_logging,
+                               const CallbackOptions & options)
         : ClientCallback (service, callback_address, callback_port, callback_target, callback_logging)
-{}
+        , _options (options)
+        , _resolve_timer (service)
+{
+    _options.connections = std::max<uint16_t> (_options.connections, 1);
+    _options.batch_size = std::max<uint16_t> (_options.batch_size, 1);
+    _options.queue_limit = std::max<uint32_t> (_options.queue_limit, 1);
+
+    for (uint16_t i = 0; i < _options.connections; ++i)
+    {
+        _connections.push_back (std::make_shared<Connection> (service));
+    }
+}
 
 std::shared_ptr<BlocksCallback> BlocksCallback::Instance(Service & service,
         const std::string & callback_address,
         const uint16_t & callback_port,
         const std::string & callback_target,
-        const bool & callback_logging)
+        const bool & callback_logging,
+        const CallbackOptions & options)
 {
     static std::shared_ptr<BlocksCallback> inst(new BlocksCallback(
-            service, callback_address, callback_port, callback_target, callback_logging));
+            service, callback_address, callback_port, callback_target, callback_logging, options));
     if (BlocksCallback::_instance == nullptr)
     {
         BlocksCallback::_instance = inst;
@@ -37,83 +54,242 @@ std::shared_ptr<BlocksCallback> BlocksCallback::Instance(Service & service,
     return inst;
 };
 
+std::shared_ptr<BlocksCallback> BlocksCallback::Instance()
+{
+    return _instance;
+}
+
 void BlocksCallback::SendMessage (std::shared_ptr<std::string> body)
 {
-    if (!_callback_address.empty ())
+    if (_callback_address.empty ())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock (_mutex);
+    if (_queue.size () >= _options.queue_limit)
+    {
+        _queue.pop_front ();
+        _stats.dropped++;
+    }
+    _queue.push_back ({body, 0});
+    Dispatch ();
+}
+
+BlocksCallback::Stats BlocksCallback::GetStats ()
+{
+    std::lock_guard<std::mutex> lock (_mutex);
+    auto stats (_stats);
+    stats.queued = _queue.size ();
+    return stats;
+}
+
+void BlocksCallback::Dispatch ()
+{
+    if (_queue.empty ())
+    {
+        return;
+    }
+
+    if (_endpoints.empty ())
+    {
+        Resolve ();
+        return;
+    }
+
+    for (auto & connection : _connections)
+    {
+        if (_queue.empty ())
+        {
+            break;
+        }
+        if (connection->busy)
+        {
+            continue;
+        }
+
+        auto batch (std::make_shared<Batch> ());
+        while (!_queue.empty () && batch->size () < _options.batch_size)
+        {
+            batch->push_back (std::move (_queue.front ()));
+            _queue.pop_front ();
+        }
+
+        connection->busy = true;
+        if (connection->open)
+        {
+            Post (connection, batch);
+        }
+        else
+        {
+            Connect (connection, batch);
+        }
+    }
+}
+
+void BlocksCallback::Resolve ()
+{
+    if (_resolving)
+    {
+        return;
+    }
+    _resolving = true;
+
+    auto resolver (std::make_shared<TCP::resolver> (_service));
+    resolver->async_resolve (TCP::resolver::query (_callback_address, std::to_string (_callback_port)), [this, resolver](boost::system::error_code const & ec, TCP::resolver::iterator i_a) {
+        std::lock_guard<std::mutex> lock (_mutex);
+        _resolving = false;
+
+        if (ec)
+        {
+            if (_callback_logging)
+            {
+                LOG_WARN (_log) << boost::str (boost::format ("Error resolving callback: %1%:%2%: %3%") % _callback_address % _callback_port % ec.message ());
+            }
+            _resolve_timer.expires_from_now (boost::posix_time::seconds (RETRY_DELAY.count ()));
+            _resolve_timer.async_wait ([this](boost::system::error_code const & ec) {
+                std::lock_guard<std::mutex> lock (_mutex);
+                Dispatch ();
+            });
+            return;
+        }
+
+        for (auto i (i_a), n (TCP::resolver::iterator{}); i != n; ++i)
+        {
+            _endpoints.push_back (i->endpoint ());
+        }
+        Dispatch ();
+    });
+}
+
+void BlocksCallback::Connect (ConnectionPtr connection, std::shared_ptr<Batch> batch)
+{
+    auto endpoints (std::make_shared<std::vector<TCP::endpoint>> (_endpoints));
+    boost::asio::async_connect (connection->socket, endpoints->begin (), endpoints->end (), [this, connection, batch, endpoints](boost::system::error_code const & ec, std::vector<TCP::endpoint>::iterator) {
+        if (ec)
+        {
+            OnFailure (connection, batch, "Unable to connect to callback address", ec.message ());
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock (_mutex);
+            connection->open = true;
+        }
+        Post (connection, batch);
+    });
+}
+
+void BlocksCallback::Post (ConnectionPtr connection, std::shared_ptr<Batch> batch)
+{
+    auto req (std::make_shared<HTTP::request<HTTP::string_body>> ());
+    req->method (HTTP::verb::post);
+    req->target (_callback_target);
+    req->version (11);
+    req->insert (HTTP::field::host, _callback_address);
+    req->insert (HTTP::field::content_type, "application/json");
+    req->keep_alive (true);
+
+    auto & body (req->body ());
+    if (_options.batch_size == 1)
     {
-        auto target (std::make_shared<std::string> (_callback_target));
-        auto resolver (std::make_shared<TCP::resolver> (_service));
-        resolver->async_resolve (TCP::resolver::query (_callback_address, std::to_string (_callback_port)), [this, target, body, resolver](boost::system::error_code const & ec, TCP::resolver::iterator i_a) {
-            if (!ec)
+        body = *batch->front ().body;
+    }
+    else
+    {
+        body = "[";
+        for (auto & pending : *batch)
+        {
+            if (body.size () > 1)
+            {
+                body += ",";
+            }
+            body += *pending.body;
+        }
+        body += "]";
+    }
+    req->prepare_payload ();
+
+    HTTP::async_write (connection->socket, *req, [this, connection, batch, req](boost::system::error_code const & ec, size_t bytes_transferred) {
+        if (ec)
+        {
+            OnFailure (connection, batch, "Unable to send callback", ec.message ());
+            return;
+        }
+
+        auto sb (std::make_shared<boost::beast::flat_buffer> ());
+        auto resp (std::make_shared<HTTP::response<HTTP::string_body>> ());
+        HTTP::async_read (connection->socket, *sb, *resp, [this, connection, batch, sb, resp](boost::system::error_code const & ec, size_t bytes_transferred) {
+            if (ec)
             {
-                for (auto i (i_a), n (TCP::resolver::iterator{}); i != n; ++i)
-                {
-                    auto sock (std::make_shared<TCP::socket> (_service));
-                    sock->async_connect (i->endpoint (), [this, target, body, sock](boost::system::error_code const & ec) {
-                        if (!ec)
-                        {
-                            auto req (std::make_shared<HTTP::request<HTTP::string_body>> ());
-                            req->method (HTTP::verb::post);
-                            req->target (*target);
-                            req->version (11);
-                            req->insert (HTTP::field::host, _callback_address);
-                            req->insert (HTTP::field::content_type, "application/json");
-                            req->body () = *body;
-                            req->prepare_payload ();
-                            HTTP::async_write (*sock, *req, [this, sock, req](boost::system::error_code const & ec, size_t bytes_transferred) {
-                                if (!ec)
-                                {
-                                    auto sb (std::make_shared<boost::beast::flat_buffer> ());
-                                    auto resp (std::make_shared<HTTP::response<HTTP::string_body>> ());
-                                    HTTP::async_read (*sock, *sb, *resp, [this, sb, resp, sock](boost::system::error_code const & ec, size_t bytes_transferred) {
-                                        if (!ec)
-                                        {
-                                            if (resp->result () == HTTP::status::ok)
-                                            {
-                                            }
-                                            else
-                                            {
-                                                if (_callback_logging)
-                                                {
-                                                    LOG_WARN (_log) << boost::str (boost::format ("Callback to %1%:%2% failed with status: %3%") % _callback_address % _callback_port % resp->result ());
-                                                }
-                                            }
-                                        }
-                                        else
-                                        {
-                                            if (_callback_logging)
-                                            {
-                                                LOG_WARN (_log) << boost::str (boost::format ("Unable complete callback: %1%:%2%: %3%") % _callback_address % _callback_port % ec.message ());
-                                            }
-                                        };
-                                    });
-                                }
-                                else
-                                {
-                                    if (_callback_logging)
-                                    {
-                                        LOG_WARN (_log) << boost::str (boost::format ("Unable to send callback: %1%:%2%: %3%") % _callback_address % _callback_port % ec.message ());
-                                    }
-                                }
-                            });
-                        }
-                        else
-                        {
-                            if (_callback_logging)
-                            {
-                                LOG_WARN (_log) << boost::str (boost::format ("Unable to connect to callback address: %1%:%2%: %3%") % _callback_address % _callback_port % ec.message ());
-                            }
-                        }
-                    });
-                }
+                OnFailure (connection, batch, "Unable complete callback", ec.message ());
+            }
+            else if (resp->result () != HTTP::status::ok)
+            {
+                OnFailure (connection, batch, "Callback failed with status", std::to_string (resp->result_int ()));
             }
             else
             {
-                if (_callback_logging)
-                {
-                    LOG_WARN (_log) << boost::str (boost::format ("Error resolving callback: %1%:%2%: %3%") % _callback_address % _callback_port % ec.message ());
-                }
+                OnDelivered (connection, batch, resp->keep_alive ());
             }
         });
+    });
+}
+
+void BlocksCallback::OnFailure (ConnectionPtr connection, std::shared_ptr<Batch> batch,
+                                const std::string & what, const std::string & reason)
+{
+    if (_callback_logging)
+    {
+        LOG_WARN (_log) << boost::str (boost::format ("%1%: %2%:%3%: %4%") % what % _callback_address % _callback_port % reason);
+    }
+
+    std::lock_guard<std::mutex> lock (_mutex);
+
+    boost::system::error_code ec_ignore;
+    connection->socket.close (ec_ignore);
+    connection->open = false;
+
+    // Retried blocks keep their place ahead of newer ones.
+    for (auto pending (batch->rbegin ()); pending != batch->rend (); ++pending)
+    {
+        if (pending->attempts < _options.retries)
+        {
+            pending->attempts++;
+            _queue.push_front (*pending);
+            _stats.retried++;
+        }
+        else
+        {
+            _stats.dropped++;
+        }
+    }
+    while (_queue.size () > _options.queue_limit)
+    {
+        _queue.pop_front ();
+        _stats.dropped++;
+    }
+
+    // Back off before the connection is used again.
+    connection->timer.expires_from_now (boost::posix_time::seconds (RETRY_DELAY.count ()));
+    connection->timer.async_wait ([this, connection](boost::system::error_code const & ec) {
+        std::lock_guard<std::mutex> lock (_mutex);
+        connection->busy = false;
+        Dispatch ();
+    });
+}
+
+void BlocksCallback::OnDelivered (ConnectionPtr connection, std::shared_ptr<Batch> batch, bool keep_alive)
+{
+    std::lock_guard<std::mutex> lock (_mutex);
+
+    _stats.sent += batch->size ();
+    if (!keep_alive)
+    {
+        boost::system::error_code ec_ignore;
+        connection->socket.close (ec_ignore);
+        connection->open = false;
     }
+    connection->busy = false;
+    Dispatch ();
 }
@@ -5,13 +5,19 @@
 #pragma once
 
 #include <logos/consensus/messages/messages.hpp>
+#include <logos/consensus/messages/util.hpp>
 #include <logos/lib/utility.hpp>
 #include <logos/lib/log.hpp>
 
+#include <boost/asio/deadline_timer.hpp>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/beast/core/flat_buffer.hpp>
 #include <boost/beast/http.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <deque>
+#include <mutex>
 
 namespace // unnamed namespace to prevent visibility in other files
 {
@@ -44,18 +50,68 @@ protected:
 };
 
 
+/// Delivery options of BlocksCallback
+struct CallbackOptions
+{
+    uint16_t connections = 4;       ///< persistent connections to the callback address
+    uint16_t batch_size  = 1;       ///< blocks per POST, above 1 the body is a JSON array of blocks
+    uint32_t queue_limit = 4096;    ///< queued blocks, the oldest are dropped beyond it
+    uint8_t  retries     = 3;       ///< delivery attempts of a block after the first
+    bool     compact     = false;   ///< send only the type and hash of each block
+};
+
+/// Posts committed blocks to the callback address over a pool of
+/// keep-alive connections. Blocks are queued and sent in batches by
+/// whichever connection is idle; failed batches are retried, and blocks
+/// that can't be delivered or queued are dropped and counted.
 class BlocksCallback : public ClientCallback
 {
-private:
+    using Timer = boost::asio::deadline_timer;
+
+    struct Pending
+    {
+        std::shared_ptr<std::string> body;
+        uint8_t                      attempts;
+    };
+
+    using Batch = std::vector<Pending>;
+
+    struct Connection
+    {
+        Connection(Service & service)
+            : socket(service)
+            , timer(service)
+        {}
+
+        TCP::socket socket;
+        Timer       timer;
+        bool        open = false;
+        bool        busy = false;
+    };
+
+    using ConnectionPtr = std::shared_ptr<Connection>;
+
+    static std::shared_ptr<BlocksCallback> _instance;
+
+public:
+
+    /// The node's instance is created by Instance; other instances, e.g. in
+    /// tests, must outlive their service's handlers.
     BlocksCallback(Service & service,
                    const std::string & callback_address,
                    const uint16_t & callback_port,
                    const std::string & callback_target,
-                   const bool & callback_logging);
+                   const bool & callback_logging,
+                   const CallbackOptions & options);
 
-    static std::shared_ptr<BlocksCallback> _instance;
-
-public:
+    /// Delivery counters
+    struct Stats
+    {
+        uint64_t sent    = 0;   ///< blocks delivered
+        uint64_t retried = 0;   ///< blocks requeued after a failed POST
+        uint64_t dropped = 0;   ///< blocks given up on, or dropped from a full queue
+        uint64_t queued  = 0;   ///< blocks waiting for a connection
+    };
 
     ~BlocksCallback() {}
 
@@ -64,15 +120,40 @@ public:
             const std::string & callback_address,
             const uint16_t & callback_port,
             const std::string & callback_target,
-            const bool & callback_logging);
+            const bool & callback_logging,
+            const CallbackOptions & options = CallbackOptions());
+
+    /// The instance created by the overload above, null before it's called.
+    static std::shared_ptr<BlocksCallback> Instance();
 
+    /// Queue a block for delivery.
+    /// @param body the block's JSON [in]
     void SendMessage (std::shared_ptr<std::string> body);
 
+    Stats GetStats();
+
     template <ConsensusType CT>
     void NotifyClient (PostCommittedBlock<CT> const &block)
     { // implementation of non-specialized template needs to be visible to all usages
+        if (_callback_address.empty ())
+        {
+            return;
+        }
+
         _service.post([this, block] () {
-            SendMessage(std::make_shared<std::string> (block.ToJson ()));
+            if (_options.compact)
+            {
+                boost::property_tree::ptree tree;
+                tree.put ("type", ConsensusToName (CT));
+                tree.put ("hash", block.Hash ().to_string ());
+                std::stringstream stream;
+                boost::property_tree::write_json (stream, tree, false);
+                SendMessage(std::make_shared<std::string> (stream.str ()));
+            }
+            else
+            {
+                SendMessage(std::make_shared<std::string> (block.ToJson ()));
+            }
         });
     }
 
@@ -82,4 +163,26 @@ public:
         _instance->NotifyClient(block);
     }
 
+private:
+
+    static constexpr std::chrono::seconds RETRY_DELAY{1};
+
+    /// Hand queued blocks to idle connections. _mutex must be held.
+    void Dispatch();
+    void Resolve();
+    void Connect(ConnectionPtr connection, std::shared_ptr<Batch> batch);
+    void Post(ConnectionPtr connection, std::shared_ptr<Batch> batch);
+    /// Requeue or drop the batch, and close the connection for RETRY_DELAY.
+    void OnFailure(ConnectionPtr connection, std::shared_ptr<Batch> batch,
+                   const std::string & what, const std::string & reason);
+    void OnDelivered(ConnectionPtr connection, std::shared_ptr<Batch> batch, bool keep_alive);
+
+    CallbackOptions                 _options;
+    std::mutex                      _mutex;
+    std::deque<Pending>             _queue;
+    std::vector<ConnectionPtr>      _connections;
+    std::vector<TCP::endpoint>      _endpoints;   ///< resolved callback address, empty until resolved
+    Timer                           _resolve_timer;
+    bool                            _resolving = false;
+    Stats                           _stats;
 };
@@ -0,0 +1,229 @@
+#include <logos/node/executor_lanes.hpp>
+
+#include <logos/lib/trace.hpp>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+constexpr size_t ExecutorLanes::NUM_LANES;
+constexpr std::chrono::seconds ExecutorLanes::PROBE_INTERVAL;
+
+namespace
+{
+
+// Nice values by lane, in Lane order.
+const std::array<int, ExecutorLanes::NUM_LANES> LANE_NICE = {0, 2, 5, 10};
+
+uint64_t Microseconds(std::chrono::steady_clock::duration duration)
+{
+    auto count = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    return count < 0 ? 0 : count;
+}
+
+}
+
+void LaneStats::SerializeJson(boost::property_tree::ptree & tree) const
+{
+    tree.put("threads", std::to_string(threads));
+    tree.put("queued", std::to_string(queued));
+    tree.put("executed", std::to_string(executed));
+    tree.put("average_wait_us", std::to_string(average_wait));
+    tree.put("max_wait_us", std::to_string(max_wait));
+    tree.put("probe_delay_us", std::to_string(probe_delay));
+}
+
+ExecutorLanes::ExecutorLanes(const ExecutorLanesConfig & config)
+    : _shared(false)
+{
+    const std::array<unsigned, NUM_LANES> threads = {
+        config.consensus_threads,
+        config.persistence_threads,
+        config.network_threads,
+        config.rpc_threads
+    };
+
+    for(size_t i = 0; i < NUM_LANES; ++i)
+    {
+        auto & state = _lanes[i];
+        state.owned = std::make_unique<Service>();
+        state.service = state.owned.get();
+        state.work = std::make_unique<Service::work>(*state.service);
+        state.probe = std::make_unique<Timer>(*state.service);
+        state.num_threads = threads[i];
+        state.nice = LANE_NICE[i];
+    }
+}
+
+ExecutorLanes::ExecutorLanes(Service & service)
+    : _shared(true)
+{
+    for(auto & state : _lanes)
+    {
+        state.service = &service;
+    }
+}
+
+ExecutorLanes::~ExecutorLanes()
+{
+    Stop();
+    Join();
+}
+
+ExecutorLanes::Service & ExecutorLanes::GetService(Lane lane)
+{
+    return *_lanes[static_cast<size_t>(lane)].service;
+}
+
+void ExecutorLanes::Start()
+{
+    if(_shared)
+    {
+        return;
+    }
+
+    for(auto & state : _lanes)
+    {
+        ScheduleProbe(state);
+
+        for(unsigned i = 0; i < state.num_threads; ++i)
+        {
+            state.threads.emplace_back([this, &state]() {
+                RunThread(state);
+            });
+        }
+    }
+}
+
+void ExecutorLanes::Stop()
+{
+    if(_shared || _stopped.exchange(true))
+    {
+        return;
+    }
+
+    for(auto & state : _lanes)
+    {
+        auto probe = state.probe.get();
+        state.service->post([probe]() {
+            probe->cancel();
+        });
+        state.work.reset();
+    }
+}
+
+void ExecutorLanes::Join()
+{
+    for(auto & state : _lanes)
+    {
+        for(auto & thread : state.threads)
+        {
+            if(thread.joinable())
+            {
+                thread.join();
+            }
+        }
+    }
+}
+
+LaneStats ExecutorLanes::GetStats(Lane lane)
+{
+    auto & state = _lanes[static_cast<size_t>(lane)];
+
+    LaneStats stats;
+    stats.threads = state.num_threads;
+    stats.queued = state.queued;
+    stats.executed = state.executed;
+    stats.average_wait = stats.executed ? state.total_wait / stats.executed : 0;
+    stats.max_wait = state.max_wait.exchange(0);
+    stats.probe_delay = state.probe_delay;
+
+    return stats;
+}
+
+void ExecutorLanes::SerializeJson(boost::property_tree::ptree & tree)
+{
+    for(size_t i = 0; i < NUM_LANES; ++i)
+    {
+        auto lane = static_cast<Lane>(i);
+        boost::property_tree::ptree lane_tree;
+        GetStats(lane).SerializeJson(lane_tree);
+        tree.add_child(LaneName(lane), lane_tree);
+    }
+}
+
+const char * ExecutorLanes::LaneName(Lane lane)
+{
+    switch(lane)
+    {
+        case Lane::Consensus:
+            return "consensus";
+        case Lane::Persistence:
+            return "persistence";
+        case Lane::Network:
+            return "network";
+        case Lane::Rpc:
+            return "rpc";
+    }
+
+    return "unknown";
+}
+
+void ExecutorLanes::LaneState::Record(Clock::duration wait)
+{
+    auto micros = Microseconds(wait);
+
+    queued--;
+    executed++;
+    total_wait += micros;
+
+    auto max = max_wait.load();
+    while(micros > max && !max_wait.compare_exchange_weak(max, micros))
+    {}
+}
+
+void ExecutorLanes::ScheduleProbe(LaneState & state)
+{
+    // The probe's lateness is the time its expired handler waited behind
+    // other work, which covers handlers not posted through Post.
+    auto expected = Clock::now() + PROBE_INTERVAL;
+
+    state.probe->expires_from_now(boost::posix_time::seconds(PROBE_INTERVAL.count()));
+    state.probe->async_wait([this, &state, expected](const boost::system::error_code & ec) {
+        if(ec || _stopped)
+        {
+            return;
+        }
+
+        state.probe_delay = Microseconds(Clock::now() - expected);
+        ScheduleProbe(state);
+    });
+}
+
+void ExecutorLanes::RunThread(LaneState & state)
+{
+#ifdef __linux__
+    if(state.nice && setpriority(PRIO_PROCESS, syscall(SYS_gettid), state.nice))
+    {
+        LOG_WARN(_log) << "ExecutorLanes::RunThread - failed to set nice value " << state.nice;
+    }
+#endif
+
+    try
+    {
+        state.service->run();
+    }
+    catch (const std::exception &exc)
+    {
+        LOG_FATAL(_log) << exc.what();
+        trace_and_halt();
+    }
+    catch (...)
+    {
+        std::exception_ptr p = std::current_exception();
+        LOG_FATAL(_log) << "Unhandled service exception! " << (p ? p.__cxa_exception_type()->name() : "null");
+        trace_and_halt();
+    }
+}
@@ -0,0 +1,158 @@
+/// @file
+/// This file contains the declaration of ExecutorLanes, which runs the node's
+/// asynchronous work on separate, prioritized io_services.
+#pragma once
+
+#include <logos/lib/log.hpp>
+
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <array>
+
+/// Lanes in decreasing order of priority.
+enum class Lane : uint8_t
+{
+    Consensus,      ///< consensus messages and timers
+    Persistence,    ///< block write queue dependency callbacks
+    Network,        ///< bootstrap
+    Rpc,            ///< RPC, websocket and client callbacks
+};
+
+/// The consensus lane takes the place of the node's single io_service, so
+/// its size is the node config's io_threads rather than an entry here.
+struct ExecutorLanesConfig
+{
+    bool DeserializeJson(boost::property_tree::ptree & tree)
+    {
+        persistence_threads = tree.get<unsigned>("persistence_threads", persistence_threads);
+        network_threads = tree.get<unsigned>("network_threads", network_threads);
+        rpc_threads = tree.get<unsigned>("rpc_threads", rpc_threads);
+
+        return consensus_threads == 0 || persistence_threads == 0 ||
+               network_threads == 0 || rpc_threads == 0;
+    }
+
+    bool SerializeJson(boost::property_tree::ptree & tree) const
+    {
+        tree.put("persistence_threads", persistence_threads);
+        tree.put("network_threads", network_threads);
+        tree.put("rpc_threads", rpc_threads);
+
+        return false;
+    }
+
+    unsigned consensus_threads   = std::max<unsigned>(4, std::thread::hardware_concurrency());
+    unsigned persistence_threads = 2;
+    unsigned network_threads     = 2;
+    unsigned rpc_threads         = 2;
+};
+
+/// Queue depth and latency of a lane.
+struct LaneStats
+{
+    void SerializeJson(boost::property_tree::ptree & tree) const;
+
+    unsigned threads        = 0;
+    uint64_t queued         = 0; ///< handlers posted with ExecutorLanes::Post and not yet run
+    uint64_t executed       = 0; ///< handlers run since the lanes started
+    uint64_t average_wait   = 0; ///< mean queueing delay of posted handlers, microseconds
+    uint64_t max_wait       = 0; ///< maximum queueing delay since the last query, microseconds
+    uint64_t probe_delay    = 0; ///< lateness of the lane's last periodic timer, microseconds
+};
+
+/// Runs each lane on its own io_service and threads, so that a burst of
+/// RPC or bootstrap work can't delay consensus. Lower priority lanes run
+/// at a higher nice value.
+///
+/// A default lanes object built on a single service maps every lane onto
+/// it and owns no threads; this keeps tests and tools that run one
+/// io_service working unchanged.
+class ExecutorLanes
+{
+    using Service  = boost::asio::io_service;
+    using Clock    = std::chrono::steady_clock;
+    using Timer    = boost::asio::deadline_timer;
+
+public:
+
+    static constexpr size_t NUM_LANES = 4;
+
+    /// Owned services, one per lane. Threads run once Start is called.
+    ExecutorLanes(const ExecutorLanesConfig & config);
+
+    /// All lanes share the given service, which the caller runs.
+    explicit ExecutorLanes(Service & service);
+
+    ~ExecutorLanes();
+
+    Service & GetService(Lane lane);
+
+    /// Post a handler to the lane, recording its queueing delay.
+    template<typename Handler>
+    void Post(Lane lane, Handler handler)
+    {
+        auto & state = _lanes[static_cast<size_t>(lane)];
+        auto posted = Clock::now();
+
+        state.queued++;
+        state.service->post([&state, posted, handler]() mutable {
+            state.Record(Clock::now() - posted);
+            handler();
+        });
+    }
+
+    /// Start the lane threads and latency probes. Does nothing when
+    /// the lanes share a service.
+    void Start();
+
+    /// Let the lanes run out of work; threads exit once they're idle.
+    void Stop();
+
+    /// Wait for all lane threads to exit.
+    void Join();
+
+    /// Snapshot of a lane's metrics. Resets its max_wait.
+    LaneStats GetStats(Lane lane);
+
+    /// All lanes' metrics, keyed by lane name.
+    void SerializeJson(boost::property_tree::ptree & tree);
+
+    static const char * LaneName(Lane lane);
+
+private:
+
+    static constexpr std::chrono::seconds PROBE_INTERVAL{1};
+
+    struct LaneState
+    {
+        void Record(Clock::duration wait);
+
+        Service *                       service = nullptr;
+        std::unique_ptr<Service>        owned;
+        std::unique_ptr<Service::work>  work;
+        std::unique_ptr<Timer>          probe;
+        std::vector<std::thread>        threads;
+        unsigned                        num_threads = 0;
+        int                             nice = 0;
+        std::atomic<uint64_t>           queued{0};
+        std::atomic<uint64_t>           executed{0};
+        std::atomic<uint64_t>           total_wait{0};
+        std::atomic<uint64_t>           max_wait{0};
+        std::atomic<uint64_t>           probe_delay{0};
+    };
+
+    void ScheduleProbe(LaneState & state);
+    void RunThread(LaneState & state);
+
+    std::array<LaneState, NUM_LANES> _lanes;
+    std::atomic_bool                 _stopped{false};
+    bool                             _shared;
+    Log                              _log;
+};
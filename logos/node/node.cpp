@@ -532,7 +532,13 @@ enable_voting (true),
 enable_websocket (true),
 bootstrap_connections (4),
 bootstrap_connections_max (64),
+validation_threads (std::min<unsigned> (NUM_DELEGATES, std::max<unsigned> (1, std::thread::hardware_concurrency ()))),
 callback_port (0),
+callback_connections (CallbackOptions ().connections),
+callback_batch_size (CallbackOptions ().batch_size),
+callback_queue_limit (CallbackOptions ().queue_limit),
+callback_retries (CallbackOptions ().retries),
+callback_compact (CallbackOptions ().compact),
 lmdb_max_dbs (128),
 state_block_parse_canary (0),
 state_block_generate_canary (0)
@@ -580,10 +586,17 @@ void logos::node_config::serialize_json (boost::property_tree::ptree & tree_a) c
     tree_a.put ("enable_websocket", enable_websocket);
     tree_a.put ("bootstrap_connections", bootstrap_connections);
     tree_a.put ("bootstrap_connections_max", bootstrap_connections_max);
+    tree_a.put ("validation_threads", validation_threads);
     tree_a.put ("callback_address", callback_address);
     tree_a.put ("callback_port", std::to_string (callback_port));
     tree_a.put ("callback_target", callback_target);
+    tree_a.put ("callback_connections", callback_connections);
+    tree_a.put ("callback_batch_size", callback_batch_size);
+    tree_a.put ("callback_queue_limit", callback_queue_limit);
+    tree_a.put ("callback_retries", std::to_string (callback_retries));
+    tree_a.put ("callback_compact", callback_compact);
     tree_a.put ("lmdb_max_dbs", lmdb_max_dbs);
+    tree_a.put ("lmdb_history_path", lmdb_history_path);
     tree_a.put ("state_block_parse_canary", state_block_parse_canary.to_string ());
     tree_a.put ("state_block_generate_canary", state_block_generate_canary.to_string ());
 
@@ -595,6 +608,18 @@ void logos::node_config::serialize_json (boost::property_tree::ptree & tree_a) c
     boost::property_tree::ptree tx_acceptor;
     tx_acceptor_config.SerializeJson(tx_acceptor);
     tree_a.add_child("TxAcceptor", tx_acceptor);
+
+    boost::property_tree::ptree snapshot;
+    snapshot_config.SerializeJson(snapshot);
+    tree_a.add_child("StateSnapshot", snapshot);
+
+    boost::property_tree::ptree segments;
+    segment_config.SerializeJson(segments);
+    tree_a.add_child("SegmentArchive", segments);
+
+    boost::property_tree::ptree lanes;
+    lanes_config.SerializeJson(lanes);
+    tree_a.add_child("ExecutorLanes", lanes);
 }
 
 bool logos::node_config::upgrade_json (unsigned version, boost::property_tree::ptree & tree_a)
@@ -772,10 +797,19 @@ bool logos::node_config::deserialize_json (bool & upgraded_a, boost::property_tr
         enable_websocket = tree_a.get<bool> ("enable_websocket", false);
         auto bootstrap_connections_l (tree_a.get<std::string> ("bootstrap_connections"));
         auto bootstrap_connections_max_l (tree_a.get<std::string> ("bootstrap_connections_max"));
+        validation_threads = tree_a.get<unsigned> ("validation_threads", validation_threads);
         callback_address = tree_a.get<std::string> ("callback_address");
         auto callback_port_l (tree_a.get<std::string> ("callback_port"));
         callback_target = tree_a.get<std::string> ("callback_target");
+        callback_connections = tree_a.get<uint16_t> ("callback_connections", callback_connections);
+        callback_batch_size = tree_a.get<uint16_t> ("callback_batch_size", callback_batch_size);
+        callback_queue_limit = tree_a.get<uint32_t> ("callback_queue_limit", callback_queue_limit);
+        auto callback_retries_l (tree_a.get<unsigned> ("callback_retries", callback_retries));
+        result |= callback_retries_l > std::numeric_limits<uint8_t>::max ();
+        callback_retries = callback_retries_l;
+        callback_compact = tree_a.get<bool> ("callback_compact", callback_compact);
         auto lmdb_max_dbs_l = tree_a.get<std::string> ("lmdb_max_dbs");
+        lmdb_history_path = tree_a.get<std::string> ("lmdb_history_path", "");
         result |= parse_port (callback_port_l, callback_port);
         auto state_block_parse_canary_l = tree_a.get<std::string> ("state_block_parse_canary");
         auto state_block_generate_canary_l = tree_a.get<std::string> ("state_block_generate_canary");
@@ -798,6 +832,8 @@ bool logos::node_config::deserialize_json (bool & upgraded_a, boost::property_tr
             result |= password_fanout < 16;
             result |= password_fanout > 1024 * 1024;
             result |= io_threads == 0;
+            lanes_config.consensus_threads = io_threads;
+            result |= validation_threads == 0;
             result |= state_block_parse_canary.decode_hex (state_block_parse_canary_l);
             result |= state_block_generate_canary.decode_hex (state_block_generate_canary_l);
         }
@@ -816,6 +852,24 @@ bool logos::node_config::deserialize_json (bool & upgraded_a, boost::property_tr
             result |= tx_acceptor_config.DeserializeJson(tree_a.get_child("ConsensusManager"));
         }
 
+        auto snapshot_l (tree_a.get_child_optional ("StateSnapshot"));
+        if (snapshot_l)
+        {
+            result |= snapshot_config.DeserializeJson(snapshot_l.get ());
+        }
+
+        auto segments_l (tree_a.get_child_optional ("SegmentArchive"));
+        if (segments_l)
+        {
+            result |= segment_config.DeserializeJson(segments_l.get ());
+        }
+
+        auto lanes_l (tree_a.get_child_optional ("ExecutorLanes"));
+        if (lanes_l)
+        {
+            result |= lanes_config.DeserializeJson(lanes_l.get ());
+        }
+
     }
     catch (std::runtime_error const &)
     {
@@ -832,17 +886,29 @@ logos::account logos::node_config::random_representative ()
     return result;
 }
 
+boost::filesystem::path logos::node_config::history_path (boost::filesystem::path const & application_path_a) const
+{
+    boost::filesystem::path result (lmdb_history_path);
+    if (!result.empty () && result.is_relative ())
+    {
+        result = application_path_a / result;
+    }
+    return result;
+}
+
 logos::node::node (logos::node_init & init_a, boost::asio::io_service & service_a, uint16_t peering_port_a, boost::filesystem::path const & application_path_a, logos::alarm & alarm_a, logos::logging const & logging_a/*, logos::work_pool & work_a*/) :
 node (init_a, service_a, application_path_a, alarm_a, logos::node_config (peering_port_a, logging_a)/*, work_a*/)
 {
 }
 
-logos::node::node (logos::node_init & init_a, boost::asio::io_service & service_a, boost::filesystem::path const & application_path_a, logos::alarm & alarm_a, logos::node_config const & config_a/*, logos::work_pool & work_a*/) :
+logos::node::node (logos::node_init & init_a, boost::asio::io_service & service_a, boost::filesystem::path const & application_path_a, logos::alarm & alarm_a, logos::node_config const & config_a/*, logos::work_pool & work_a*/, std::shared_ptr<ExecutorLanes> lanes_a) :
 service (service_a),
+lanes (lanes_a ? lanes_a : std::make_shared<ExecutorLanes> (service_a)),
 config (config_a),
 alarm (alarm_a),
-store (init_a.block_store_init, application_path_a / "data.ldb", config_a.lmdb_max_dbs),
-block_cache (service_a,store),
+network_alarm (lanes->GetService (Lane::Network)),
+store (init_a.block_store_init, application_path_a / "data.ldb", config_a.lmdb_max_dbs, config_a.history_path (application_path_a)),
+block_cache (lanes->GetService (Lane::Persistence), store, nullptr, config_a.validation_threads),
 application_path (application_path_a),
 stats (config.stat_config),
 _recall_handler(),
@@ -853,18 +919,37 @@ _consensus_container{std::make_shared<ConsensusContainer>(
         service_a, store, block_cache, alarm_a, config, _recall_handler, *_identity_manager, p2p)},
 _tx_acceptor(nullptr),
 _tx_receiver(nullptr),
-bootstrap_initiator (alarm_a, store, block_cache, _consensus_container->GetPeerInfoProvider()),
-bootstrap_listener (alarm_a, store, config.consensus_manager_config.local_address)
+bootstrap_initiator (network_alarm, store, block_cache, _consensus_container->GetPeerInfoProvider()),
+bootstrap_listener (network_alarm, store, config.consensus_manager_config.local_address)
 {
-    BlocksCallback::Instance(service_a, config.callback_address, config.callback_port, config.callback_target, config.logging.callback_logging ());
+    CallbackOptions callback_options;
+    callback_options.connections = config.callback_connections;
+    callback_options.batch_size = config.callback_batch_size;
+    callback_options.queue_limit = config.callback_queue_limit;
+    callback_options.retries = config.callback_retries;
+    callback_options.compact = config.callback_compact;
+    BlocksCallback::Instance(lanes->GetService (Lane::Rpc), config.callback_address, config.callback_port, config.callback_target, config.logging.callback_logging (), callback_options);
 
     LOG_DEBUG (log) << "Node starting, version: " << LOGOS_VERSION_MAJOR << "." << LOGOS_VERSION_MINOR;
     if(config_a.enable_websocket)
     {
-        websocket_server = std::make_shared<logos::websocket::listener> (this->service, config.consensus_manager_config.local_address);
+        websocket_server = std::make_shared<logos::websocket::listener> (lanes->GetService (Lane::Rpc), config.consensus_manager_config.local_address);
         websocket_server->run ();
     }
 
+    if(config_a.snapshot_config.export_interval)
+    {
+        snapshot_exporter = std::make_shared<SnapshotExporter> (store, config.snapshot_config, application_path);
+    }
+
+    // Segments stay readable if archiving is later disabled.
+    store.open_segments (config_a.segment_config.Directory (application_path), config_a.segment_config.frame_size,
+                         config_a.segment_config.cached_frames);
+    if(config_a.segment_config.enable)
+    {
+        segment_archiver = std::make_shared<SegmentArchiver> (store, config.segment_config);
+    }
+
     p2p_conf = config.p2p_conf;
     p2p_conf.lmdb_env = store.environment.environment;
     p2p_conf.lmdb_dbi = store.p2p_db;
@@ -891,8 +976,7 @@ logos::node::~node ()
 
 bool logos::node::copy_with_compaction (boost::filesystem::path const & destination_file)
 {
-    return !mdb_env_copy2 (store.environment.environment,
-    destination_file.string ().c_str (), MDB_CP_COMPACT);
+    return !store.copy_with_compaction (destination_file);
 }
 
 const logos::node_config & logos::node::GetConfig()
@@ -1013,6 +1097,7 @@ void logos::node::stop ()
     {
         websocket_server->stop ();
     }
+    lanes->Stop ();
 }
 
 bool logos::Logos_p2p_interface::ReceiveMessageCallback(const void *message, unsigned size) {
@@ -1239,7 +1324,11 @@ void logos::add_node_options (boost::program_options::options_description & desc
         ("account_key", "Get the public key for <account>")
         ("vacuum", "Compact database. If data_path is missing, the database in data directory is compacted.")
         ("snapshot", "Compact database and create snapshot, functions similar to vacuum but does not replace the existing database")
+        ("state_snapshot_export", "Export a hash-committed state snapshot of the database to the <file> directory")
+        ("state_snapshot_import", "Import the state snapshot in the <file> directory into an empty database, <key> is the trusted manifest hash")
+        ("history_split", "Move block history out of the database into a new database at <file>, to be configured as lmdb_history_path")
         ("data_path", boost::program_options::value<std::string> (), "Use the supplied path as the data directory")
+        ("history_path", boost::program_options::value<std::string> (), "Use the supplied path as the block history database, if split")
         ("diagnostics", "Run internal diagnostics")
         ("key_create", "Generates a adhoc random keypair and prints it to stdout")
         ("key_expand", "Derive public key and account number from <key>")
@@ -1266,6 +1355,7 @@ bool logos::handle_node_options (boost::program_options::variables_map & vm)
 {
     auto result (false);
     boost::filesystem::path data_path = vm.count ("data_path") ? boost::filesystem::path (vm["data_path"].as<std::string> ()) : logos::working_path ();
+    boost::filesystem::path history_path = vm.count ("history_path") ? boost::filesystem::path (vm["history_path"].as<std::string> ()) : boost::filesystem::path ();
     if (vm.count ("account_get") > 0)
     {
         if (vm.count ("key") == 1)
@@ -1309,8 +1399,17 @@ bool logos::handle_node_options (boost::program_options::variables_map & vm)
             // the original file is replaced with the vacuumed file.
             bool success = false;
             {
-                inactive_node node (data_path);
-                success = node.node->copy_with_compaction (vacuum_path);
+                inactive_node node (data_path, history_path);
+                if (node.init.block_store_init)
+                {
+                    std::cerr << "Failed to open database in " << data_path
+                              << ", pass --history_path if its history was split" << std::endl;
+                    result = true;
+                }
+                else
+                {
+                    success = node.node->copy_with_compaction (vacuum_path);
+                }
             }
 
             if (success)
@@ -1346,8 +1445,17 @@ bool logos::handle_node_options (boost::program_options::variables_map & vm)
 
             bool success = false;
             {
-                inactive_node node (data_path);
-                success = node.node->copy_with_compaction (snapshot_path);
+                inactive_node node (data_path, history_path);
+                if (node.init.block_store_init)
+                {
+                    std::cerr << "Failed to open database in " << data_path
+                              << ", pass --history_path if its history was split" << std::endl;
+                    result = true;
+                }
+                else
+                {
+                    success = node.node->copy_with_compaction (snapshot_path);
+                }
             }
             if (success)
             {
@@ -1363,6 +1471,71 @@ bool logos::handle_node_options (boost::program_options::variables_map & vm)
             std::cerr << "Snapshot Failed" << std::endl;
         }
     }
+    else if (vm.count ("state_snapshot_export") || vm.count ("state_snapshot_import"))
+    {
+        bool import (vm.count ("state_snapshot_import") > 0);
+        BlockHash trusted_hash;
+        if (vm.count ("file") != 1 || (import && (vm.count ("key") != 1 || trusted_hash.decode_hex (vm["key"].as<std::string> ()))))
+        {
+            std::cerr << (import ? "state_snapshot_import requires one <file> and one <key> option\n"
+                                 : "state_snapshot_export requires one <file> option\n");
+            result = true;
+        }
+        else
+        {
+            bool error (false);
+            logos::block_store store (error, data_path / "data.ldb", 128, history_path);
+            SnapshotManifest manifest;
+            boost::filesystem::path directory (vm["file"].as<std::string> ());
+            if (error)
+            {
+                std::cerr << "Failed to open database in " << data_path << std::endl;
+                result = true;
+            }
+            else if (import ? StateSnapshot::Import (store, directory, trusted_hash, manifest)
+                            : StateSnapshot::Export (store, directory, StateSnapshotConfig::DEFAULT_CHUNK_SIZE, manifest))
+            {
+                std::cerr << "State snapshot " << (import ? "import" : "export") << " failed, see the log for details" << std::endl;
+                result = true;
+            }
+            else
+            {
+                std::cout << "State snapshot of epoch " << manifest.epoch_number << (import ? " imported from " : " exported to ")
+                          << directory << std::endl
+                          << "Manifest hash: " << Blake2bHash (manifest).to_string () << std::endl;
+            }
+        }
+    }
+    else if (vm.count ("history_split"))
+    {
+        if (vm.count ("file") != 1)
+        {
+            std::cerr << "history_split requires one <file> option\n";
+            result = true;
+        }
+        else
+        {
+            bool error (false);
+            logos::block_store store (error, data_path / "data.ldb");
+            boost::filesystem::path destination (vm["file"].as<std::string> ());
+            if (error)
+            {
+                std::cerr << "Failed to open database in " << data_path << std::endl;
+                result = true;
+            }
+            else if (store.split_history (destination))
+            {
+                std::cerr << "History split failed, see the log for details" << std::endl;
+                result = true;
+            }
+            else
+            {
+                std::cout << "Block history moved to " << destination << std::endl
+                          << "Set lmdb_history_path to it in the node config, and run --vacuum --history_path "
+                          << destination << " to shrink the database" << std::endl;
+            }
+        }
+    }
     else if (vm.count ("key_create"))
     {
         logos::keypair pair;
@@ -1395,7 +1568,7 @@ bool logos::handle_node_options (boost::program_options::variables_map & vm)
     return result;
 }
 
-logos::inactive_node::inactive_node (boost::filesystem::path const & path) :
+logos::inactive_node::inactive_node (boost::filesystem::path const & path, boost::filesystem::path const & history_path) :
 path (path),
 service (boost::make_shared<boost::asio::io_service> ()),
 alarm (*service)
@@ -1403,7 +1576,9 @@ alarm (*service)
     boost::filesystem::create_directories (path);
     logging.max_size = std::numeric_limits<std::uintmax_t>::max ();
     logging.init (path);
-    node = std::make_shared<logos::node> (init, *service, 24000, path, alarm, logging);
+    logos::node_config config (24000, logging);
+    config.lmdb_history_path = history_path.string ();
+    node = std::make_shared<logos::node> (init, *service, path, alarm, config);
 }
 
 logos::inactive_node::~inactive_node ()
@@ -9,8 +9,11 @@
 #include <logos/consensus/consensus_container.hpp>
 #include <logos/consensus/persistence/block_cache.hpp>
 #include <logos/tx_acceptor/tx_acceptor_config.hpp>
+#include <logos/snapshot/snapshot_exporter.hpp>
+#include <logos/archive/segment_archiver.hpp>
 #include <logos/p2p/p2p.h>
 #include <logos/node/websocket.hpp>
+#include <logos/node/executor_lanes.hpp>
 
 #include <condition_variable>
 #include <memory>
@@ -206,6 +209,8 @@ public:
     bool deserialize_json (bool &, boost::property_tree::ptree &);
     bool upgrade_json (unsigned, boost::property_tree::ptree &);
     logos::account random_representative ();
+    // Path of the block history database, empty if history is kept in data.ldb
+    boost::filesystem::path history_path (boost::filesystem::path const & application_path_a) const;
     uint16_t peering_port;
     logos::logging logging;
     std::vector<std::pair<std::string, uint16_t>> work_peers;
@@ -222,15 +227,25 @@ public:
     bool enable_websocket;
     unsigned bootstrap_connections;
     unsigned bootstrap_connections_max;
+    unsigned validation_threads;
     std::string callback_address;
     uint16_t callback_port;
     std::string callback_target;
+    uint16_t callback_connections;
+    uint16_t callback_batch_size;
+    uint32_t callback_queue_limit;
+    uint8_t callback_retries;
+    bool callback_compact;
     int lmdb_max_dbs;
+    std::string lmdb_history_path;
     logos::stat_config stat_config;
     logos::block_hash state_block_parse_canary;
     logos::block_hash state_block_generate_canary;
     ConsensusManagerConfig consensus_manager_config;
     TxAcceptorConfig tx_acceptor_config;
+    StateSnapshotConfig snapshot_config;
+    SegmentArchiveConfig segment_config;
+    ExecutorLanesConfig lanes_config;
     p2p_config p2p_conf;
     static std::chrono::seconds constexpr keepalive_period = std::chrono::seconds (60);
     static std::chrono::seconds constexpr keepalive_cutoff = keepalive_period * 5;
@@ -329,12 +344,12 @@ class node : public NodeInterface,
 {
 public:
     node (logos::node_init &, boost::asio::io_service &, uint16_t, boost::filesystem::path const &, logos::alarm &, logos::logging const &/*, logos::work_pool &*/);
-    node (logos::node_init &, boost::asio::io_service &, boost::filesystem::path const &, logos::alarm &, logos::node_config const &/*, logos::work_pool &*/);
+    node (logos::node_init &, boost::asio::io_service &, boost::filesystem::path const &, logos::alarm &, logos::node_config const &/*, logos::work_pool &*/, std::shared_ptr<ExecutorLanes> = nullptr);
     ~node () override;
     template <typename T>
     void background (T action_a)
     {
-        alarm.service.post (action_a);
+        lanes->Post (Lane::Rpc, action_a);
     }
     bool copy_with_compaction (boost::filesystem::path const &);
     void start ();
@@ -378,8 +393,10 @@ public:
     boost::filesystem::path const & GetApplicationPath() override {return application_path;}
 
     boost::asio::io_service & service;
+    std::shared_ptr<ExecutorLanes> lanes;
     logos::node_config config;
     logos::alarm & alarm;
+    logos::alarm network_alarm;
     Log log;
     logos::block_store store;
     logos::BlockCache block_cache;
@@ -395,6 +412,8 @@ public:
     Bootstrap::BootstrapInitiator bootstrap_initiator;
     Bootstrap::BootstrapListener bootstrap_listener;
     std::shared_ptr<logos::websocket::listener> websocket_server;
+    std::shared_ptr<SnapshotExporter> snapshot_exporter;
+    std::shared_ptr<SegmentArchiver> segment_archiver;
 
     p2p_config p2p_conf;
     static double constexpr price_max = 16.0;
@@ -416,7 +435,10 @@ bool handle_node_options (boost::program_options::variables_map &);
 class inactive_node
 {
 public:
-    inactive_node (boost::filesystem::path const & path = logos::working_path ());
+    /// Check init.block_store_init before using the node.
+    /// @param history_path the split block history database, if any
+    inactive_node (boost::filesystem::path const & path = logos::working_path (),
+                   boost::filesystem::path const & history_path = boost::filesystem::path ());
     ~inactive_node ();
     boost::filesystem::path path;
     boost::shared_ptr<boost::asio::io_service> service;
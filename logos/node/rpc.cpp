@@ -1,6 +1,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <logos/node/rpc.hpp>
+#include <logos/node/client_callback.hpp>
 #include <logos/microblock/microblock_tester.hpp>
 
 #include <logos/lib/interface.h>
@@ -56,7 +57,9 @@ address (boost::asio::ip::address_v6::loopback ()),
 port (logos::rpc::rpc_port),
 enable_control (false),
 frontier_request_limit (16384),
-chain_request_limit (16384)
+chain_request_limit (16384),
+read_entry_limit (4096),
+read_time_limit_ms (100)
 {
 }
 
@@ -65,7 +68,9 @@ address (boost::asio::ip::address_v6::loopback ()),
 port (logos::rpc::rpc_port),
 enable_control (enable_control_a),
 frontier_request_limit (16384),
-chain_request_limit (16384)
+chain_request_limit (16384),
+read_entry_limit (4096),
+read_time_limit_ms (100)
 {
 }
 
@@ -76,6 +81,8 @@ void logos::rpc_config::serialize_json (boost::property_tree::ptree & tree_a) co
     tree_a.put ("enable_control", enable_control);
     tree_a.put ("frontier_request_limit", frontier_request_limit);
     tree_a.put ("chain_request_limit", chain_request_limit);
+    tree_a.put ("read_entry_limit", read_entry_limit);
+    tree_a.put ("read_time_limit_ms", read_time_limit_ms);
 }
 
 bool logos::rpc_config::deserialize_json (boost::property_tree::ptree const & tree_a)
@@ -102,6 +109,9 @@ bool logos::rpc_config::deserialize_json (boost::property_tree::ptree const & tr
                 result = port > std::numeric_limits<uint16_t>::max ();
                 frontier_request_limit = std::stoull (frontier_request_limit_l);
                 chain_request_limit = std::stoull (chain_request_limit_l);
+                read_entry_limit = tree_a.get<uint64_t> ("read_entry_limit", read_entry_limit);
+                read_time_limit_ms = tree_a.get<uint64_t> ("read_time_limit_ms", read_time_limit_ms);
+                result |= read_entry_limit == 0;
             }
             catch (std::logic_error const &)
             {
@@ -122,6 +132,27 @@ bool logos::rpc_config::deserialize_json (boost::property_tree::ptree const & tr
     return result;
 }
 
+logos::rpc_read_scope::rpc_read_scope (logos::block_store & store_a, logos::rpc_config const & config_a) :
+snapshot (store_a.environment),
+deadline (std::chrono::steady_clock::now () + std::chrono::milliseconds (config_a.read_time_limit_ms)),
+remaining (config_a.read_entry_limit)
+{
+}
+
+bool logos::rpc_read_scope::exhausted ()
+{
+    if (remaining > 0)
+    {
+        --remaining;
+    }
+    return remaining == 0 || std::chrono::steady_clock::now () >= deadline;
+}
+
+logos::rpc_read_scope::operator MDB_txn * () const
+{
+    return snapshot;
+}
+
 logos::rpc::rpc (boost::asio::io_service & service_a, logos::node & node_a, logos::rpc_config const & config_a) :
 acceptor (service_a),
 config (config_a),
@@ -1547,7 +1578,8 @@ void logos::rpc_handler::account_history ()
     auto error (false);
     logos::block_hash request_hash, receive_hash;
     auto head_str (request.get_optional<std::string> ("head"));
-    logos::transaction transaction (node.store.environment, nullptr, false);
+    auto receive_head_str (request.get_optional<std::string> ("receive_head"));
+    logos::rpc_read_scope transaction (node.store, rpc.config);
 
     // get account
     logos::uint256_union account;
@@ -1572,6 +1604,14 @@ void logos::rpc_handler::account_history ()
             error_response (response, "Invalid block hash");
         }
     }
+    // get optional receive head, continuing a previous page
+    if (receive_head_str)
+    {
+        if (receive_hash.decode_hex (*receive_head_str))
+        {
+            error_response (response, "Invalid block hash");
+        }
+    }
 
     // get count + offset
     uint64_t count;
@@ -1652,11 +1692,17 @@ void logos::rpc_handler::account_history ()
             receive_hash = receive_data.previous;
             receive_not_found = node.store.receive_get (receive_hash, receive_data, transaction);
         }
+        if (transaction.exhausted ())
+        {
+            break;
+        }
     }
     response_l.add_child ("history", history);
-    if (!request_hash.is_zero ())  // TODO: fix pagination
+    // pass both back as head and receive_head for the next page
+    if (!request_hash.is_zero () || !receive_hash.is_zero ())
     {
         response_l.put ("previous", request_hash.to_string ());
+        response_l.put ("receive_previous", receive_hash.to_string ());
     }
     response (response_l);
 }
@@ -2699,12 +2745,20 @@ void logos::rpc_handler::candidates ()
 {
     boost::property_tree::ptree res;
 
-    logos::transaction txn(node.store.environment,nullptr,false);
+    // resume a paged query at its continuation
+    logos::account start (0);
+    auto continuation (request.get_optional<std::string> ("continuation"));
+    if (continuation && start.decode_hex (*continuation))
+    {
+        error_response (response, "Invalid continuation");
+        return;
+    }
+
+    logos::rpc_read_scope scope (node.store, rpc.config);
 
-    for(auto it = logos::store_iterator(txn,node.store.candidacy_db);
+    for(auto it = logos::store_iterator(scope,node.store.candidacy_db,logos::mdb_val(start));
            it != logos::store_iterator(nullptr); ++it)
     {
-        boost::property_tree::ptree candidate;
         bool error = false;
         CandidateInfo info(error, it->second);
         if(error)
@@ -2713,7 +2767,12 @@ void logos::rpc_handler::candidates ()
             return;
         }
         res.add_child(it->first.uint256().to_string(),info.SerializeJson());
-    } 
+        if(scope.exhausted() && ++it != logos::store_iterator(nullptr))
+        {
+            res.put("continuation", it->first.uint256().to_string());
+            break;
+        }
+    }
     response(res);
 }
 
@@ -2721,12 +2780,20 @@ void logos::rpc_handler::representatives ()
 {
     boost::property_tree::ptree res;
 
-    logos::transaction txn(node.store.environment,nullptr,false);
+    // resume a paged query at its continuation
+    logos::account start (0);
+    auto continuation (request.get_optional<std::string> ("continuation"));
+    if (continuation && start.decode_hex (*continuation))
+    {
+        error_response (response, "Invalid continuation");
+        return;
+    }
+
+    logos::rpc_read_scope scope (node.store, rpc.config);
 
-    for(auto it = logos::store_iterator(txn,node.store.representative_db);
+    for(auto it = logos::store_iterator(scope,node.store.representative_db,logos::mdb_val(start));
            it != logos::store_iterator(nullptr); ++it)
     {
-        boost::property_tree::ptree candidate;
         bool error = false;
         RepInfo info(error, it->second);
         if(error)
@@ -2735,7 +2802,12 @@ void logos::rpc_handler::representatives ()
             return;
         }
         res.add_child(it->first.uint256().to_string(),info.SerializeJson());
-    } 
+        if(scope.exhausted() && ++it != logos::store_iterator(nullptr))
+        {
+            res.put("continuation", it->first.uint256().to_string());
+            break;
+        }
+    }
     response(res);
 }
 
@@ -2934,6 +3006,25 @@ void logos::rpc_handler::stats ()
     {
         node.stats.log_samples (*sink);
     }
+    else if (type == "lanes")
+    {
+        boost::property_tree::ptree response_l;
+        node.lanes->SerializeJson (response_l);
+        response (response_l);
+        return;
+    }
+    else if (type == "callback")
+    {
+        auto callback (BlocksCallback::Instance ());
+        auto callback_stats (callback ? callback->GetStats () : BlocksCallback::Stats ());
+        boost::property_tree::ptree response_l;
+        response_l.put ("sent", std::to_string (callback_stats.sent));
+        response_l.put ("retried", std::to_string (callback_stats.retried));
+        response_l.put ("dropped", std::to_string (callback_stats.dropped));
+        response_l.put ("queued", std::to_string (callback_stats.queued));
+        response (response_l);
+        return;
+    }
     else
     {
         error = true;
@@ -48,8 +48,35 @@ public:
     bool enable_control;
     uint64_t frontier_request_limit;
     uint64_t chain_request_limit;
+    /** Most entries a query reads from one snapshot before returning a page */
+    uint64_t read_entry_limit;
+    /** Longest a query reads from one snapshot before returning a page */
+    uint64_t read_time_limit_ms;
     rpc_secure_config secure;
 };
+/**
+ * Bounds the database reads of one RPC query.
+ *
+ * The query reads through a single read_snapshot, so lookups made without
+ * a transaction see the same state. Once the query has read
+ * read_entry_limit entries or taken read_time_limit_ms, it stops and
+ * returns what it has, with a continuation that the client passes back
+ * to read the next page from a new snapshot. A crawl therefore never
+ * holds a reader long enough to pin pages while consensus writes.
+ */
+class rpc_read_scope
+{
+public:
+    rpc_read_scope (logos::block_store &, logos::rpc_config const &);
+    // Counts an entry read, returns true once the page is full
+    bool exhausted ();
+    operator MDB_txn * () const;
+    logos::read_snapshot snapshot;
+
+private:
+    std::chrono::steady_clock::time_point deadline;
+    uint64_t remaining;
+};
 enum class payment_status
 {
     not_a_status,
@@ -56,7 +56,8 @@ std::vector<boost::filesystem::path> logos::remove_temporary_directories ()
     return all_unique_paths;
 }
 
-logos::mdb_env::mdb_env (bool & error_a, boost::filesystem::path const & path_a, int max_dbs)
+logos::mdb_env::mdb_env (bool & error_a, boost::filesystem::path const & path_a, int max_dbs) :
+history (nullptr)
 {
     boost::system::error_code error;
     if (path_a.has_parent_path ())
@@ -90,17 +91,158 @@ logos::mdb_env::mdb_env (bool & error_a, boost::filesystem::path const & path_a,
 
 logos::mdb_env::~mdb_env ()
 {
+    for (auto txn : read_pool)
+    {
+        mdb_txn_abort (txn);
+    }
     if (environment != nullptr)
     {
         mdb_env_close (environment);
     }
 }
 
+MDB_txn * logos::mdb_env::read_txn_begin ()
+{
+    MDB_txn * txn (nullptr);
+    {
+        std::lock_guard<std::mutex> lock (read_pool_mutex);
+        if (!read_pool.empty ())
+        {
+            txn = read_pool.back ();
+            read_pool.pop_back ();
+        }
+    }
+    if (txn != nullptr)
+    {
+        auto status (mdb_txn_renew (txn));
+        assert (status == 0);
+    }
+    else
+    {
+        auto status (mdb_txn_begin (environment, nullptr, MDB_RDONLY, &txn));
+        assert (status == 0);
+    }
+    track (txn, nullptr, false);
+    return txn;
+}
+
+void logos::mdb_env::read_txn_end (MDB_txn * txn_a)
+{
+    untrack (txn_a, true);
+    mdb_txn_reset (txn_a);
+    {
+        std::lock_guard<std::mutex> lock (read_pool_mutex);
+        if (read_pool.size () < max_pooled_reads)
+        {
+            read_pool.push_back (txn_a);
+            return;
+        }
+    }
+    mdb_txn_abort (txn_a);
+}
+
 logos::mdb_env::operator MDB_env * () const
 {
     return environment;
 }
 
+void logos::mdb_env::attach_history (logos::mdb_env * history_a)
+{
+    assert (history_a != this);
+    history = history_a;
+}
+
+MDB_txn * logos::mdb_env::companion (MDB_txn * txn_a)
+{
+    assert (history != nullptr);
+    std::unique_lock<std::mutex> lock (companions_mutex);
+    auto existing (companions.find (txn_a));
+    assert (existing != companions.end ());
+    if (existing->second.companion != nullptr)
+    {
+        return existing->second.companion;
+    }
+    auto pair (existing->second);
+    lock.unlock ();
+
+    MDB_txn * result (nullptr);
+    if (pair.parent != nullptr)
+    {
+        // Nested transactions nest on the history side too, so that
+        // aborting the child discards its history writes.
+        auto status (mdb_txn_begin (*history, companion (pair.parent), pair.write ? 0 : MDB_RDONLY, &result));
+        assert (status == 0);
+    }
+    else if (pair.write)
+    {
+        auto status (mdb_txn_begin (*history, nullptr, 0, &result));
+        assert (status == 0);
+    }
+    else
+    {
+        result = history->read_txn_begin ();
+    }
+
+    lock.lock ();
+    companions[txn_a].companion = result;
+    return result;
+}
+
+void logos::mdb_env::track (MDB_txn * txn_a, MDB_txn * parent_a, bool write_a)
+{
+    if (history == nullptr)
+    {
+        return;
+    }
+    // A read transaction takes its history snapshot now, so that it's no
+    // more than the commits in between ahead of the state, e.g. a block's
+    // next pointing to a block the state doesn't have yet. Writers exclude
+    // each other, so theirs can wait until it's needed.
+    MDB_txn * companion (nullptr);
+    if (parent_a == nullptr && !write_a)
+    {
+        companion = history->read_txn_begin ();
+    }
+    std::lock_guard<std::mutex> lock (companions_mutex);
+    companions[txn_a] = { parent_a, write_a, companion };
+}
+
+void logos::mdb_env::untrack (MDB_txn * txn_a, bool commit_a)
+{
+    if (history == nullptr)
+    {
+        return;
+    }
+    paired pair;
+    {
+        std::lock_guard<std::mutex> lock (companions_mutex);
+        auto existing (companions.find (txn_a));
+        if (existing == companions.end ())
+        {
+            return;
+        }
+        pair = existing->second;
+        companions.erase (existing);
+    }
+    if (pair.companion == nullptr)
+    {
+        return;
+    }
+    if (pair.parent == nullptr && !pair.write)
+    {
+        history->read_txn_end (pair.companion);
+    }
+    else if (commit_a)
+    {
+        auto status (mdb_txn_commit (pair.companion));
+        assert (status == 0);
+    }
+    else
+    {
+        mdb_txn_abort (pair.companion);
+    }
+}
+
 logos::mdb_val::mdb_val () :
 value ({ 0, nullptr })
 {
@@ -175,16 +317,45 @@ logos::mdb_val::operator MDB_val const & () const
 }
 
 logos::transaction::transaction (logos::mdb_env & environment_a, MDB_txn * parent_a, bool write) :
-environment (environment_a)
+environment (environment_a),
+source (origin::begun)
 {
+    if (!write && parent_a == nullptr)
+    {
+        handle = read_snapshot::current (environment_a);
+        if (handle != nullptr)
+        {
+            source = origin::borrowed;
+        }
+        else
+        {
+            handle = environment_a.read_txn_begin ();
+            source = origin::pooled;
+        }
+        return;
+    }
     auto status (mdb_txn_begin (environment_a, parent_a, write ? 0 : MDB_RDONLY, &handle));
     assert (status == 0);
+    environment_a.track (handle, parent_a, write);
 }
 
 logos::transaction::~transaction ()
 {
-    auto status (mdb_txn_commit (handle));
-    assert (status == 0);
+    switch (source)
+    {
+        case origin::borrowed:
+            break;
+        case origin::pooled:
+            environment.read_txn_end (handle);
+            break;
+        case origin::begun:
+        {
+            environment.untrack (handle, true);
+            auto status (mdb_txn_commit (handle));
+            assert (status == 0);
+            break;
+        }
+    }
 }
 
 logos::transaction::operator MDB_txn * () const
@@ -192,6 +363,50 @@ logos::transaction::operator MDB_txn * () const
     return handle;
 }
 
+size_t constexpr logos::mdb_env::max_pooled_reads;
+
+thread_local logos::read_snapshot * logos::read_snapshot::top (nullptr);
+
+logos::read_snapshot::read_snapshot (logos::mdb_env & environment_a) :
+handle (current (environment_a)),
+environment (environment_a),
+owner (handle == nullptr),
+previous (top)
+{
+    if (owner)
+    {
+        handle = environment_a.read_txn_begin ();
+    }
+    top = this;
+}
+
+logos::read_snapshot::~read_snapshot ()
+{
+    assert (top == this);
+    top = previous;
+    if (owner)
+    {
+        environment.read_txn_end (handle);
+    }
+}
+
+logos::read_snapshot::operator MDB_txn * () const
+{
+    return handle;
+}
+
+MDB_txn * logos::read_snapshot::current (logos::mdb_env const & environment_a)
+{
+    for (auto snapshot (top); snapshot != nullptr; snapshot = snapshot->previous)
+    {
+        if (&snapshot->environment == &environment_a)
+        {
+            return snapshot->handle;
+        }
+    }
+    return nullptr;
+}
+
 void logos::open_or_create (std::fstream & stream_a, std::string const & path_a)
 {
     stream_a.open (path_a, std::ios_base::in);
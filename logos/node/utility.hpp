@@ -3,7 +3,10 @@
 #include <array>
 #include <atomic>
 #include <condition_variable>
+#include <mutex>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/filesystem.hpp>
 #include <boost/iostreams/device/back_inserter.hpp>
@@ -105,6 +108,22 @@ bool fetch_object (T & object, boost::filesystem::path const & path_a, std::fstr
 
 /**
  * RAII wrapper for MDB_env
+ *
+ * Read-only transactions are pooled: ending one resets it with
+ * mdb_txn_reset and keeps it, together with its reader slot, for the next
+ * read transaction, which renews it with mdb_txn_renew instead of paying
+ * for mdb_txn_begin. The environment is opened with MDB_NOTLS, so pooled
+ * transactions may be renewed by any thread.
+ *
+ * Tables may be split out into a second, history environment. Every
+ * transaction on this environment is then paired with a companion
+ * transaction on the history environment, ended, committing first, just
+ * before its owner. Read transactions begin theirs right after themselves,
+ * so the history they see holds every block their state refers to, and only
+ * what commits in between is newer; write transactions exclude each other
+ * and begin theirs the first time it's asked for. A crash between the two commits leaves history
+ * the state doesn't refer to yet, which is written again, unchanged, when
+ * the state is.
  */
 class mdb_env
 {
@@ -112,7 +131,37 @@ public:
     mdb_env (bool &, boost::filesystem::path const &, int max_dbs = 128);
     ~mdb_env ();
     operator MDB_env * () const;
+    // Begin a read-only transaction, renewing a pooled one if available.
+    MDB_txn * read_txn_begin ();
+    // End a read-only transaction begun with read_txn_begin.
+    void read_txn_end (MDB_txn *);
+    // Pair transactions begun from now on with ones on history_a, which
+    // must outlive this environment's transactions.
+    void attach_history (logos::mdb_env * history_a);
+    // Returns the transaction on the history environment paired with the
+    // given one, beginning it if needed.
+    MDB_txn * companion (MDB_txn *);
+    // Register a transaction begun with mdb_txn_begin, parent may be nullptr.
+    void track (MDB_txn *, MDB_txn * parent, bool write);
+    // End the companion of a tracked transaction, if it was begun.
+    // Must be called before the transaction itself is committed or aborted.
+    void untrack (MDB_txn *, bool commit);
     MDB_env * environment;
+    logos::mdb_env * history;
+    // Bounds the reader slots held by idle transactions.
+    static size_t constexpr max_pooled_reads = 16;
+
+private:
+    struct paired
+    {
+        MDB_txn * parent;
+        bool write;
+        MDB_txn * companion;
+    };
+    std::mutex read_pool_mutex;
+    std::vector<MDB_txn *> read_pool;
+    std::mutex companions_mutex;
+    std::unordered_map<MDB_txn *, paired> companions;
 };
 
 /**
@@ -141,6 +190,10 @@ public:
 /**
  * RAII wrapper of MDB_txn where the constructor starts the transaction
  * and the destructor commits it.
+ *
+ * Top level read-only transactions come from the environment's pool, or
+ * share the handle of the calling thread's read_snapshot on the same
+ * environment, if any.
  */
 class transaction
 {
@@ -150,5 +203,46 @@ public:
     operator MDB_txn * () const;
     MDB_txn * handle;
     logos::mdb_env & environment;
+
+private:
+    enum class origin
+    {
+        begun,
+        pooled,
+        borrowed
+    };
+    origin source;
+};
+
+/**
+ * RAII read-only snapshot of an environment.
+ *
+ * While a snapshot is in scope, every top level read-only transaction the
+ * same thread opens on its environment, including the ones opened
+ * internally by block_store getters called without a transaction, reuses
+ * the snapshot's handle. A batch of lookups thus observes one consistent
+ * state and pays for a single transaction. Writes committed while the
+ * snapshot is alive, including the owning thread's, are not visible
+ * through it. Snapshots may be nested, inner ones on the same environment
+ * share the outermost handle.
+ */
+class read_snapshot
+{
+public:
+    read_snapshot (logos::mdb_env &);
+    ~read_snapshot ();
+    read_snapshot (read_snapshot const &) = delete;
+    read_snapshot & operator= (read_snapshot const &) = delete;
+    operator MDB_txn * () const;
+    // Returns the handle of the innermost snapshot of the environment
+    // active on the calling thread, or nullptr.
+    static MDB_txn * current (logos::mdb_env const &);
+    MDB_txn * handle;
+    logos::mdb_env & environment;
+
+private:
+    bool owner;
+    read_snapshot * previous;
+    static thread_local read_snapshot * top;
 };
 }
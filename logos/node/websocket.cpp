@@ -1,5 +1,6 @@
 #include <logos/node/node.hpp>
 #include <logos/node/websocket.hpp>
+#include <logos/consensus/persistence/block_container.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
@@ -32,8 +33,7 @@ logos::websocket::confirmation_options::confirmation_options (boost::property_tr
 			logos::account result_l (0);
 			if (!result_l.decode_account (account_l.second.data ()))
 			{
-				// Do not insert the given raw data to keep old prefix support
-				accounts.insert (result_l.to_account ());
+				accounts.insert (result_l);
 			}
 			else
 			{
@@ -47,7 +47,6 @@ logos::websocket::confirmation_options::confirmation_options (boost::property_tr
 
 bool logos::websocket::confirmation_options::interested(const ApprovedRB & block)
 {
-    //TODO account will supported later
     return include_rb;
 }
 bool logos::websocket::confirmation_options::interested(const ApprovedMB & block)
@@ -75,6 +74,7 @@ logos::websocket::session::~session ()
 		std::unique_lock<std::mutex> lk (subscriptions_mutex);
 		for (auto & subscription : subscriptions)
 		{
+			index_accounts (subscription.second.get (), false);
 			ws_listener.decrease_subscriber_count (subscription.first);
 		}
 	}
@@ -277,6 +277,7 @@ void logos::websocket::session::handle_message (boost::property_tree::ptree cons
 		auto existing (subscriptions.find (topic_l));
 		if (existing != subscriptions.end ())
 		{
+			index_accounts (existing->second.get (), false);
 			existing->second = std::move (options_l);
 			LOG_INFO(log) << "Websocket: updated subscription to topic: " << from_topic (topic_l);
 		}
@@ -286,13 +287,17 @@ void logos::websocket::session::handle_message (boost::property_tree::ptree cons
 			LOG_INFO(log) << "Websocket: new subscription to topic: "<< from_topic (topic_l);
 			ws_listener.increase_subscriber_count (topic_l);
 		}
+		index_accounts (subscriptions[topic_l].get (), true);
 		action_succeeded = true;
 	}
 	else if (action == "unsubscribe" && topic_l != logos::websocket::topic::invalid)
 	{
 		std::lock_guard<std::mutex> lk (subscriptions_mutex);
-		if (subscriptions.erase (topic_l))
+		auto existing (subscriptions.find (topic_l));
+		if (existing != subscriptions.end ())
 		{
+			index_accounts (existing->second.get (), false);
+			subscriptions.erase (existing);
 			LOG_INFO(log) << "Websocket: removed subscription to topic: " << from_topic (topic_l);
 			ws_listener.decrease_subscriber_count (topic_l);
 		}
@@ -304,6 +309,25 @@ void logos::websocket::session::handle_message (boost::property_tree::ptree cons
 	}
 }
 
+void logos::websocket::session::index_accounts (logos::websocket::options const * options_a, bool add_a)
+{
+	// The index only serves request blocks, so sessions excluding them stay out of it.
+	auto conf_options (dynamic_cast<logos::websocket::confirmation_options const *> (options_a));
+	if (conf_options == nullptr || conf_options->accounts.empty () || !conf_options->include_rb)
+	{
+		return;
+	}
+
+	if (add_a)
+	{
+		ws_listener.add_account_filter (shared_from_this (), conf_options->accounts);
+	}
+	else
+	{
+		ws_listener.remove_account_filter (this, conf_options->accounts);
+	}
+}
+
 void logos::websocket::listener::stop ()
 {
     LOG_TRACE(log) << "Websocket::listener::stop";
@@ -393,29 +417,127 @@ void logos::websocket::listener::broadcast_confirmation (const PostCommittedBloc
     LOG_TRACE(log) << "websocket::listener::broadcast_confirmation: " << block.ToJson();
 
 	logos::websocket::block_confirm_message_builder builder;
+	// Built once, for the first session that takes the whole block
+	std::unique_ptr<logos::websocket::message> message_l;
 
-	std::lock_guard<std::mutex> lk (sessions_mutex);
-	for (auto & weak_session : sessions)
 	{
-		auto session_ptr (weak_session.lock ());
-		if (session_ptr)
+		std::lock_guard<std::mutex> lk (sessions_mutex);
+		for (auto & weak_session : sessions)
 		{
-			auto subscription (session_ptr->subscriptions.find (logos::websocket::topic::confirmation));
-			if (subscription != session_ptr->subscriptions.end ())
+			auto session_ptr (weak_session.lock ());
+			if (session_ptr)
 			{
-				logos::websocket::confirmation_options default_options;
-				auto conf_options (dynamic_cast<logos::websocket::confirmation_options *> (subscription->second.get ()));
-				if (conf_options == nullptr)
+				auto subscription (session_ptr->subscriptions.find (logos::websocket::topic::confirmation));
+				if (subscription != session_ptr->subscriptions.end ())
 				{
-					conf_options = &default_options;
+					logos::websocket::confirmation_options default_options;
+					auto conf_options (dynamic_cast<logos::websocket::confirmation_options *> (subscription->second.get ()));
+					if (conf_options == nullptr)
+					{
+						conf_options = &default_options;
+					}
+					// Sessions filtering on accounts get request blocks through the account index
+					if (CT == ConsensusType::Request && !conf_options->accounts.empty ())
+					{
+						continue;
+					}
+					if(conf_options->interested(block))
+					{
+						if (!message_l)
+						{
+							message_l = std::make_unique<logos::websocket::message> (builder.build (block));
+						}
+						session_ptr->write (*message_l);
+					}
 				}
-                if(conf_options->interested(block))
-                {
-                    session_ptr->write (builder.build(block));
-                }
 			}
 		}
 	}
+
+	broadcast_account_filtered (block);
+}
+
+void logos::websocket::listener::broadcast_account_filtered (const ApprovedRB & block)
+{
+	using Match = std::pair<std::shared_ptr<session>, std::vector<size_t>>;
+
+	// Indices of the matching requests, by session
+	std::unordered_map<session *, Match> matches;
+	{
+		std::lock_guard<std::mutex> lk (accounts_mutex);
+		if (account_sessions.empty ())
+		{
+			return;
+		}
+
+		PendingBlockContainer::AccountSet accounts;
+		for (size_t i = 0; i < block.requests.size (); ++i)
+		{
+			accounts.clear ();
+			PendingBlockContainer::GetTouchedAccounts (*block.requests[i], accounts);
+			for (auto & account : accounts)
+			{
+				auto entry (account_sessions.find (account));
+				if (entry == account_sessions.end ())
+				{
+					continue;
+				}
+				for (auto & indexed : entry->second)
+				{
+					auto & match (matches[indexed.first]);
+					if (!match.first)
+					{
+						match.first = indexed.second.lock ();
+					}
+					if (match.second.empty () || match.second.back () != i)
+					{
+						match.second.push_back (i);
+					}
+				}
+			}
+		}
+	}
+
+	if (matches.empty ())
+	{
+		return;
+	}
+
+	// Serialize the block without its requests once, and each matching request at most once.
+	ApprovedRB header (block);
+	header.requests.clear ();
+	header.hashes.clear ();
+	boost::property_tree::ptree header_tree;
+	header.SerializeJson (header_tree);
+	header_tree.put ("hash", block.Hash ().to_string ());
+	header_tree.put ("request_count", std::to_string (block.requests.size ()));
+
+	std::unordered_map<size_t, boost::property_tree::ptree> request_trees;
+	for (auto & match : matches)
+	{
+		auto & session_ptr (match.second.first);
+		if (!session_ptr)
+		{
+			continue;
+		}
+
+		boost::property_tree::ptree requests_tree;
+		for (auto i : match.second.second)
+		{
+			auto request_tree (request_trees.find (i));
+			if (request_tree == request_trees.end ())
+			{
+				request_tree = request_trees.emplace (i, block.requests[i]->SerializeJson ()).first;
+			}
+			requests_tree.push_back (std::make_pair ("", request_tree->second));
+		}
+
+		logos::websocket::message message_l (logos::websocket::topic::confirmation);
+		message_l.contents.add ("block_type", ConsensusToName (ConsensusType::Request));
+		auto & block_tree (message_l.contents.add_child ("block", header_tree));
+		block_tree.put_child ("requests", requests_tree);
+		session_ptr->write (message_l);
+	}
 }
 
 void logos::websocket::listener::broadcast (logos::websocket::message message_a)
@@ -449,6 +571,32 @@ void logos::websocket::listener::decrease_subscriber_count (logos::websocket::to
 	count -= 1;
 }
 
+void logos::websocket::listener::add_account_filter (std::shared_ptr<session> const & session_a, std::unordered_set<AccountAddress> const & accounts_a)
+{
+	std::lock_guard<std::mutex> lk (accounts_mutex);
+	for (auto & account : accounts_a)
+	{
+		account_sessions[account][session_a.get ()] = session_a;
+	}
+}
+
+void logos::websocket::listener::remove_account_filter (session * session_a, std::unordered_set<AccountAddress> const & accounts_a)
+{
+	std::lock_guard<std::mutex> lk (accounts_mutex);
+	for (auto & account : accounts_a)
+	{
+		auto entry (account_sessions.find (account));
+		if (entry != account_sessions.end ())
+		{
+			entry->second.erase (session_a);
+			if (entry->second.empty ())
+			{
+				account_sessions.erase (entry);
+			}
+		}
+	}
+}
+
 std::shared_ptr<std::string> logos::websocket::message::to_string () const
 {
 	std::ostringstream ostream;
@@ -467,6 +615,14 @@ namespace logos_global
         {
             n->websocket_server->broadcast_confirmation(block);
         }
+        if(CT == ConsensusType::Epoch && n != nullptr && n->snapshot_exporter)
+        {
+            n->snapshot_exporter->OnEpochBlock(block.epoch_number, block.Hash());
+        }
+        if(CT == ConsensusType::Epoch && n != nullptr && n->segment_archiver)
+        {
+            n->segment_archiver->OnEpochBlock(block.epoch_number);
+        }
      }
 
     template void OnNewBlock<ConsensusType::Request>(const ApprovedRB & block);
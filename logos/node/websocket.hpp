@@ -99,7 +99,8 @@ namespace websocket
 	 * Non-filtering options:
 	 * - "include_block" (array of Consensus block type, default all types) - filter RequestBlock, MicroBlock, or EpochBlock
 	 * Filtering options:
-	 * - "accounts" (array of std::strings) - will only not filter blocks that have these accounts as source/destination
+	 * - "accounts" (array of std::strings) - request blocks only carry the requests that have these accounts
+	 *   as origin, source or destination, and are not sent at all if none do
 	 */
 	struct confirmation_options final : public options
 	{
@@ -112,8 +113,7 @@ namespace websocket
 		bool include_rb{ true };
         bool include_mb{ true };
         bool include_eb{ true };
-        //TODO account will supported later
-		std::unordered_set<std::string> accounts;
+		std::unordered_set<AccountAddress> accounts;
 	};
 
 	/** A websocket session managing its own lifetime */
@@ -169,6 +169,8 @@ namespace websocket
 		void send_ack (std::string action_a, std::string id_a);
 		/** Send all queued messages. This must be called from the write strand. */
 		void write_queued_messages ();
+		/** Add or remove the accounts filtered by \p options_a in the listener's index */
+		void index_accounts (logos::websocket::options const * options_a, bool add_a);
 
 		Log log;
 	};
@@ -191,6 +193,17 @@ namespace websocket
 		template <ConsensusType CT>
 		void broadcast_confirmation (const PostCommittedBlock<CT> & block);
 
+		/**
+		 * Send each session filtering on accounts the requests of \p block that involve
+		 * its accounts, looking sessions up by account in the inverted index.
+		 */
+		void broadcast_account_filtered (const ApprovedRB & block);
+		/** Micro and epoch blocks aren't filtered by account. */
+		template <typename Block>
+		void broadcast_account_filtered (const Block & block)
+		{
+		}
+
 		/** Broadcast \p message to all session subscribing to the message topic. */
 		void broadcast (logos::websocket::message message_a);
 
@@ -216,11 +229,18 @@ namespace websocket
 		void increase_subscriber_count (logos::websocket::topic const & topic_a);
 		/** Removes from subscription count of a specific topic*/
 		void decrease_subscriber_count (logos::websocket::topic const & topic_a);
+		/** Index \p session_a under each of \p accounts_a */
+		void add_account_filter (std::shared_ptr<session> const & session_a, std::unordered_set<AccountAddress> const & accounts_a);
+		/** Remove \p session_a from the index entries of \p accounts_a */
+		void remove_account_filter (session * session_a, std::unordered_set<AccountAddress> const & accounts_a);
 
 		boost::asio::ip::tcp::acceptor acceptor;
 		socket_type socket;
 		std::mutex sessions_mutex;
 		std::vector<std::weak_ptr<session>> sessions;
+		/** Inverted index of account filters: account -> sessions filtering on it */
+		std::mutex accounts_mutex;
+		std::unordered_map<AccountAddress, std::unordered_map<session *, std::weak_ptr<session>>> account_sessions;
 		std::array<std::atomic<std::size_t>, number_topics> topic_subscriber_count{};
 		std::atomic<bool> stopped{ false };
 		Log log;
@@ -4,6 +4,8 @@
 #include <logos/consensus/persistence/reservations.hpp>
 #include <logos/request/utility.hpp>
 #include <logos/request/fields.hpp>
+#include <logos/lib/span_stream.hpp>
+#include <logos/lib/trace.hpp>
 #include <logos/lib/utility.hpp>
 #include <logos/lib/hash.hpp>
 
@@ -40,6 +42,19 @@ uint64_t Request::Locator::Serialize(logos::stream & stream)
     return bytes_written;
 }
 
+thread_local bool Request::defer_digests = false;
+
+Request::DeferDigests::DeferDigests()
+    : _previous(defer_digests)
+{
+    defer_digests = true;
+}
+
+Request::DeferDigests::~DeferDigests()
+{
+    defer_digests = _previous;
+}
+
 Request::Request(RequestType type)
     : type(type)
 {}
@@ -73,8 +88,8 @@ Request::Request(RequestType type,
 Request::Request(bool & error,
                  const logos::mdb_val & mdbval)
 {
-    logos::bufferstream stream(reinterpret_cast<uint8_t const *>(mdbval.data()),
-                               mdbval.size());
+    logos::span_reader stream(reinterpret_cast<uint8_t const *>(mdbval.data()),
+                              mdbval.size());
     DeserializeDB(error, stream);
 }
 
@@ -187,7 +202,8 @@ void Request::Sign(AccountPrivKey const & priv)
 
 void Request::Sign(AccountPrivKey const & priv, AccountPubKey const & pub)
 {
-    digest = Hash();
+    // Signing needs the digest even while digests are deferred.
+    digest = Blake2bHash(*this);
 
     ed25519_sign(const_cast<BlockHash&>(digest).data(),
                  HASH_SIZE,
@@ -224,18 +240,33 @@ uint64_t Request::ToStream(logos::stream & stream, bool with_work) const
     return bytes_written;
 }
 
+uint32_t Request::StreamSize() const
+{
+    logos::size_counter counter;
+    ToStream(counter);
+    return counter.size();
+}
+
 logos::mdb_val Request::ToDatabase(std::vector<uint8_t> & buf, bool with_work) const
 {
     assert(buf.empty());
 
+    auto serialize = [this](logos::stream & stream)
     {
-        logos::vectorstream stream(buf);
-
         DoSerialize(stream);
         locator.Serialize(stream);
         Serialize(stream);
 
         logos::write(stream, next);
+    };
+
+    auto size = StreamSize() + Locator::WireSize + sizeof(next.bytes);
+    if(logos::serialize_exact(buf, size, serialize))
+    {
+        Log log;
+        LOG_FATAL(log) << "Request::ToDatabase - size doesn't match StreamSize for request "
+                       << GetHash().to_string();
+        trace_and_halt();
     }
 
     return {buf.size(), buf.data()};
@@ -365,6 +396,10 @@ BlockHash Request::GetHash() const
 
 BlockHash Request::Hash() const
 {
+    if(defer_digests)
+    {
+        return digest;
+    }
     return (digest = Blake2bHash(*this));
 }
 
@@ -496,8 +531,8 @@ Send::Send(bool & error,
 
 Send::Send(bool & error, const logos::mdb_val & mdbval)
 {
-    logos::bufferstream stream(reinterpret_cast<uint8_t const *>(mdbval.data()),
-                               mdbval.size());
+    logos::span_reader stream(reinterpret_cast<uint8_t const *>(mdbval.data()),
+                              mdbval.size());
     DeserializeDB(error, stream);
     if(error)
     {
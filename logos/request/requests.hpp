@@ -4,6 +4,7 @@
 #include <logos/node/utility.hpp>
 #include <logos/lib/utility.hpp>
 #include <logos/lib/numbers.hpp>
+#include <logos/lib/hash.hpp>
 #include <logos/common.hpp>
 
 #include <boost/property_tree/ptree.hpp>
@@ -70,10 +71,38 @@ struct Request
 
         uint64_t Serialize(logos::stream & stream);
 
+        static constexpr uint16_t WireSize = HASH_SIZE + sizeof(uint16_t);
+
         BlockHash hash  = 0;
         uint16_t  index = 0;
     };
 
+    /// The serialized bytes a request was received as. A standalone
+    /// TxAcceptor forwards these verbatim rather than serializing again.
+    struct WireBytes
+    {
+        std::shared_ptr<const std::vector<uint8_t>> buffer;
+        uint32_t                                    offset = 0;
+        uint32_t                                    size   = 0;
+    };
+
+    /// While an instance is in scope, Hash() leaves the digests of the
+    /// requests built on this thread, e.g. by deserializing constructors,
+    /// for a later ComputeDigests call that hashes them all together.
+    class DeferDigests
+    {
+    public:
+        DeferDigests();
+        ~DeferDigests();
+    private:
+        bool _previous;
+    };
+
+    /// Compute the digests of a batch of requests, several at a time.
+    ///     @param requests container of request pointers
+    template<typename Requests>
+    static void ComputeDigests(const Requests & requests);
+
     Request() = default;
 
     Request(RequestType type);
@@ -129,6 +158,8 @@ struct Request
 
     std::string ToJson() const;
     uint64_t ToStream(logos::stream & stream, bool with_work = false) const;
+    /// The number of bytes ToStream writes, counted without storing them.
+    uint32_t StreamSize() const;
     logos::mdb_val ToDatabase(std::vector<uint8_t> & buf, bool with_work = false) const;
     virtual void DeserializeDB(bool & error, logos::stream & stream);
 
@@ -161,8 +192,24 @@ struct Request
     BlockHash         next;
     mutable Locator   locator;
     mutable BlockHash digest;
+    mutable WireBytes wire;
+
+    static thread_local bool defer_digests;
 };
 
+template<typename Requests>
+void Request::ComputeDigests(const Requests & requests)
+{
+    std::vector<BlockHash> digests;
+    Blake2bHashBatch(requests.begin(), requests.end(), digests);
+
+    auto digest = digests.begin();
+    for(auto & request : requests)
+    {
+        request->digest = *digest++;
+    }
+}
+
 struct Send : Request
 {
     using Request::Hash;
@@ -2,6 +2,7 @@
 
 #include <logos/request/fields.hpp>
 #include <logos/rewards/claim.hpp>
+#include <logos/lib/span_stream.hpp>
 #include <logos/lib/utility.hpp>
 #include <logos/lib/log.hpp>
 
@@ -296,8 +297,8 @@ std::shared_ptr<Request> BuildRequest(RequestType type, bool & error, Data && da
 
 std::shared_ptr<Request> DeserializeRequest(bool & error, const logos::mdb_val & mdbval)
 {
-    logos::bufferstream stream(reinterpret_cast<uint8_t const *>(mdbval.data()),
-                               mdbval.size());
+    logos::span_reader stream(reinterpret_cast<uint8_t const *>(mdbval.data()),
+                              mdbval.size());
 
     RequestType type = RequestType::Unknown;
 
@@ -324,6 +325,21 @@ std::shared_ptr<Request> DeserializeRequest(bool & error, logos::stream & stream
     return BuildRequest(type, error, stream);
 }
 
+std::shared_ptr<Request> DeserializeRequest(bool & error,
+                                            logos::stream & stream,
+                                            const std::shared_ptr<const std::vector<uint8_t>> & buffer)
+{
+    uint32_t offset = stream.pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+    auto request = DeserializeRequest(error, stream);
+    if(!error)
+    {
+        uint32_t end = stream.pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+        request->wire = {buffer, offset, end - offset};
+    }
+
+    return request;
+}
+
 std::shared_ptr<Request> DeserializeRequest(bool & error, boost::property_tree::ptree & tree)
 {
     using namespace request::fields;
@@ -10,6 +10,11 @@ std::string GetRequestTypeField(RequestType type);
 std::shared_ptr<Request> DeserializeRequest(bool & error, const logos::mdb_val & mdbval);
 std::shared_ptr<Request> DeserializeRequest(bool & error, logos::stream & stream);
 std::shared_ptr<Request> DeserializeRequest(bool & error, boost::property_tree::ptree & tree);
+/// Deserialize a request from a stream over buffer, keeping the bytes it was
+/// read from in Request::wire.
+std::shared_ptr<Request> DeserializeRequest(bool & error,
+                                            logos::stream & stream,
+                                            const std::shared_ptr<const std::vector<uint8_t>> & buffer);
 
 template<typename T>
 uint16_t VectorWireSize(const std::vector<T> & v)
@@ -0,0 +1,152 @@
+/// @file
+/// This file contains the implementation of SnapshotExporter.
+
+#include <logos/snapshot/snapshot_exporter.hpp>
+#include <logos/lib/hash.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+
+constexpr std::chrono::milliseconds SnapshotExporter::COMMIT_POLL;
+constexpr std::chrono::seconds SnapshotExporter::COMMIT_TIMEOUT;
+
+namespace
+{
+
+const std::string SNAPSHOT_PREFIX = "epoch_";
+
+}
+
+SnapshotExporter::SnapshotExporter(Store & store,
+                                   const StateSnapshotConfig & config,
+                                   const boost::filesystem::path & data_path)
+    : _store(store)
+    , _config(config)
+    , _directory(config.export_path.empty() ? data_path / "snapshots"
+                                            : boost::filesystem::path(config.export_path))
+    , _thread([this](){ Run(); })
+{}
+
+SnapshotExporter::~SnapshotExporter()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+    }
+    _condition.notify_one();
+    _thread.join();
+}
+
+void SnapshotExporter::OnEpochBlock(uint32_t epoch_number, const BlockHash & hash)
+{
+    if(!_config.export_interval || epoch_number % _config.export_interval)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.reset(new Pending{epoch_number, hash});
+    }
+    _condition.notify_one();
+}
+
+void SnapshotExporter::Run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while(true)
+    {
+        _condition.wait(lock, [this](){ return _stopped || _pending; });
+        if(_stopped)
+        {
+            return;
+        }
+
+        auto pending = std::move(_pending);
+        lock.unlock();
+
+        if(WaitForCommit(pending->hash))
+        {
+            LOG_WARN(_log) << "SnapshotExporter::Run - epoch block " << pending->hash.to_string()
+                           << " isn't the epoch tip, skipping snapshot of epoch "
+                           << pending->epoch_number;
+        }
+        else
+        {
+            auto directory = _directory / (SNAPSHOT_PREFIX + std::to_string(pending->epoch_number));
+            SnapshotManifest manifest;
+
+            if(StateSnapshot::Export(_store, directory, _config.chunk_size, manifest))
+            {
+                LOG_ERROR(_log) << "SnapshotExporter::Run - failed to export snapshot of epoch "
+                                << pending->epoch_number;
+            }
+            else
+            {
+                Prune();
+            }
+        }
+
+        lock.lock();
+    }
+}
+
+bool SnapshotExporter::WaitForCommit(const BlockHash & hash)
+{
+    // The epoch block is announced before its write transaction commits.
+    auto deadline = std::chrono::steady_clock::now() + COMMIT_TIMEOUT;
+
+    while(std::chrono::steady_clock::now() < deadline)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(_stopped)
+            {
+                return true;
+            }
+        }
+
+        Tip tip;
+        if(!_store.epoch_tip_get(tip) && tip.digest == hash)
+        {
+            return false;
+        }
+
+        std::this_thread::sleep_for(COMMIT_POLL);
+    }
+
+    return true;
+}
+
+void SnapshotExporter::Prune()
+{
+    std::vector<std::pair<uint32_t, boost::filesystem::path>> snapshots;
+
+    try
+    {
+        for(auto & entry : boost::filesystem::directory_iterator(_directory))
+        {
+            auto name = entry.path().filename().string();
+            if(!boost::filesystem::is_directory(entry.path()) || name.compare(0, SNAPSHOT_PREFIX.size(), SNAPSHOT_PREFIX)
+               || name.find('.') != std::string::npos)
+            {
+                continue;
+            }
+            snapshots.emplace_back(std::stoul(name.substr(SNAPSHOT_PREFIX.size())), entry.path());
+        }
+
+        std::sort(snapshots.begin(), snapshots.end());
+
+        while(snapshots.size() > std::max<uint32_t>(_config.retain, 1))
+        {
+            boost::filesystem::remove_all(snapshots.front().second);
+            snapshots.erase(snapshots.begin());
+        }
+    }
+    catch(const std::exception & e)
+    {
+        LOG_WARN(_log) << "SnapshotExporter::Prune - " << e.what();
+    }
+}
@@ -0,0 +1,62 @@
+/// @file
+/// This file contains the declaration of SnapshotExporter, which exports
+/// state snapshots at configured epoch blocks.
+#pragma once
+
+#include <logos/snapshot/state_snapshot.hpp>
+
+#include <condition_variable>
+#include <chrono>
+#include <thread>
+#include <mutex>
+
+class SnapshotExporter
+{
+    using Store = logos::block_store;
+
+public:
+
+    SnapshotExporter(Store & store,
+                     const StateSnapshotConfig & config,
+                     const boost::filesystem::path & data_path);
+
+    ~SnapshotExporter();
+
+    /// Called when an epoch block is persisted.
+    ///
+    /// The export runs on the exporter's own thread once the block is
+    /// committed. If another epoch block arrives while an export is
+    /// pending, only the latest is exported.
+    ///     @param epoch_number epoch number of the block
+    ///     @param hash hash of the block
+    void OnEpochBlock(uint32_t epoch_number, const BlockHash & hash);
+
+private:
+
+    struct Pending
+    {
+        uint32_t  epoch_number;
+        BlockHash hash;
+    };
+
+    static constexpr std::chrono::milliseconds COMMIT_POLL{100};
+    static constexpr std::chrono::seconds      COMMIT_TIMEOUT{60};
+
+    void Run();
+
+    /// @returns true if hash isn't the epoch tip by the timeout, or on stop
+    bool WaitForCommit(const BlockHash & hash);
+
+    /// Remove all but the newest config.retain snapshots.
+    void Prune();
+
+    Store &                   _store;
+    StateSnapshotConfig       _config;
+    boost::filesystem::path   _directory;
+    std::mutex                _mutex;
+    std::condition_variable   _condition;
+    std::unique_ptr<Pending>  _pending;
+    bool                      _stopped = false;
+    Log                       _log;
+    std::thread               _thread; ///< declared last, it runs as soon as it's constructed
+};
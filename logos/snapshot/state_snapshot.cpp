@@ -0,0 +1,555 @@
+/// @file
+/// This file contains the implementation of state snapshots.
+
+#include <logos/snapshot/state_snapshot.hpp>
+#include <logos/node/utility.hpp>
+#include <logos/lib/hash.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <functional>
+
+constexpr uint64_t StateSnapshotConfig::DEFAULT_CHUNK_SIZE;
+constexpr uint16_t SnapshotManifest::VERSION;
+const std::string StateSnapshot::MANIFEST_FILE = "manifest.json";
+
+namespace
+{
+
+template<typename T>
+void Append(std::vector<uint8_t> & buffer, const T & value)
+{
+    auto data = reinterpret_cast<const uint8_t *>(&value);
+    buffer.insert(buffer.end(), data, data + sizeof(value));
+}
+
+template<typename T>
+bool Extract(const std::vector<uint8_t> & buffer, size_t & offset, T & value)
+{
+    if(buffer.size() - offset < sizeof(value))
+    {
+        return true;
+    }
+    memcpy(&value, buffer.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return false;
+}
+
+/// Whether the archiver moves the table's records to segments.
+bool Archivable(logos::block_store & store, const MDB_dbi & dbi)
+{
+    return &dbi == &store.batch_db || &dbi == &store.request_db
+           || &dbi == &store.micro_block_db || &dbi == &store.epoch_db;
+}
+
+BlockHash HashBuffer(const std::vector<uint8_t> & buffer)
+{
+    BlockHash digest;
+    blake2b_state hash;
+
+    auto status(blake2b_init(&hash, sizeof(BlockHash)));
+    assert(status == 0);
+
+    blake2b_update(&hash, buffer.data(), buffer.size());
+
+    status = blake2b_final(&hash, digest.data(), sizeof(BlockHash));
+    assert(status == 0);
+
+    return digest;
+}
+
+// Each record is laid out as
+//   table index (1 byte), key size (4 bytes), key, value size (4 bytes), value
+class ChunkWriter
+{
+public:
+
+    ChunkWriter(uint64_t chunk_size,
+                SnapshotManifest & manifest,
+                std::function<boost::filesystem::path(size_t)> chunk_path)
+        : _chunk_size(chunk_size)
+        , _manifest(manifest)
+        , _chunk_path(chunk_path)
+    {}
+
+    bool Add(uint8_t table, const logos::mdb_val & key, const logos::mdb_val & value)
+    {
+        Append(_buffer, table);
+        Append(_buffer, uint32_t(key.size()));
+        _buffer.insert(_buffer.end(),
+                       reinterpret_cast<const uint8_t *>(key.data()),
+                       reinterpret_cast<const uint8_t *>(key.data()) + key.size());
+        Append(_buffer, uint32_t(value.size()));
+        _buffer.insert(_buffer.end(),
+                       reinterpret_cast<const uint8_t *>(value.data()),
+                       reinterpret_cast<const uint8_t *>(value.data()) + value.size());
+        _records++;
+
+        return _buffer.size() >= _chunk_size && Flush();
+    }
+
+    bool Flush()
+    {
+        if(_buffer.empty())
+        {
+            return false;
+        }
+
+        SnapshotChunk chunk;
+        chunk.size = _buffer.size();
+        chunk.records = _records;
+        chunk.hash = HashBuffer(_buffer);
+
+        std::ofstream file(_chunk_path(_manifest.chunks.size()).string(),
+                           std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(_buffer.data()), _buffer.size());
+        file.close();
+        if(!file)
+        {
+            return true;
+        }
+
+        _manifest.chunks.push_back(chunk);
+        _buffer.clear();
+        _records = 0;
+
+        return false;
+    }
+
+private:
+
+    uint64_t                                       _chunk_size;
+    SnapshotManifest &                             _manifest;
+    std::function<boost::filesystem::path(size_t)> _chunk_path;
+    std::vector<uint8_t>                           _buffer;
+    uint64_t                                       _records = 0;
+};
+
+}
+
+void SnapshotManifest::Hash(blake2b_state & hash) const
+{
+    blake2b_update(&hash, &version, sizeof(version));
+    blake2b_update(&hash, &epoch_number, sizeof(epoch_number));
+    epoch_hash.Hash(hash);
+    blake2b_update(&hash, &governance_checkpoint_start, sizeof(governance_checkpoint_start));
+
+    for(auto & chunk : chunks)
+    {
+        blake2b_update(&hash, &chunk.size, sizeof(chunk.size));
+        blake2b_update(&hash, &chunk.records, sizeof(chunk.records));
+        chunk.hash.Hash(hash);
+    }
+}
+
+void SnapshotManifest::SerializeJson(boost::property_tree::ptree & tree) const
+{
+    tree.put("version", version);
+    tree.put("epoch_number", epoch_number);
+    tree.put("epoch_hash", epoch_hash.to_string());
+    tree.put("governance_checkpoint_start", governance_checkpoint_start);
+    tree.put("hash", Blake2bHash(*this).to_string());
+
+    boost::property_tree::ptree chunks_tree;
+    for(auto & chunk : chunks)
+    {
+        boost::property_tree::ptree chunk_tree;
+        chunk_tree.put("size", chunk.size);
+        chunk_tree.put("records", chunk.records);
+        chunk_tree.put("hash", chunk.hash.to_string());
+        chunks_tree.push_back(std::make_pair("", chunk_tree));
+    }
+    tree.add_child("chunks", chunks_tree);
+}
+
+bool SnapshotManifest::DeserializeJson(const boost::property_tree::ptree & tree)
+{
+    try
+    {
+        version = tree.get<uint16_t>("version");
+        if(version != VERSION)
+        {
+            return true;
+        }
+
+        epoch_number = tree.get<uint32_t>("epoch_number");
+        if(epoch_hash.decode_hex(tree.get<std::string>("epoch_hash")))
+        {
+            return true;
+        }
+        governance_checkpoint_start = tree.get<uint32_t>("governance_checkpoint_start");
+
+        chunks.clear();
+        for(auto & entry : tree.get_child("chunks"))
+        {
+            SnapshotChunk chunk;
+            chunk.size = entry.second.get<uint64_t>("size");
+            chunk.records = entry.second.get<uint64_t>("records");
+            if(chunk.hash.decode_hex(entry.second.get<std::string>("hash")))
+            {
+                return true;
+            }
+            chunks.push_back(chunk);
+        }
+    }
+    catch(...)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+bool StateSnapshot::Export(Store & store,
+                           const Path & directory,
+                           uint64_t chunk_size,
+                           SnapshotManifest & manifest)
+{
+    Log log;
+
+    // Every read below, including the getters', goes through this
+    // transaction.
+    logos::read_snapshot snapshot(store.environment);
+
+    Tip tip;
+    ApprovedEB epoch;
+    if(store.epoch_tip_get(tip, snapshot) || store.epoch_get(tip.digest, epoch, snapshot))
+    {
+        LOG_ERROR(log) << "StateSnapshot::Export - failed to get epoch tip";
+        return true;
+    }
+
+    manifest = SnapshotManifest();
+    manifest.epoch_number = epoch.epoch_number;
+    manifest.epoch_hash = tip.digest;
+    manifest.governance_checkpoint_start = store.governance_checkpoint_start(snapshot);
+
+    auto staging = directory;
+    staging += ".partial";
+
+    try
+    {
+        boost::filesystem::remove_all(staging);
+        boost::filesystem::create_directories(staging);
+
+        ChunkWriter writer(chunk_size, manifest,
+                           [&staging](size_t index){ return ChunkPath(staging, index); });
+
+        auto tables = Tables(store);
+        std::vector<uint8_t> archived;
+        for(uint8_t t = 0; t < tables.size(); ++t)
+        {
+            auto & dbi = tables[t].dbi;
+            auto txn = store.txn_for(dbi, snapshot);
+            logos::store_iterator end(nullptr);
+            logos::store_iterator it(txn, dbi);
+
+            // Records moved to segments are merged back in key order, so
+            // the image doesn't depend on whether the node archives.
+            logos::store_iterator index(store.segments && Archivable(store, dbi)
+                                        ? logos::store_iterator(store.history_txn(snapshot), store.segment_index_db)
+                                        : logos::store_iterator(nullptr));
+
+            while(it != end || index != end)
+            {
+                int order = it == end ? -1 : index == end ? 1 : mdb_cmp(txn, dbi, index->first, it->first);
+                bool error = false;
+                if(order < 0)
+                {
+                    // The index holds the records of all four tables.
+                    SegmentLocation location(error, index->second);
+                    bool match = !error && location.table == store.segment_table(dbi);
+                    if(error || (match && store.segments->Read(location, archived)))
+                    {
+                        LOG_ERROR(log) << "StateSnapshot::Export - failed to read archived "
+                                       << index->first.uint256().to_string();
+                        return true;
+                    }
+                    error = match && writer.Add(t, index->first, logos::mdb_val(archived.size(), archived.data()));
+                    ++index;
+                }
+                else
+                {
+                    error = writer.Add(t, it->first, it->second);
+                    if(order == 0)
+                    {
+                        ++index;
+                    }
+                    ++it;
+                }
+
+                if(error)
+                {
+                    LOG_ERROR(log) << "StateSnapshot::Export - failed to write chunk "
+                                   << manifest.chunks.size() << " to " << staging.string();
+                    return true;
+                }
+            }
+        }
+
+        if(writer.Flush())
+        {
+            LOG_ERROR(log) << "StateSnapshot::Export - failed to write chunk "
+                           << manifest.chunks.size() << " to " << staging.string();
+            return true;
+        }
+
+        boost::property_tree::ptree tree;
+        manifest.SerializeJson(tree);
+        boost::property_tree::write_json((staging / MANIFEST_FILE).string(), tree);
+
+        boost::filesystem::remove_all(directory);
+        boost::filesystem::rename(staging, directory);
+    }
+    catch(const std::exception & e)
+    {
+        LOG_ERROR(log) << "StateSnapshot::Export - " << e.what();
+        return true;
+    }
+
+    LOG_INFO(log) << "StateSnapshot::Export - exported epoch " << manifest.epoch_number
+                  << " in " << manifest.chunks.size() << " chunks to " << directory.string()
+                  << ", manifest hash " << Blake2bHash(manifest).to_string();
+
+    return false;
+}
+
+bool StateSnapshot::Import(Store & store,
+                           const Path & directory,
+                           const BlockHash & trusted_hash,
+                           SnapshotManifest & manifest)
+{
+    Log log;
+
+    if(ReadManifest(directory, manifest))
+    {
+        LOG_ERROR(log) << "StateSnapshot::Import - failed to read manifest in " << directory.string();
+        return true;
+    }
+
+    if(Blake2bHash(manifest) != trusted_hash)
+    {
+        LOG_ERROR(log) << "StateSnapshot::Import - manifest hash " << Blake2bHash(manifest).to_string()
+                       << " doesn't match trusted hash " << trusted_hash.to_string();
+        return true;
+    }
+
+    Tip tip;
+    if(!store.epoch_tip_get(tip))
+    {
+        LOG_ERROR(log) << "StateSnapshot::Import - store already has a chain";
+        return true;
+    }
+
+    // Use a raw transaction so that a bad chunk aborts the whole import.
+    MDB_txn * txn;
+    if(mdb_txn_begin(store.environment, nullptr, 0, &txn))
+    {
+        LOG_ERROR(log) << "StateSnapshot::Import - failed to begin transaction";
+        return true;
+    }
+    store.environment.track(txn, nullptr, true);
+
+    auto fail = [&store, txn]()
+    {
+        store.environment.untrack(txn, false);
+        mdb_txn_abort(txn);
+        return true;
+    };
+
+    auto tables = Tables(store);
+    std::vector<uint8_t> buffer;
+
+    for(size_t c = 0; c < manifest.chunks.size(); ++c)
+    {
+        auto & chunk = manifest.chunks[c];
+        auto path = ChunkPath(directory, c);
+
+        std::ifstream file(path.string(), std::ios::binary | std::ios::ate);
+        if(!file || uint64_t(file.tellg()) != chunk.size)
+        {
+            LOG_ERROR(log) << "StateSnapshot::Import - missing or truncated chunk " << path.string();
+            return fail();
+        }
+
+        buffer.resize(chunk.size);
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(buffer.data()), buffer.size());
+        if(!file || HashBuffer(buffer) != chunk.hash)
+        {
+            LOG_ERROR(log) << "StateSnapshot::Import - chunk " << path.string()
+                           << " doesn't match its manifest hash";
+            return fail();
+        }
+
+        size_t offset = 0;
+        uint64_t records = 0;
+        while(offset < buffer.size())
+        {
+            uint8_t table;
+            uint32_t key_size;
+            uint32_t value_size;
+
+            bool error = Extract(buffer, offset, table) || table >= tables.size()
+                         || Extract(buffer, offset, key_size)
+                         || buffer.size() - offset < key_size;
+            MDB_val key{key_size, buffer.data() + offset};
+            if(!error)
+            {
+                offset += key_size;
+                error = Extract(buffer, offset, value_size) || buffer.size() - offset < value_size;
+            }
+            if(error)
+            {
+                LOG_ERROR(log) << "StateSnapshot::Import - malformed chunk " << path.string();
+                return fail();
+            }
+            MDB_val value{value_size, buffer.data() + offset};
+            offset += value_size;
+
+            // Records are exported in key order, which lets the database
+            // append them without searching.
+            auto flags = tables[table].duplicates ? 0 : MDB_APPEND;
+            if(mdb_put(store.txn_for(tables[table].dbi, txn), tables[table].dbi, &key, &value, flags))
+            {
+                LOG_ERROR(log) << "StateSnapshot::Import - failed to put record into "
+                               << tables[table].name;
+                return fail();
+            }
+            records++;
+        }
+
+        if(records != chunk.records)
+        {
+            LOG_ERROR(log) << "StateSnapshot::Import - chunk " << path.string()
+                           << " has " << records << " records, expected " << chunk.records;
+            return fail();
+        }
+    }
+
+    ApprovedEB epoch;
+    if(store.epoch_tip_get(tip, txn) || tip.digest != manifest.epoch_hash
+       || store.epoch_get(tip.digest, epoch, txn) || epoch.Hash() != manifest.epoch_hash
+       || epoch.epoch_number != manifest.epoch_number)
+    {
+        LOG_ERROR(log) << "StateSnapshot::Import - imported epoch tip doesn't match the manifest";
+        return fail();
+    }
+
+    store.sync_leading_candidates(txn);
+
+    // Claims must resolve governance state as on the exporting node, which
+    // walks the governance subchain before its first checkpointed epoch.
+    store.governance_checkpoint_start_put(manifest.governance_checkpoint_start, txn);
+
+    // Block history, if split, commits first, see logos::mdb_env.
+    store.environment.untrack(txn, true);
+    if(mdb_txn_commit(txn))
+    {
+        LOG_ERROR(log) << "StateSnapshot::Import - failed to commit";
+        return true;
+    }
+
+    LOG_INFO(log) << "StateSnapshot::Import - imported epoch " << manifest.epoch_number
+                  << " from " << directory.string();
+
+    return false;
+}
+
+bool StateSnapshot::ImportConfigured(const Path & data_path,
+                                     const StateSnapshotConfig & config,
+                                     int lmdb_max_dbs,
+                                     const Path & history_path)
+{
+    Log log;
+
+    if(config.import_path.empty())
+    {
+        return false;
+    }
+
+    BlockHash trusted_hash;
+    if(trusted_hash.decode_hex(config.trusted_hash))
+    {
+        LOG_ERROR(log) << "StateSnapshot::ImportConfigured - invalid trusted hash " << config.trusted_hash;
+        return true;
+    }
+
+    bool error = false;
+    Store store(error, data_path / "data.ldb", lmdb_max_dbs, history_path);
+    if(error)
+    {
+        LOG_ERROR(log) << "StateSnapshot::ImportConfigured - failed to open store";
+        return true;
+    }
+
+    Tip tip;
+    if(!store.epoch_tip_get(tip))
+    {
+        LOG_INFO(log) << "StateSnapshot::ImportConfigured - store already has a chain, "
+                      << "not importing " << config.import_path;
+        return false;
+    }
+
+    SnapshotManifest manifest;
+    return Import(store, config.import_path, trusted_hash, manifest);
+}
+
+bool StateSnapshot::ReadManifest(const Path & directory, SnapshotManifest & manifest)
+{
+    try
+    {
+        boost::property_tree::ptree tree;
+        boost::property_tree::read_json((directory / MANIFEST_FILE).string(), tree);
+        return manifest.DeserializeJson(tree);
+    }
+    catch(...)
+    {
+        return true;
+    }
+}
+
+std::vector<StateSnapshot::Table> StateSnapshot::Tables(Store & store)
+{
+    // Append only, the table index is part of the chunk format.
+    return {
+        {"batch_db",                 store.batch_db,                 false},
+        {"request_db",               store.request_db,               false},
+        {"account_db",               store.account_db,               false},
+        {"receive_db",               store.receive_db,               false},
+        {"request_tips_db",          store.request_tips_db,          false},
+        {"micro_block_db",           store.micro_block_db,           false},
+        {"micro_block_tip_db",       store.micro_block_tip_db,       false},
+        {"epoch_db",                 store.epoch_db,                 false},
+        {"epoch_tip_db",             store.epoch_tip_db,             false},
+        {"token_user_status_db",     store.token_user_status_db,     false},
+        {"representative_db",        store.representative_db,        false},
+        {"candidacy_db",             store.candidacy_db,             false},
+        {"leading_candidates_db",    store.leading_candidates_db,    false},
+        {"remove_candidates_db",     store.remove_candidates_db,     true},
+        {"remove_reps_db",           store.remove_reps_db,           true},
+        {"voting_power_db",          store.voting_power_db,          false},
+        {"voting_power_fallback_db", store.voting_power_fallback_db, false},
+        {"staking_db",               store.staking_db,               false},
+        {"thawing_db",               store.thawing_db,               true},
+        {"master_liabilities_db",    store.master_liabilities_db,    false},
+        {"rep_liabilities_db",       store.rep_liabilities_db,       true},
+        {"secondary_liabilities_db", store.secondary_liabilities_db, true},
+        {"rewards_db",               store.rewards_db,               false},
+        {"global_rewards_db",        store.global_rewards_db,        false},
+        {"delegate_rewards_db",      store.delegate_rewards_db,      false},
+        {"governance_checkpoint_db", store.governance_checkpoint_db, false},
+        {"thawing_summary_db",       store.thawing_summary_db,       false},
+        {"secondary_liabilities_summary_db", store.secondary_liabilities_summary_db, false},
+    };
+}
+
+StateSnapshot::Path StateSnapshot::ChunkPath(const Path & directory, size_t index)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "chunk_%06zu.bin", index);
+    return directory / name;
+}
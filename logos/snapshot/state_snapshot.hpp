@@ -0,0 +1,127 @@
+/// @file
+/// This file contains the declaration of state snapshots, which let a new
+/// node start from an exported image of another node's databases instead
+/// of replaying the whole chain.
+///
+/// A snapshot is a directory holding a manifest and a sequence of chunk
+/// files. Chunks carry the records of the exported databases in table and
+/// key order, each chunk is committed to by its Blake2b hash in the
+/// manifest, and the manifest hash commits to the whole image and to the
+/// epoch block it was taken at.
+#pragma once
+
+#include <logos/snapshot/state_snapshot_config.hpp>
+#include <logos/blockstore.hpp>
+#include <logos/lib/log.hpp>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <vector>
+
+struct SnapshotChunk
+{
+    uint64_t  size    = 0; ///< bytes in the chunk file
+    uint64_t  records = 0; ///< database records in the chunk
+    BlockHash hash;        ///< Blake2b hash of the chunk file
+};
+
+struct SnapshotManifest
+{
+    static constexpr uint16_t VERSION = 3;
+
+    void Hash(blake2b_state & hash) const;
+    void SerializeJson(boost::property_tree::ptree & tree) const;
+    bool DeserializeJson(const boost::property_tree::ptree & tree);
+
+    uint16_t                   version      = VERSION;
+    uint32_t                   epoch_number = 0;
+    BlockHash                  epoch_hash;  ///< epoch tip when the snapshot was taken
+    uint32_t                   governance_checkpoint_start = 0; ///< first epoch with complete checkpoints
+    std::vector<SnapshotChunk> chunks;
+};
+
+class StateSnapshot
+{
+    using Store = logos::block_store;
+    using Path  = boost::filesystem::path;
+
+public:
+
+    /// Export the store's databases.
+    ///
+    /// All records are read through one LMDB read transaction, so the
+    /// snapshot is a consistent image of the store as of its latest
+    /// epoch block and whatever was persisted after it. The snapshot
+    /// is staged next to directory and only moved into place once
+    /// complete.
+    ///     @param store store to export
+    ///     @param directory snapshot directory, replaced if it exists
+    ///     @param chunk_size maximum bytes per chunk file
+    ///     @param manifest receives the manifest of the snapshot [out]
+    ///     @returns true on error
+    static bool Export(Store & store,
+                       const Path & directory,
+                       uint64_t chunk_size,
+                       SnapshotManifest & manifest);
+
+    /// Import a snapshot into a store that has no chain yet.
+    ///
+    /// Nothing is committed unless the manifest hashes to trusted_hash,
+    /// every chunk matches its manifest entry and the imported epoch
+    /// tip is the manifest's epoch block.
+    ///     @param store empty store to import into
+    ///     @param directory snapshot directory
+    ///     @param trusted_hash expected manifest hash
+    ///     @param manifest receives the manifest of the snapshot [out]
+    ///     @returns true on error
+    static bool Import(Store & store,
+                       const Path & directory,
+                       const BlockHash & trusted_hash,
+                       SnapshotManifest & manifest);
+
+    /// Start a node's database from the configured snapshot, if any.
+    ///
+    /// A database that already has a chain is left untouched, so the
+    /// node simply resumes and bootstraps the blocks following its tips.
+    ///     @param data_path node data directory
+    ///     @param config snapshot configuration
+    ///     @param lmdb_max_dbs maximum LMDB databases of the node's store
+    ///     @param history_path the store's block history database, if split
+    ///     @returns true on error
+    static bool ImportConfigured(const Path & data_path,
+                                 const StateSnapshotConfig & config,
+                                 int lmdb_max_dbs,
+                                 const Path & history_path = Path());
+
+    /// Read a snapshot's manifest.
+    ///     @returns true on error
+    static bool ReadManifest(const Path & directory, SnapshotManifest & manifest);
+
+    static const std::string MANIFEST_FILE;
+
+private:
+
+    struct Table
+    {
+        const char * name;
+        MDB_dbi &    dbi;
+        bool         duplicates;
+    };
+
+    /// The exported databases, in export order.
+    ///
+    /// Node local databases (reservations, peers and address
+    /// advertisements) are not exported. Request history is, since
+    /// governance subchains and representative tips are resolved
+    /// through it when later requests are validated, including the
+    /// records archived to segments, which are exported as if they were
+    /// still in their tables and imported into them. So are governance
+    /// checkpoints, along with the epoch they're complete from in the
+    /// manifest, since claims resolve governance state through them, and
+    /// the thawing and secondary liability summaries, which would only be
+    /// rebuilt as each account is touched again.
+    static std::vector<Table> Tables(Store & store);
+
+    static Path ChunkPath(const Path & directory, size_t index);
+};
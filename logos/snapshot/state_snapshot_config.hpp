@@ -0,0 +1,43 @@
+/// @file
+/// This file contains the declaration of the state snapshot configuration.
+#pragma once
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <string>
+
+struct StateSnapshotConfig
+{
+    static constexpr uint64_t DEFAULT_CHUNK_SIZE = 64 * 1024 * 1024;
+
+    bool DeserializeJson(boost::property_tree::ptree & tree)
+    {
+        export_interval = tree.get<uint32_t>("export_interval", 0);
+        export_path = tree.get<std::string>("export_path", "");
+        retain = tree.get<uint32_t>("retain", 2);
+        chunk_size = tree.get<uint64_t>("chunk_size", DEFAULT_CHUNK_SIZE);
+        import_path = tree.get<std::string>("import_path", "");
+        trusted_hash = tree.get<std::string>("trusted_hash", "");
+
+        return chunk_size == 0 || (!import_path.empty() && trusted_hash.empty());
+    }
+
+    bool SerializeJson(boost::property_tree::ptree & tree) const
+    {
+        tree.put("export_interval", export_interval);
+        tree.put("export_path", export_path);
+        tree.put("retain", retain);
+        tree.put("chunk_size", chunk_size);
+        tree.put("import_path", import_path);
+        tree.put("trusted_hash", trusted_hash);
+
+        return false;
+    }
+
+    uint32_t    export_interval = 0;                  ///< epochs between exports, 0 disables exporting
+    std::string export_path;                          ///< empty for <data_path>/snapshots
+    uint32_t    retain          = 2;                  ///< exported snapshots kept on disk
+    uint64_t    chunk_size      = DEFAULT_CHUNK_SIZE; ///< maximum bytes per chunk file
+    std::string import_path;                          ///< snapshot to start an empty database from
+    std::string trusted_hash;                         ///< required manifest hash of the imported snapshot
+};
@@ -75,3 +75,52 @@ struct Liability
 
 
 };
+
+/*
+ * Aggregate of all secondary liabilities where an account is the source,
+ * kept up to date whenever secondary_liabilities_db is modified
+ * Since all non-expired secondary liabilities of an account have the same
+ * target, the target of the latest expiring one is the target of all
+ * non-expired ones, if any
+ */
+struct SecondaryLiabilitySummary
+{
+    uint32_t count = 0;
+    AccountAddress target = 0;          //target of the latest expiring liability
+    uint32_t latest_expiration = 0;
+
+    void Add(Liability const & l)
+    {
+        ++count;
+        if(l.expiration_epoch >= latest_expiration)
+        {
+            latest_expiration = l.expiration_epoch;
+            target = l.target;
+        }
+    }
+
+    logos::mdb_val to_mdb_val(std::vector<uint8_t>& buf) const
+    {
+        assert(buf.empty());
+        {
+            logos::vectorstream stream(buf);
+            Serialize(stream);
+        }
+        return logos::mdb_val(buf.size(), buf.data());
+    }
+
+    uint32_t Serialize(logos::stream & stream) const
+    {
+        uint32_t s = logos::write(stream, count);
+        s += logos::write(stream, target);
+        s += logos::write(stream, latest_expiration);
+        return s;
+    }
+
+    bool Deserialize(logos::stream & stream)
+    {
+        return logos::read(stream, count)
+            || logos::read(stream, target)
+            || logos::read(stream, latest_expiration);
+    }
+};
@@ -42,8 +42,18 @@ bool LiabilityManager::CreateSecondaryLiability(
         return false;
     }
 
+    //consolidated liabilities are already counted in the summary
+    auto summary = GetSecondaryLiabilitySummary(source, txn);
+    bool consolidated = Exists(l.Hash(), txn);
+
     auto hash = Store(l, txn);
     _store.secondary_liability_put(source, hash, txn);
+
+    if(!consolidated)
+    {
+        summary.Add(l);
+    }
+    _store.secondary_liability_summary_put(source, summary, txn);
     return true;
 }
 
@@ -58,6 +68,7 @@ void LiabilityManager::PruneSecondaryLiabilities(
         return;
     }
     info.epoch_secondary_liabilities_updated = cur_epoch;
+    SecondaryLiabilitySummary summary;
     std::vector<LiabilityHash> hashes(GetSecondaryLiabilities(origin, txn));
     for(auto hash : hashes)
     {
@@ -66,7 +77,12 @@ void LiabilityManager::PruneSecondaryLiabilities(
         {
             _store.secondary_liability_del(hash, txn);
         }
+        else
+        {
+            summary.Add(l);
+        }
     }
+    _store.secondary_liability_summary_put(origin, summary, txn);
 }
 
 
@@ -98,19 +114,14 @@ bool LiabilityManager::CanCreateSecondaryLiability(
         return true;
     }
 
-    std::vector<LiabilityHash> hashes(GetSecondaryLiabilities(source, txn));
-    for(auto hash : hashes)
+    //if the latest expiring liability is expired, all of them are
+    //otherwise, make sure target is same
+    //no need to check any other secondary liabilities, since all non-expired
+    //secondary liabilities for this account will have the same target
+    auto summary = GetSecondaryLiabilitySummary(source, txn);
+    if(summary.latest_expiration > cur_epoch)
     {
-        Liability l = Get(hash, txn);
-
-        //if l.expiration_epoch <= cur_epoch, the liability is expired, so skip it
-        //otherwise, make sure target is same and return
-        //no need to check any other secondary liabilities, since all secondary
-        //liabilities for this account will have the same target
-        if(l.expiration_epoch > cur_epoch)
-        {
-            return l.target == target;
-        }
+        return summary.target == target;
     }
     //Execution gets here if source has no secondary liabilities, or all secondary
     //liabilities of source are expired
@@ -155,6 +166,24 @@ std::vector<LiabilityHash> LiabilityManager::GetHashes(
     return hashes;
 }
 
+SecondaryLiabilitySummary LiabilityManager::GetSecondaryLiabilitySummary(
+        AccountAddress const & origin,
+        MDB_txn* txn)
+{
+    SecondaryLiabilitySummary summary;
+    if(_store.secondary_liability_summary_get(origin, summary, txn))
+    {
+        //accounts whose secondary liabilities were stored before summaries
+        //were kept
+        summary = SecondaryLiabilitySummary();
+        for(auto hash : GetSecondaryLiabilities(origin, txn))
+        {
+            summary.Add(Get(hash, txn));
+        }
+    }
+    return summary;
+}
+
 std::vector<LiabilityHash> LiabilityManager::GetSecondaryLiabilities(
         AccountAddress const & origin,
         MDB_txn* txn)
@@ -124,6 +124,14 @@ class LiabilityManager
             MDB_dbi BlockStore::*dbi,
             MDB_txn* txn);
 
+    /*
+     * Returns the stored summary of secondary liabilities where origin is
+     * source, or computes it from secondary_liabilities_db if none is stored
+     */
+    SecondaryLiabilitySummary GetSecondaryLiabilitySummary(
+            AccountAddress const & origin,
+            MDB_txn* txn);
+
 
     private:
     BlockStore& _store;
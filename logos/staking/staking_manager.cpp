@@ -188,6 +188,7 @@ bool StakingManager::Store(
         AccountAddress const & origin,
         MDB_txn* txn)
 {
+    auto summary = GetThawingSummary(origin, txn);
     bool consolidated = false;
     auto update = [&funds,&consolidated,&txn,this](ThawingFunds& t, logos::store_iterator& it)
     {
@@ -217,7 +218,13 @@ bool StakingManager::Store(
     {
         _store.thawing_put(origin, funds, txn);
         _liability_mgr.UpdateLiabilityAmount(funds.liability_hash, funds.amount, txn);
+        summary.Add(funds);
     }
+    else
+    {
+        summary.total += funds.amount;
+    }
+    _store.thawing_summary_put(origin, summary, txn);
     return consolidated;
 }
 
@@ -226,7 +233,12 @@ void StakingManager::Delete(
         AccountAddress const & origin,
         MDB_txn* txn)
 {
-    _store.thawing_del(origin, funds, txn);
+    auto summary = GetThawingSummary(origin, txn);
+    if(!_store.thawing_del(origin, funds, txn))
+    {
+        summary.Remove(funds);
+        _store.thawing_summary_put(origin, summary, txn);
+    }
 }
 
 void StakingManager::Delete(
@@ -259,6 +271,24 @@ std::vector<ThawingFunds> StakingManager::GetThawingFunds(
     return thawing;
 }
 
+ThawingSummary StakingManager::GetThawingSummary(
+        AccountAddress const & origin,
+        MDB_txn* txn)
+{
+    ThawingSummary summary;
+    if(_store.thawing_summary_get(origin, summary, txn))
+    {
+        //accounts whose thawing funds were stored before summaries were kept
+        summary = ThawingSummary();
+        ProcessThawingFunds(origin, [&summary](ThawingFunds & t)
+            {
+                summary.Add(t);
+                return true;
+            }, txn);
+    }
+    return summary;
+}
+
 void StakingManager::ProcessThawingFunds(
         AccountAddress const & origin,
         std::function<bool(ThawingFunds & funds)> func,
@@ -659,6 +689,13 @@ bool StakingManager::Validate(
             remaining -= cur_stake.amount;
         }
     }
+    //thawing funds can't satisfy more than their total
+    ThawingSummary summary;
+    if(!_store.thawing_summary_get(origin, summary, txn) && summary.total < remaining)
+    {
+        return false;
+    }
+
     bool res = false;
     //if available funds and staked funds together cannot satisfy request,
     //attempt to use thawing funds to satisfy remaining portion of request
@@ -695,8 +732,10 @@ void StakingManager::PruneThawing(
     info.epoch_thawing_updated = cur_epoch;
 
     Amount amount_pruned = 0;
+    //every record is visited, so the summary of the remaining funds is exact
+    ThawingSummary summary;
 
-    auto func = [&cur_epoch,&origin,&amount_pruned](ThawingFunds& t, logos::store_iterator& it)
+    auto func = [&cur_epoch,&origin,&amount_pruned,&summary](ThawingFunds& t, logos::store_iterator& it)
     {
         if(t.expiration_epoch != 0 && t.expiration_epoch <= cur_epoch)
         {
@@ -709,9 +748,14 @@ void StakingManager::PruneThawing(
             }
             amount_pruned += t.amount;
         }
+        else
+        {
+            summary.Add(t);
+        }
         return true;
     };
     ProcessThawingFunds(origin,func,txn);
+    _store.thawing_summary_put(origin, summary, txn);
 
     info.SetAvailableBalance(
             info.GetAvailableBalance()+amount_pruned,
@@ -731,6 +775,13 @@ Amount StakingManager::GetPruneableThawingAmount(
     {
         return total;
     }
+    //no funds expire by cur_epoch
+    ThawingSummary summary;
+    if(!_store.thawing_summary_get(origin, summary, txn)
+            && (summary.earliest_expiration == 0 || summary.earliest_expiration > cur_epoch))
+    {
+        return total;
+    }
     auto func = [&cur_epoch,&total](ThawingFunds& t)
     {
         if(t.expiration_epoch != 0 && t.expiration_epoch <= cur_epoch)
@@ -757,7 +808,8 @@ void StakingManager::MarkThawingAsFrozen(
     }
     uint32_t epoch_to_mark_frozen = epoch_created+THAWING_PERIOD;
     std::vector<ThawingFunds> updated;
-    auto update = [&updated,&txn,&epoch_to_mark_frozen,&origin,this]
+    auto summary = GetThawingSummary(origin, txn);
+    auto update = [&updated,&txn,&epoch_to_mark_frozen,&origin,&summary,this]
         (ThawingFunds& funds, logos::store_iterator& it)
     {
         if(funds.expiration_epoch == epoch_to_mark_frozen
@@ -781,6 +833,7 @@ void StakingManager::MarkThawingAsFrozen(
                     << "mdb_cursor_del failed. origin = "
                     << origin.to_string();
             }
+            summary.Remove(funds);
         }
         //thawing funds are stored in reverse order of expiration_epoch
         //expiration epoch decreases as loop continues
@@ -792,6 +845,7 @@ void StakingManager::MarkThawingAsFrozen(
         return true;
     };
     ProcessThawingFunds(origin, update, txn);
+    _store.thawing_summary_put(origin, summary, txn);
     for(auto t : updated)
     {
         Store(t,origin,txn);
@@ -812,7 +866,8 @@ void StakingManager::SetExpirationOfFrozen(
     }
     uint32_t exp_epoch = epoch_unfrozen + THAWING_PERIOD;
     std::vector<ThawingFunds> updated;
-    auto update = [&exp_epoch,&origin,&updated,&txn,this](ThawingFunds& funds, logos::store_iterator& it)
+    auto summary = GetThawingSummary(origin, txn);
+    auto update = [&exp_epoch,&origin,&updated,&summary,&txn,this](ThawingFunds& funds, logos::store_iterator& it)
     {
         //expiration of 0 represents frozen funds
         if(funds.expiration_epoch == 0)
@@ -837,10 +892,12 @@ void StakingManager::SetExpirationOfFrozen(
                     << origin.to_string();
                 trace_and_halt();
             }
+            summary.Remove(funds);
         }
         return true;
     };
     ProcessThawingFunds(origin, update, txn);
+    _store.thawing_summary_put(origin, summary, txn);
     for(auto t : updated)
     {
         Store(t,origin,txn);
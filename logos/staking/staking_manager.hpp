@@ -262,6 +262,12 @@ class StakingManager
     // Deletes ThawingFunds from db. Caller's responsibility to delete associated liability
     void Delete(ThawingFunds const & funds, AccountAddress const & origin, MDB_txn* txn);
 
+    /*
+     * Returns the stored summary of origin's ThawingFunds, or computes it
+     * from thawing_db if none is stored
+     */
+    ThawingSummary GetThawingSummary(AccountAddress const & origin, MDB_txn* txn);
+
     // Deletes StakedFunds from db. Callers responsibility to delete associated liability
     void Delete(StakedFunds const & funds, AccountAddress const & origin, MDB_txn* txn);
 
@@ -324,5 +330,6 @@ class StakingManager
     friend class Staking_Manager_Thawing_Test;
     friend class Staking_Manager_Frozen_Test;
     friend class Staking_Manager_Extract_Test;
+    friend class Staking_Manager_ThawingSummary_Test;
 
 };
@@ -45,3 +45,52 @@ bool ThawingFunds::operator==(ThawingFunds const & other) const
         && amount == other.amount
         && liability_hash == other.liability_hash;
 }
+
+ThawingSummary::ThawingSummary() : count(0), total(0), earliest_expiration(0) {}
+
+void ThawingSummary::Add(ThawingFunds const & funds)
+{
+    ++count;
+    total += funds.amount;
+    if(funds.expiration_epoch != 0
+            && (earliest_expiration == 0 || funds.expiration_epoch < earliest_expiration))
+    {
+        earliest_expiration = funds.expiration_epoch;
+    }
+}
+
+void ThawingSummary::Remove(ThawingFunds const & funds)
+{
+    assert(count > 0 && total >= funds.amount);
+    --count;
+    total -= funds.amount;
+    if(count == 0)
+    {
+        earliest_expiration = 0;
+    }
+}
+
+logos::mdb_val ThawingSummary::to_mdb_val(std::vector<uint8_t>& buf) const
+{
+    assert(buf.empty());
+    {
+        logos::vectorstream stream(buf);
+        Serialize(stream);
+    }
+    return logos::mdb_val(buf.size(), buf.data());
+}
+
+uint32_t ThawingSummary::Serialize(logos::stream & stream) const
+{
+    uint32_t s = logos::write(stream, count);
+    s += logos::write(stream, total);
+    s += logos::write(stream, earliest_expiration);
+    return s;
+}
+
+bool ThawingSummary::Deserialize(logos::stream & stream)
+{
+    return logos::read(stream, count)
+        || logos::read(stream, total)
+        || logos::read(stream, earliest_expiration);
+}
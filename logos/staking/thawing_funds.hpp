@@ -17,3 +17,31 @@ struct ThawingFunds
     bool operator==(ThawingFunds const & other) const;
 
 };
+
+/*
+ * Aggregate of all ThawingFunds owned by an account, kept up to date whenever
+ * thawing_db is modified so that validation does not need to iterate thawing_db
+ * earliest_expiration is a lower bound: it is exact after the account's
+ * thawing funds are pruned, but is not raised when the earliest funds are
+ * deleted otherwise
+ */
+struct ThawingSummary
+{
+    uint32_t count;
+    Amount total;
+    uint32_t earliest_expiration; //0 if no funds with an expiration were stored
+
+    ThawingSummary();
+
+    //Adds funds to the summary
+    void Add(ThawingFunds const & funds);
+
+    //Removes funds from the summary
+    void Remove(ThawingFunds const & funds);
+
+    logos::mdb_val to_mdb_val(std::vector<uint8_t>& buf) const;
+
+    uint32_t Serialize(logos::stream & stream) const;
+
+    bool Deserialize(logos::stream & stream);
+};
@@ -132,7 +132,13 @@ TxAcceptor::ProcessBlock( std::shared_ptr<DM> block, Messages &blocks, Responses
 {
     BlockHash hash = 0;
 
-    auto result = Validate(block);
+    // Answer resubmitted requests before verifying their signature.
+    auto result = _acceptor_channel->OnRequestDigest(block->GetHash());
+
+    if (result == logos::process_result::progress)
+    {
+        result = Validate(block);
+    }
 
     if (result == logos::process_result::progress)
     {
@@ -178,7 +184,9 @@ TxAcceptor::AsyncReadJson(std::shared_ptr<Socket> socket)
 
         bool should_buffer = request_tree.get_optional<std::string>("buffer").is_initialized();
 
-        auto parse = [this, request, &blocks, &response, should_buffer](Ptree &request_tree) {
+        Messages requests;
+
+        auto parse = [this, request, &requests](Ptree &request_tree) {
 
             auto block = ToRequest(request_tree.get<std::string>("request"));
 
@@ -189,29 +197,40 @@ TxAcceptor::AsyncReadJson(std::shared_ptr<Socket> socket)
                 return;
             }
 
-
-            ProcessBlock(block, blocks, response, should_buffer);
-
-            LOG_INFO(_log) << "TxAcceptor::AsyncReadJson responses " << response.size();
+            requests.push_back(block);
         };
 
         // request could be malformed
         try
         {
-            auto tree = request_tree.get_child_optional("requests");
-            if (tree)
             {
-                for (auto t : tree.value())
+                // Hash the requests together rather than one at a time.
+                Request::DeferDigests defer;
+
+                auto tree = request_tree.get_child_optional("requests");
+                if (tree)
+                {
+                    for (auto t : tree.value())
+                    {
+                        parse(t.second);
+                    }
+                }
+                else
                 {
-                    parse(t.second);
+                    LOG_INFO(_log) << "TxAcceptor::AsyncReadJson using backward compatible format of single request";
+                    parse(request_tree);
                 }
             }
-            else
+
+            Request::ComputeDigests(requests);
+
+            for (auto & block : requests)
             {
-                LOG_INFO(_log) << "TxAcceptor::AsyncReadJson using backward compatible format of single request";
-                parse(request_tree);
+                ProcessBlock(block, blocks, response, should_buffer);
             }
 
+            LOG_INFO(_log) << "TxAcceptor::AsyncReadJson responses " << response.size();
+
             PostProcessBlocks(blocks, response);
 
             LOG_DEBUG(_log) << "TxAcceptor::AsyncReadJson submitted requests "
@@ -304,23 +323,42 @@ TxAcceptor::AsyncReadBin(std::shared_ptr<Socket> socket)
              auto nblocks = header.mpf;
              std::shared_ptr<DM> block = nullptr;
              Messages blocks;
+             Messages requests;
 
-             while (nblocks > 0)
              {
-                 error = false;
-
-                 block = static_pointer_cast<DM>(DeserializeRequest(error, stream));
+                 // Hash the requests together rather than one at a time.
+                 Request::DeferDigests defer;
 
-                 if (error)
+                 while (nblocks > 0)
                  {
-                     LOG_ERROR(_log) << "TxAcceptor::AsyncReadBin transaction deserialize error";
-                     response.push_back(std::make_pair(logos::process_result::invalid_request, 0));
-                     break;
+                     error = false;
+
+                     // Keep the received bytes so the request can be forwarded as is.
+                     block = static_pointer_cast<DM>(KeepWireBytes() ? DeserializeRequest(error, stream, buf)
+                                                                     : DeserializeRequest(error, stream));
+
+                     if (error)
+                     {
+                         LOG_ERROR(_log) << "TxAcceptor::AsyncReadBin transaction deserialize error";
+                         break;
+                     }
+
+                     requests.push_back(block);
+
+                     nblocks--;
                  }
+             }
+
+             Request::ComputeDigests(requests);
 
-                 ProcessBlock(block, blocks, response);
+             for (auto & request : requests)
+             {
+                 ProcessBlock(request, blocks, response);
+             }
 
-                 nblocks--;
+             if (error)
+             {
+                 response.push_back(std::make_pair(logos::process_result::invalid_request, 0));
              }
 
              if (nblocks > 0)
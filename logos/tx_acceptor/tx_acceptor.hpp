@@ -171,6 +171,13 @@ private:
         return logos::process_result::progress;
     }
 
+    /// Keep the received bytes of binary requests, to forward them without
+    /// serializing again, default is not to keep them
+    virtual bool KeepWireBytes()
+    {
+        return false;
+    }
+
     class ConnectionsManager {
     public:
         ConnectionsManager(std::atomic<uint32_t> &cur_connections)
@@ -210,6 +217,10 @@ public:
     {
         _acceptor_channel = std::make_shared<TxAcceptorChannel>(_service, _config);
     }
+    bool KeepWireBytes() override
+    {
+        return true;
+    }
 };
 
 /// Delegate parses batch request and sends transactions as vector.
@@ -60,25 +60,69 @@ TxAcceptorChannel::OnDelegateMessage(std::shared_ptr<DM> block, bool should_buff
     return result;
 }
 
-TxChannel::Responses
-TxAcceptorChannel::OnSendRequest(std::vector<std::shared_ptr<DM>> &blocks)
+std::vector<TxAcceptorChannel::QueuedWrite>
+TxAcceptorChannel::BuildFrame(const std::vector<std::shared_ptr<DM>> &blocks)
 {
-    logos::process_result result{logos::process_result::progress};
-
-    auto buf{std::make_shared<vector<uint8_t>>()};
     TxMessageHeader header(0, blocks.size());
+    std::vector<QueuedWrite> writes(1);
+    std::shared_ptr<vector<uint8_t>> serialized;
+
+    auto flush_serialized = [&writes, &serialized]() {
+        if (serialized)
+        {
+            writes.push_back({serialized, boost::asio::buffer(serialized->data(), serialized->size())});
+            serialized.reset();
+        }
+    };
+
+    for (auto & block : blocks)
     {
-        logos::vectorstream stream(*buf);
-        header.Serialize(stream);
-        for (auto block : blocks)
+        auto & wire = block->wire;
+        if (!wire.buffer)
         {
+            // Requests received in json are serialized here.
+            if (!serialized)
+            {
+                serialized = std::make_shared<vector<uint8_t>>();
+            }
+            logos::vectorstream stream(*serialized);
             header.payload_size += block->ToStream(stream);
+            continue;
+        }
+
+        flush_serialized();
+
+        // Forward the received bytes, coalescing requests that were
+        // adjacent in the client's message.
+        auto data = wire.buffer->data() + wire.offset;
+        auto & last = writes.back();
+        if (last.owner == wire.buffer &&
+            static_cast<const uint8_t *>(last.buffer.data()) + last.buffer.size() == data)
+        {
+            last.buffer = boost::asio::buffer(last.buffer.data(), last.buffer.size() + wire.size);
         }
+        else
+        {
+            writes.push_back({wire.buffer, boost::asio::buffer(data, wire.size)});
+        }
+        header.payload_size += wire.size;
     }
-    HeaderStream header_stream(buf->data(), TxMessageHeader::MESSAGE_SIZE);
-    header.Serialize(header_stream);
 
-    if (!AsyncSend(buf))
+    flush_serialized();
+
+    auto buf{std::make_shared<vector<uint8_t>>()};
+    header.Serialize(*buf);
+    writes.front() = {buf, boost::asio::buffer(buf->data(), buf->size())};
+
+    return writes;
+}
+
+TxChannel::Responses
+TxAcceptorChannel::OnSendRequest(std::vector<std::shared_ptr<DM>> &blocks)
+{
+    logos::process_result result{logos::process_result::progress};
+
+    if (!NetIOSend::AsyncSend(BuildFrame(blocks)))
     {
         result={logos::process_result::initializing};
     }
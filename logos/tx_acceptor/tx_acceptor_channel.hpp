@@ -25,6 +25,7 @@ class TxAcceptorChannel : public TxChannel,
     using Error         = boost::system::error_code;
     using Timer         = boost::asio::deadline_timer;
     using Seconds       = boost::posix_time::seconds;
+    using QueuedWrite   = NetIOSend::QueuedWrite;
 
 public:
     /// Class constructor
@@ -34,6 +35,13 @@ public:
     /// Class distruction
     ~TxAcceptorChannel() = default;
 
+    /// Frame requests for the delegate: the header, then each request's
+    /// received bytes, merging those adjacent in the client's message, or
+    /// its serialization if it was received in json.
+    ///     @param blocks of transactions [in]
+    ///     @return buffers to write, with their owners
+    static std::vector<QueuedWrite> BuildFrame(const std::vector<std::shared_ptr<DM>> &blocks);
+
 protected:
 
     /// Handle write error
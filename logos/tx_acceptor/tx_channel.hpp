@@ -32,6 +32,15 @@ public:
     ///     @param blocks of transaction [in]
     ///     @return process_return result of the operation, in standalone returns either progress or initializing
     virtual Responses OnSendRequest(std::vector<std::shared_ptr<DM>> &blocks) = 0;
+    /// Checks a request digest against recently seen requests, before
+    /// the request is validated.
+    ///     @param hash digest of the request [in]
+    ///     @return progress if the request should be processed, otherwise
+    ///             the result of the duplicate, e.g. pending or old
+    virtual logos::process_result OnRequestDigest(const BlockHash & hash)
+    {
+        return logos::process_result::progress;
+    }
 };
 
 class TxChannelExt : public TxChannel {
@@ -165,20 +165,27 @@ TxReceiverChannel::AsyncReadMessage(const TxMessageHeader & header)
         LOG_DEBUG(this_s->_log) << "TxReceiverChannel::AsyncReadMessage received payload size "
                         << payload_size << " number blocks " << nblocks;
 
-        while (nblocks > 0)
         {
-            auto block = DeserializeRequest(error, stream);
-            if (error)
+            // The acceptor isn't trusted with digests, hash the requests together.
+            Request::DeferDigests defer;
+
+            while (nblocks > 0)
             {
-                LOG_ERROR(this_s->_log) << "TxReceiverChannel::AsyncReadMessage deserialize error, payload size "
-                                << payload_size;
-                this_s->ReConnect(true);
-                return;
+                auto block = DeserializeRequest(error, stream);
+                if (error)
+                {
+                    LOG_ERROR(this_s->_log) << "TxReceiverChannel::AsyncReadMessage deserialize error, payload size "
+                                    << payload_size;
+                    this_s->ReConnect(true);
+                    return;
+                }
+                blocks.push_back(static_pointer_cast<DM>(block));
+                nblocks--;
             }
-            blocks.push_back(static_pointer_cast<DM>(block));
-            nblocks--;
         }
 
+        Request::ComputeDigests(blocks);
+
         this_s->_last_received = GetStamp();
 
         LOG_DEBUG(this_s->_log) << "TxReceiverChannel::AsyncReadMessage sending "
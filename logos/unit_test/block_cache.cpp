@@ -5,6 +5,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <vector>
+#include <algorithm>
 #include "../consensus/persistence/block_cache.hpp"
 
 #define TEST_DIR  ".logos_test"
@@ -597,3 +598,67 @@ TEST (BlockCache, AccountDependenciesTest)
         EXPECT_EQ(hash, h[i]);
     }
 }
+
+static RBPtr make_send_rb(int epoch_num, uint8_t delegate_id, const AccountAddress &origin, const AccountAddress &destination)
+{
+    RBPtr rb = make_rb(epoch_num, delegate_id, 0, BlockHash());
+    auto send = std::make_shared<Send>();
+    send->origin = origin;
+    send->AddTransaction(destination, 1);
+    rb->requests.push_back(send);
+    return rb;
+}
+
+TEST (BlockCache, ConcurrentRequestBlocksTest)
+{
+    test_data t;
+    EXPECT_EQ(t.error, false);
+    boost::asio::io_service service;
+    logos::BlockWriteQueue q(service, t.store, 0, &t.store_q);
+    logos::PendingBlockContainer container(q);
+
+    // chain 2 receives from chain 0's origin, chain 3 only sends.
+    RBPtr rb[4] = {
+        make_send_rb(3, 0, 1, 2),
+        make_send_rb(3, 1, 3, 4),
+        make_send_rb(3, 2, 5, 1),
+        make_rb(3, 3, 0, BlockHash()),
+    };
+    for (auto &b : rb)
+    {
+        EXPECT_EQ(container.AddRequestBlock(b, false), true);
+    }
+
+    logos::PendingBlockContainer::ChainPtr ptr;
+    uint8_t rb_idx = 0;
+    ASSERT_EQ(container.GetNextBlock(ptr, rb_idx, false), true);
+    ASSERT_EQ(ptr.rptr->block, rb[0]);
+
+    // Chain 2 conflicts with chain 0 and chain 3's unknown request has to be validated alone.
+    std::vector<logos::PendingBlockContainer::ChainPtr> round;
+    container.GetConcurrentRequestBlocks(ptr, NUM_DELEGATES, round);
+    ASSERT_EQ(round.size(), 2);
+    EXPECT_EQ(round[0].rptr->block, rb[0]);
+    EXPECT_EQ(round[1].rptr->block, rb[1]);
+
+    // Collected blocks are locked until released, removed if valid.
+    container.ReleaseRequestBlock(round[1], true);
+    ASSERT_EQ(container.GetNextBlock(ptr, rb_idx, true), true);
+    EXPECT_EQ(ptr.rptr->block, rb[2]);
+    ASSERT_EQ(container.GetNextBlock(ptr, rb_idx, true), true);
+    EXPECT_EQ(ptr.rptr->block, rb[3]);
+    EXPECT_EQ(container.GetNextBlock(ptr, rb_idx, true), false);
+}
+
+TEST (BlockCache, ValidationPoolTest)
+{
+    ValidationPool pool(4);
+    EXPECT_EQ(pool.Size(), 4);
+
+    for (int round = 0; round < 100; ++round)
+    {
+        std::vector<uint8_t> ran(NUM_DELEGATES, 0);
+        pool.Run(ran.size(), [&ran](size_t i){ ran[i]++; });
+        EXPECT_EQ(std::count(ran.begin(), ran.end(), 1), ran.size());
+    }
+}
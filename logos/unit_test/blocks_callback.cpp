@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <logos/node/client_callback.hpp>
+
+#include <thread>
+
+#define Unit_Test_BlocksCallback
+
+#ifdef Unit_Test_BlocksCallback
+
+namespace
+{
+using TCP = boost::asio::ip::tcp;
+
+/// A callback server answering every POST with status, until count were
+/// received. Records the bodies and the connections accepted.
+struct CallbackServer
+{
+    CallbackServer(size_t count, HTTP::status status)
+        : acceptor(service, {boost::asio::ip::address_v4::loopback(), 0})
+        , thread([this, count, status]() { Serve(count, status); })
+    {}
+
+    void Serve(size_t count, HTTP::status status)
+    {
+        while(bodies.size() < count)
+        {
+            TCP::socket socket(service);
+            acceptor.accept(socket);
+            connections++;
+
+            boost::beast::flat_buffer buffer;
+            boost::system::error_code ec;
+            while(!ec && bodies.size() < count)
+            {
+                HTTP::request<HTTP::string_body> request;
+                HTTP::read(socket, buffer, request, ec);
+                if(ec)
+                {
+                    break;
+                }
+                bodies.push_back(request.body());
+
+                HTTP::response<HTTP::string_body> response(status, 11);
+                response.keep_alive(true);
+                response.prepare_payload();
+                HTTP::write(socket, response, ec);
+            }
+        }
+    }
+
+    uint16_t Port()
+    {
+        return acceptor.local_endpoint().port();
+    }
+
+    boost::asio::io_service  service;
+    TCP::acceptor            acceptor;
+    std::vector<std::string> bodies;
+    size_t                   connections = 0;
+    std::thread              thread;
+};
+
+std::shared_ptr<std::string> Body(const char * body)
+{
+    return std::make_shared<std::string>(body);
+}
+}
+
+TEST (BlocksCallback, BatchesOverKeepAlive)
+{
+    CallbackServer server(2, HTTP::status::ok);
+
+    CallbackOptions options;
+    options.connections = 1;
+    options.batch_size = 2;
+    options.queue_limit = 4;
+
+    boost::asio::io_service service;
+    BlocksCallback callback(service, "127.0.0.1", server.Port(), "/", false, options);
+
+    // Queued while the address is resolved; the oldest is dropped once
+    // the queue is full.
+    for(auto body : {"1", "2", "3", "4", "5"})
+    {
+        callback.SendMessage(Body(body));
+    }
+
+    service.run();
+    server.thread.join();
+
+    // Both batches went over the one keep-alive connection.
+    ASSERT_EQ(server.connections, 1);
+    ASSERT_EQ(server.bodies, std::vector<std::string>({"[2,3]", "[4,5]"}));
+
+    auto stats = callback.GetStats();
+    ASSERT_EQ(stats.sent, 4);
+    ASSERT_EQ(stats.dropped, 1);
+    ASSERT_EQ(stats.retried, 0);
+    ASSERT_EQ(stats.queued, 0);
+}
+
+TEST (BlocksCallback, RetriesThenDrops)
+{
+    // The first attempt and one retry.
+    CallbackServer server(2, HTTP::status::internal_server_error);
+
+    CallbackOptions options;
+    options.connections = 2;
+    options.retries = 1;
+
+    boost::asio::io_service service;
+    BlocksCallback callback(service, "127.0.0.1", server.Port(), "/", false, options);
+
+    callback.SendMessage(Body("{\"hash\":\"1\"}"));
+
+    service.run();
+    server.thread.join();
+
+    // A failed POST closes its connection.
+    ASSERT_EQ(server.connections, 2);
+    ASSERT_EQ(server.bodies, std::vector<std::string>(2, "{\"hash\":\"1\"}"));
+
+    auto stats = callback.GetStats();
+    ASSERT_EQ(stats.sent, 0);
+    ASSERT_EQ(stats.retried, 1);
+    ASSERT_EQ(stats.dropped, 1);
+    ASSERT_EQ(stats.queued, 0);
+}
+
+#endif // #ifdef Unit_Test_BlocksCallback
@@ -917,4 +917,55 @@ TEST (bootstrap, puller)
         bsb->primary_delegate = 0;
         ASSERT_EQ(puller.BSBReceived(pull, bsb, false), Bootstrap::PullStatus::Continue);
     }
+
+    //micro blocks pulled ahead split delegate chains into ranges
+    {
+        Bootstrap::Puller puller(cache, alarm);
+        Bootstrap::TipSet tips = create_tip_set();
+        Bootstrap::TipSet tips_other = create_tip_set();
+        tips_other.mb.sqn += 2;
+        for (uint32_t i = 0; i < NUM_DELEGATES; ++i) {
+            tips_other.bsb_vec[i] = {tips.bsb_vec[i].epoch, 1, 200 + i};
+        }
+        puller.Init(attempt, tips, tips_other);
+        ASSERT_EQ(puller.GetNumWaitingPulls(), 1);
+
+        auto mb1 = std::make_shared<ApprovedMB>();
+        mb1->epoch_number = tips.mb.epoch;
+        mb1->sequence = tips.mb.sqn + 1;
+        mb1->previous = tips.mb.digest;
+        auto mb2 = std::make_shared<ApprovedMB>(*mb1);
+        mb2->sequence++;
+        for (uint32_t i = 0; i < NUM_DELEGATES; ++i) {
+            mb1->tips[i] = {tips.bsb_vec[i].epoch, 0, 100 + i};
+            mb2->tips[i] = tips_other.bsb_vec[i];
+        }
+        mb2->previous = mb1->Hash();
+
+        PullPtr pull = puller.GetPull();
+        ASSERT_EQ(puller.MBReceived(pull, mb1), Bootstrap::PullStatus::Done);
+        ASSERT_EQ(puller.GetNumWaitingPulls(), 1);
+        pull = puller.GetPull();
+        ASSERT_EQ(pull->prev_hash, mb1->Hash());
+        ASSERT_EQ(puller.MBReceived(pull, mb2), Bootstrap::PullStatus::Done);
+        ASSERT_EQ(puller.GetNumWaitingPulls(), 2 * NUM_DELEGATES);
+
+        std::vector<PullPtr> pulls;
+        for (uint32_t i = 0; i < 2 * NUM_DELEGATES; ++i) {
+            pulls.push_back(puller.GetPull());
+        }
+        for (uint32_t i = 0; i < NUM_DELEGATES; ++i) {
+            ASSERT_EQ(pulls[2 * i]->target, mb1->tips[i].digest);
+            ASSERT_EQ(pulls[2 * i + 1]->prev_hash, mb1->tips[i].digest);
+            ASSERT_EQ(pulls[2 * i + 1]->target, mb2->tips[i].digest);
+        }
+
+        //a later range first
+        auto bsb = std::make_shared<ApprovedRB>();
+        bsb->epoch_number = tips.bsb_vec.front().epoch;
+        bsb->sequence = 1;
+        bsb->previous = pulls[1]->prev_hash;
+        bsb->primary_delegate = 0;
+        ASSERT_EQ(puller.BSBReceived(pulls[1], bsb, false), Bootstrap::PullStatus::Continue);
+    }
 }
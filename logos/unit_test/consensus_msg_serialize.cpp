@@ -738,6 +738,53 @@ TEST (blocks, epoch_block_PostCommit_DB)
     ASSERT_EQ(block.Hash(), block2.Hash());
 }
 
+template<ConsensusType CT>
+void check_span_serialization(PostCommittedBlock<CT> & block)
+{
+    // The pre-sized span output matches the growing vectorstream's.
+    vector<uint8_t> expected;
+    {
+        logos::vectorstream stream(expected);
+        block.Serialize(stream, true, true);
+    }
+
+    ASSERT_EQ(block.WireSize(true, true), expected.size());
+
+    vector<uint8_t> buf;
+    block.Serialize(buf, true, true);
+    ASSERT_EQ(buf.size(), expected.size());
+    ASSERT_TRUE(std::equal(buf.begin() + MessagePrequelSize, buf.end(), expected.begin() + MessagePrequelSize));
+
+    // Reads past the end of a span fail.
+    bool error = false;
+    logos::span_reader stream(buf.data() + MessagePrequelSize, buf.size() - MessagePrequelSize - 1);
+    PostCommittedBlock<CT> truncated(error, stream, logos_version, true, true);
+    ASSERT_TRUE(error);
+
+    // Writes past the end of a span are cut short.
+    vector<uint8_t> small(buf.size() - 1);
+    logos::span_writer writer(small.data(), small.size());
+    block.Serialize(writer, true, true);
+    ASSERT_TRUE(writer.overflowed());
+    ASSERT_EQ(writer.size(), small.size());
+}
+
+TEST (blocks, span_serialization)
+{
+    auto rb_pp = create_bsb_preprepare(CONSENSUS_BATCH_SIZE);
+    auto rb = create_approved_block<ConsensusType::Request>(rb_pp);
+    rb.next = 90;
+    check_span_serialization(rb);
+
+    auto mb_pp = create_mb_preprepare();
+    auto mb = create_approved_block<ConsensusType::MicroBlock>(mb_pp);
+    check_span_serialization(mb);
+
+    auto eb_pp = create_eb_preprepare();
+    auto eb = create_approved_block<ConsensusType::Epoch>(eb_pp);
+    check_span_serialization(eb);
+}
+
 #endif
 
 ///////////////////////////////////////message_validator tests
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <logos/node/executor_lanes.hpp>
+
+#include <condition_variable>
+#include <mutex>
+
+#define Unit_Test_Executor_Lanes
+
+#ifdef Unit_Test_Executor_Lanes
+
+TEST (ExecutorLanes, BlockedLaneDoesNotDelayConsensus)
+{
+    ExecutorLanesConfig config;
+    config.consensus_threads = 1;
+    config.persistence_threads = 1;
+    config.network_threads = 1;
+    config.rpc_threads = 1;
+
+    ExecutorLanes lanes(config);
+    lanes.Start();
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool release = false;
+    bool consensus_ran = false;
+
+    // Occupy the only RPC thread until consensus work has run.
+    lanes.Post(Lane::Rpc, [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&]() { return release; });
+    });
+    lanes.Post(Lane::Rpc, []() {});
+
+    lanes.Post(Lane::Consensus, [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        consensus_ran = true;
+        condition.notify_all();
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(condition.wait_for(lock, std::chrono::seconds(5), [&]() { return consensus_ran; }));
+        ASSERT_GE(lanes.GetStats(Lane::Rpc).queued, 1);
+        release = true;
+        condition.notify_all();
+    }
+
+    lanes.Stop();
+    lanes.Join();
+
+    auto rpc = lanes.GetStats(Lane::Rpc);
+    ASSERT_EQ(rpc.queued, 0);
+    ASSERT_EQ(rpc.executed, 2);
+    ASSERT_EQ(lanes.GetStats(Lane::Consensus).executed, 1);
+    ASSERT_NE(&lanes.GetService(Lane::Consensus), &lanes.GetService(Lane::Rpc));
+}
+
+TEST (ExecutorLanes, Shared)
+{
+    boost::asio::io_service service;
+    ExecutorLanes lanes(service);
+
+    int count = 0;
+    lanes.Post(Lane::Consensus, [&]() { count++; });
+    lanes.Post(Lane::Rpc, [&]() { count++; });
+    service.run();
+
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(&lanes.GetService(Lane::Network), &service);
+    ASSERT_EQ(lanes.GetStats(Lane::Rpc).executed, 1);
+}
+
+#endif // Unit_Test_Executor_Lanes
@@ -71,8 +71,10 @@ public:
             _store.clear(_store.voting_power_db, tx);
             _store.clear(_store.staking_db, tx);
             _store.clear(_store.thawing_db, tx);
+            _store.clear(_store.thawing_summary_db, tx);
             _store.clear(_store.master_liabilities_db, tx);
             _store.clear(_store.secondary_liabilities_db, tx);
+            _store.clear(_store.secondary_liabilities_summary_db, tx);
             _store.clear(_store.rep_liabilities_db, tx);
             _store.clear(_store.rewards_db, tx);
             _store.clear(_store.global_rewards_db, tx);
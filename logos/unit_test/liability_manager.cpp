@@ -13,6 +13,7 @@ TEST(Liabilities, liabilities)
     logos::transaction txn(store->environment, nullptr, true);
     store->clear(store->master_liabilities_db,txn);
     store->clear(store->secondary_liabilities_db,txn);
+    store->clear(store->secondary_liabilities_summary_db,txn);
     store->clear(store->rep_liabilities_db,txn);
 
     AccountAddress origin = 67;
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <logos/lib/merkle.hpp>
+
+#include <random>
+
+#define Unit_Test_Merkle
+
+#ifdef Unit_Test_Merkle
+
+TEST (Merkle, BatchedBuilder)
+{
+    std::mt19937_64 engine(1);
+    auto builder = merkle::GetBuilder();
+
+    // Sizes around the lane and chunk boundaries, odd levels included.
+    for(size_t count : {0, 1, 2, 3, 4, 5, 7, 8, 9, 63, 64, 65, 129, 1000})
+    {
+        vector<BlockHash> leaves(count);
+        for(auto & leaf : leaves)
+        {
+            for(auto & qword : leaf.qwords)
+            {
+                qword = engine();
+            }
+        }
+
+        BlockHash roots[2];
+        BlockHash helper_roots[2];
+        for(auto b : {merkle::Builder::Serial, merkle::Builder::Batched})
+        {
+            merkle::SetBuilder(b);
+            auto level = leaves;
+            roots[b == merkle::Builder::Batched] = merkle::MerkleRoot(level);
+            helper_roots[b == merkle::Builder::Batched] = merkle::MerkleHelper([&](merkle::HashReceiverCb receiver){
+                for(auto & leaf : leaves)
+                {
+                    receiver(leaf);
+                }
+            });
+        }
+
+        ASSERT_EQ(roots[0], roots[1]) << count << " leaves";
+        ASSERT_EQ(helper_roots[0], helper_roots[1]) << count << " leaves";
+    }
+
+    merkle::SetBuilder(builder);
+}
+
+#endif // Unit_Test_Merkle
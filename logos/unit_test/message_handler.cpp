@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <logos/consensus/message_handler.hpp>
+
+#include <thread>
+
+#define Unit_Test_Message_Handler
+
+#ifdef Unit_Test_Message_Handler
+
+TEST (MessageHandler, ConcurrentIngress)
+{
+    const uint32_t PRODUCERS = 8;
+    const uint32_t REQUESTS  = 500;
+
+    std::vector<std::shared_ptr<Send>> requests;
+    for(uint32_t i = 0; i < REQUESTS; ++i)
+    {
+        requests.push_back(std::make_shared<Send>(Send(1, 2, i, 5, 6, 7, 8)));
+    }
+
+    // Every producer submits every request; each must be queued once.
+    RequestMessageHandler handler;
+    std::vector<std::thread> producers;
+    for(uint32_t p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&handler, &requests, p]()
+        {
+            for(uint32_t i = 0; i < REQUESTS; ++i)
+            {
+                handler.OnMessage(requests[(i + p * 61) % REQUESTS]);
+            }
+        });
+    }
+    for(auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    PrePrepareMessage<ConsensusType::Request> block;
+    for(uint32_t i = 0; i < REQUESTS; ++i)
+    {
+        ASSERT_TRUE(handler.Contains(requests[i]->Hash()));
+        if(i % 2)
+        {
+            block.requests.push_back(requests[i]);
+        }
+    }
+
+    handler.OnPostCommit(std::make_shared<PrePrepareMessage<ConsensusType::Request>>(block));
+
+    for(uint32_t i = 0; i < REQUESTS; ++i)
+    {
+        ASSERT_EQ(handler.Contains(requests[i]->Hash()), i % 2 == 0);
+    }
+
+    // A committed request can be queued again.
+    handler.OnMessage(requests[1]);
+    ASSERT_TRUE(handler.Contains(requests[1]->Hash()));
+
+    handler.Clear();
+    ASSERT_TRUE(handler.Empty());
+    ASSERT_FALSE(handler.Contains(requests[0]->Hash()));
+}
+
+#endif // Unit_Test_Message_Handler
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <logos/blockstore.hpp>
+#include <logos/node/utility.hpp>
+
+#define Unit_Test_MicroBlock_Accumulator
+
+#ifdef Unit_Test_MicroBlock_Accumulator
+
+TEST (MicroBlockAccumulator, Finalize)
+{
+    bool error = false;
+    logos::block_store store(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    MicroBlockAccumulator accumulator;
+
+    auto make_block = [](uint8_t delegate, uint32_t sequence, uint64_t timestamp, const BlockHash & previous)
+    {
+        ApprovedRB block;
+        block.primary_delegate = delegate;
+        block.epoch_number = 1;
+        block.sequence = sequence;
+        block.timestamp = timestamp;
+        block.previous = previous;
+        return block;
+    };
+
+    // Every delegate's chain starts at a stored block cut by the micro block.
+    ApprovedMB micro_block;
+    {
+        logos::transaction txn(store.environment, nullptr, true);
+        for(uint8_t delegate = 0; delegate < NUM_DELEGATES; ++delegate)
+        {
+            auto base = make_block(delegate, 0, 0, BlockHash());
+            ASSERT_FALSE(store.request_block_put(base, txn));
+            micro_block.tips[delegate] = base.CreateTip();
+        }
+    }
+    accumulator.Cut(micro_block, store);
+
+    auto b1 = make_block(0, 1, 100, micro_block.tips[0].digest);
+    auto b2 = make_block(0, 2, 300, b1.Hash());
+    auto c1 = make_block(1, 1, 150, micro_block.tips[1].digest);
+    accumulator.Add(0, b1);
+    accumulator.Add(0, b2);
+    accumulator.Add(1, c1);
+
+    BatchTips tips;
+    uint32_t num_blocks = 0;
+    ASSERT_FALSE(accumulator.Finalize(micro_block.tips, 200, tips, num_blocks));
+    ASSERT_EQ(num_blocks, 2);
+    ASSERT_EQ(tips[0], b1.CreateTip());
+    ASSERT_EQ(tips[1], c1.CreateTip());
+    ASSERT_EQ(tips[2], micro_block.tips[2]);
+
+    // A later cutoff takes the rest of the chain.
+    ASSERT_FALSE(accumulator.Finalize(micro_block.tips, 400, tips, num_blocks));
+    ASSERT_EQ(num_blocks, 3);
+    ASSERT_EQ(tips[0], b2.CreateTip());
+    ASSERT_EQ(tips[1], c1.CreateTip());
+
+    // A block that doesn't extend its chain breaks it...
+    BlockHash unknown;
+    unknown.bytes[0] = 1;
+    accumulator.Add(2, make_block(2, 2, 100, unknown));
+    ASSERT_TRUE(accumulator.Finalize(micro_block.tips, 400, tips, num_blocks));
+
+    // ...until the next micro block recovers it from the database.
+    ApprovedMB next_micro_block = micro_block;
+    next_micro_block.tips[0] = b1.CreateTip();
+    accumulator.Cut(next_micro_block, store);
+
+    ASSERT_TRUE(accumulator.Finalize(micro_block.tips, 400, tips, num_blocks));
+    ASSERT_FALSE(accumulator.Finalize(next_micro_block.tips, 400, tips, num_blocks));
+    ASSERT_EQ(num_blocks, 2);
+    ASSERT_EQ(tips[0], b2.CreateTip());
+    ASSERT_EQ(tips[1], c1.CreateTip());
+}
+
+#endif // Unit_Test_MicroBlock_Accumulator
@@ -66,12 +66,15 @@ void clear_dbs()
     store->clear(store->voting_power_db);
     store->clear(store->staking_db);
     store->clear(store->thawing_db);
+    store->clear(store->thawing_summary_db);
     store->clear(store->master_liabilities_db);
     store->clear(store->secondary_liabilities_db);
+    store->clear(store->secondary_liabilities_summary_db);
     store->clear(store->rep_liabilities_db);
     store->clear(store->rewards_db);
     store->clear(store->global_rewards_db);
     store->clear(store->delegate_rewards_db);
     store->clear(store->account_db);
+    store->clear(store->governance_checkpoint_db);
     store->leading_candidates_size = 0;
 }
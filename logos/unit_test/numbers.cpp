@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <logos/lib/numbers.hpp>
+
+#include <random>
+
+#define Unit_Test_Numbers
+
+#ifdef Unit_Test_Numbers
+
+namespace
+{
+
+const size_t NUMBERS_ITERATIONS = 100000;
+
+// Byte-wise reference conversions, independent of the limb fast paths.
+template <typename Number, typename Union>
+Number reference_number(const Union & value)
+{
+    Number result = 0;
+    for(auto byte : value.bytes)
+    {
+        result <<= 8;
+        result |= byte;
+    }
+    return result;
+}
+
+template <typename Union, typename Number>
+Union reference_union(Number number)
+{
+    Union result;
+    for(auto i = result.bytes.rbegin(); i != result.bytes.rend(); ++i)
+    {
+        *i = static_cast<uint8_t>(number & 0xff);
+        number >>= 8;
+    }
+    return result;
+}
+
+// Random values biased towards carries, borrows and equal limbs.
+template <typename Union>
+Union random_union(std::mt19937_64 & engine)
+{
+    Union result;
+    for(auto & qword : result.qwords)
+    {
+        switch(engine() % 4)
+        {
+            case 0:
+                qword = 0;
+                break;
+            case 1:
+                qword = std::numeric_limits<uint64_t>::max();
+                break;
+            default:
+                qword = engine();
+                break;
+        }
+    }
+    return result;
+}
+
+}
+
+TEST (Numbers, uint128_matches_boost)
+{
+    std::mt19937_64 engine(1);
+
+    for(size_t i = 0; i < NUMBERS_ITERATIONS; ++i)
+    {
+        auto a = random_union<logos::uint128_union>(engine);
+        auto b = i % 16 ? random_union<logos::uint128_union>(engine) : a;
+        auto x = reference_number<logos::uint128_t>(a);
+        auto y = reference_number<logos::uint128_t>(b);
+
+        ASSERT_EQ(a.number(), x);
+        ASSERT_EQ(logos::uint128_union(x), a);
+
+        // Fixed width boost arithmetic wraps around.
+        ASSERT_EQ(a + b, reference_union<logos::uint128_union>(logos::uint128_t(x + y)));
+        ASSERT_EQ(a - b, reference_union<logos::uint128_union>(logos::uint128_t(x - y)));
+        ASSERT_EQ(a * b, reference_union<logos::uint128_union>(logos::uint128_t(x * y)));
+
+        ASSERT_EQ(a < b, x < y);
+        ASSERT_EQ(a > b, x > y);
+        ASSERT_EQ(a <= b, x <= y);
+        ASSERT_EQ(a >= b, x >= y);
+
+        auto c = a;
+        c += b;
+        ASSERT_EQ(c, a + b);
+        c -= b;
+        ASSERT_EQ(c, a);
+    }
+}
+
+TEST (Numbers, uint256_matches_boost)
+{
+    std::mt19937_64 engine(2);
+
+    for(size_t i = 0; i < NUMBERS_ITERATIONS; ++i)
+    {
+        auto a = random_union<logos::uint256_union>(engine);
+        auto b = i % 16 ? random_union<logos::uint256_union>(engine) : a;
+        auto x = reference_number<logos::uint256_t>(a);
+        auto y = reference_number<logos::uint256_t>(b);
+
+        ASSERT_EQ(a.number(), x);
+
+        ASSERT_EQ(a + b, reference_union<logos::uint256_union>(logos::uint256_t(x + y)));
+        ASSERT_EQ(a - b, reference_union<logos::uint256_union>(logos::uint256_t(x - y)));
+        ASSERT_EQ(a < b, x < y);
+    }
+}
+
+#endif // Unit_Test_Numbers
@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+
+#include <logos/node/rpc.hpp>
+#include <logos/node/utility.hpp>
+
+#include <thread>
+
+#define Unit_Test_Read_Transactions
+
+#ifdef Unit_Test_Read_Transactions
+
+namespace
+{
+
+MDB_dbi open_db(logos::mdb_env & env)
+{
+    MDB_dbi db;
+    logos::transaction txn(env, nullptr, true);
+    EXPECT_EQ(mdb_dbi_open(txn, "read_transactions_db", MDB_CREATE, &db), 0);
+    return db;
+}
+
+void put_value(logos::mdb_env & env, MDB_dbi db, uint64_t key, uint64_t value)
+{
+    logos::transaction txn(env, nullptr, true);
+    ASSERT_EQ(mdb_put(txn, db, logos::mdb_val(key), logos::mdb_val(value), 0), 0);
+}
+
+bool get_value(logos::mdb_env & env, MDB_dbi db, uint64_t key, uint64_t & value)
+{
+    logos::transaction txn(env, nullptr, false);
+    logos::mdb_val result;
+    if(mdb_get(txn, db, logos::mdb_val(key), result))
+    {
+        return false;
+    }
+    value = *reinterpret_cast<uint64_t *>(result.data());
+    return true;
+}
+
+}
+
+TEST(Read_Transactions, PooledTransactionsAreRenewed)
+{
+    bool error = false;
+    logos::mdb_env env(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    auto db = open_db(env);
+    put_value(env, db, 1, 10);
+
+    MDB_txn * first;
+    {
+        logos::transaction txn(env, nullptr, false);
+        first = txn.handle;
+    }
+
+    // The reset transaction is renewed rather than begun anew and
+    // sees writes committed since it was last used.
+    put_value(env, db, 1, 11);
+    {
+        logos::transaction txn(env, nullptr, false);
+        ASSERT_EQ(txn.handle, first);
+    }
+
+    uint64_t value = 0;
+    ASSERT_TRUE(get_value(env, db, 1, value));
+    ASSERT_EQ(value, 11);
+
+    // Concurrent read transactions use distinct handles.
+    {
+        logos::transaction txn1(env, nullptr, false);
+        logos::transaction txn2(env, nullptr, false);
+        ASSERT_NE(txn1.handle, txn2.handle);
+    }
+
+    // Pooled transactions may move between threads.
+    std::thread reader([&]()
+    {
+        uint64_t value = 0;
+        EXPECT_TRUE(get_value(env, db, 1, value));
+        EXPECT_EQ(value, 11);
+    });
+    reader.join();
+}
+
+TEST(Read_Transactions, SnapshotIsConsistent)
+{
+    bool error = false;
+    logos::mdb_env env(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    auto db = open_db(env);
+    put_value(env, db, 1, 10);
+
+    uint64_t value = 0;
+    {
+        logos::read_snapshot snapshot(env);
+        ASSERT_EQ(logos::read_snapshot::current(env), snapshot.handle);
+
+        // Read transactions opened in scope share the snapshot.
+        {
+            logos::transaction txn(env, nullptr, false);
+            ASSERT_EQ(txn.handle, snapshot.handle);
+        }
+
+        // Nested snapshots share the outermost handle.
+        {
+            logos::read_snapshot inner(env);
+            ASSERT_EQ(inner.handle, snapshot.handle);
+        }
+        ASSERT_EQ(logos::read_snapshot::current(env), snapshot.handle);
+
+        put_value(env, db, 1, 11);
+        ASSERT_TRUE(get_value(env, db, 1, value));
+        ASSERT_EQ(value, 10);
+
+        // Other threads aren't affected by the snapshot.
+        std::thread reader([&]()
+        {
+            uint64_t value = 0;
+            EXPECT_EQ(logos::read_snapshot::current(env), nullptr);
+            EXPECT_TRUE(get_value(env, db, 1, value));
+            EXPECT_EQ(value, 11);
+        });
+        reader.join();
+    }
+
+    ASSERT_EQ(logos::read_snapshot::current(env), nullptr);
+    ASSERT_TRUE(get_value(env, db, 1, value));
+    ASSERT_EQ(value, 11);
+}
+
+TEST(Read_Transactions, HistoryCompanions)
+{
+    bool error = false;
+    logos::mdb_env env(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    logos::mdb_env history(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    auto db = open_db(env);
+    auto history_db = open_db(history);
+    env.attach_history(&history);
+
+    {
+        logos::transaction txn(env, nullptr, true);
+        ASSERT_EQ(mdb_put(txn, db, logos::mdb_val(uint64_t(1)), logos::mdb_val(uint64_t(10)), 0), 0);
+
+        // The companion is begun once and then reused.
+        auto companion = env.companion(txn);
+        ASSERT_EQ(env.companion(txn), companion);
+        ASSERT_EQ(mdb_put(companion, history_db, logos::mdb_val(uint64_t(1)), logos::mdb_val(uint64_t(20)), 0), 0);
+    }
+
+    uint64_t value = 0;
+    ASSERT_TRUE(get_value(env, db, 1, value));
+    ASSERT_EQ(value, 10);
+    ASSERT_TRUE(get_value(history, history_db, 1, value));
+    ASSERT_EQ(value, 20);
+
+    // A snapshot's companion is begun with it, not at its first use.
+    {
+        logos::read_snapshot snapshot(env);
+        put_value(history, history_db, 1, 21);
+        auto companion = env.companion(snapshot);
+
+        logos::transaction txn(env, nullptr, false);
+        logos::mdb_val result;
+        ASSERT_EQ(mdb_get(env.companion(txn), history_db, logos::mdb_val(uint64_t(1)), result), 0);
+        ASSERT_EQ(env.companion(txn), companion);
+        ASSERT_EQ(*reinterpret_cast<uint64_t *>(result.data()), 20);
+    }
+    ASSERT_TRUE(get_value(history, history_db, 1, value));
+    ASSERT_EQ(value, 21);
+}
+
+TEST(Read_Transactions, HistorySplitThenVacuum)
+{
+    auto path = logos::unique_path();
+    auto history_path = logos::unique_path();
+    ApprovedRB block;
+    block.epoch_number = 1;
+    {
+        bool error = false;
+        logos::block_store store(error, path);
+        ASSERT_FALSE(error);
+        {
+            logos::transaction txn(store.environment, nullptr, true);
+            ASSERT_FALSE(store.request_block_put(block, txn));
+        }
+        ASSERT_FALSE(store.split_history(history_path));
+    }
+
+    // The blocks moved out would otherwise be missing.
+    {
+        bool error = false;
+        logos::block_store store(error, path);
+        ASSERT_TRUE(error);
+    }
+
+    // As --vacuum --history_path does.
+    auto vacuumed = logos::unique_path();
+    {
+        bool error = false;
+        logos::block_store store(error, path, 128, history_path);
+        ASSERT_FALSE(error);
+        ASSERT_FALSE(store.copy_with_compaction(vacuumed));
+    }
+    {
+        bool error = false;
+        logos::block_store store(error, vacuumed);
+        ASSERT_TRUE(error);
+    }
+
+    bool error = false;
+    logos::block_store store(error, vacuumed, 128, history_path);
+    ASSERT_FALSE(error);
+    ApprovedRB stored;
+    ASSERT_FALSE(store.request_block_get(block.Hash(), stored));
+    ASSERT_EQ(stored.Hash(), block.Hash());
+}
+
+TEST(Read_Transactions, RpcReadScope)
+{
+    bool error = false;
+    logos::block_store store(error, logos::unique_path());
+    ASSERT_FALSE(error);
+
+    logos::rpc_config config;
+    config.read_entry_limit = 3;
+    config.read_time_limit_ms = 60000;
+    {
+        logos::rpc_read_scope scope(store, config);
+        logos::transaction txn(store.environment, nullptr, false);
+        ASSERT_EQ(txn.handle, static_cast<MDB_txn *>(scope));
+
+        ASSERT_FALSE(scope.exhausted());
+        ASSERT_FALSE(scope.exhausted());
+        ASSERT_TRUE(scope.exhausted());
+    }
+    ASSERT_EQ(logos::read_snapshot::current(store.environment), nullptr);
+
+    config.read_time_limit_ms = 0;
+    logos::rpc_read_scope scope(store, config);
+    ASSERT_TRUE(scope.exhausted());
+}
+
+#endif // Unit_Test_Read_Transactions
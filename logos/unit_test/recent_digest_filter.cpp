@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <logos/consensus/request/recent_digest_filter.hpp>
+#include <logos/lib/hash.hpp>
+
+#define Unit_Test_Recent_Digest_Filter
+
+#ifdef Unit_Test_Recent_Digest_Filter
+
+namespace
+{
+
+BlockHash digest(uint64_t i)
+{
+    BlockHash hash;
+    blake2b_state state;
+    blake2b_init(&state, sizeof(hash.bytes));
+    blake2b_update(&state, &i, sizeof(i));
+    blake2b_final(&state, hash.bytes.data(), sizeof(hash.bytes));
+    return hash;
+}
+
+}
+
+TEST (RecentDigestFilter, Generations)
+{
+    const uint64_t CAPACITY = 10000;
+    RecentDigestFilter filter(CAPACITY, std::chrono::seconds(3600));
+
+    size_t false_positives = 0;
+    for(uint64_t i = 0; i < CAPACITY / 2; ++i)
+    {
+        false_positives += filter.CheckAndInsert(digest(i));
+    }
+    ASSERT_LT(false_positives, CAPACITY / 100);
+
+    for(uint64_t i = 0; i < CAPACITY / 2; ++i)
+    {
+        ASSERT_TRUE(filter.CheckAndInsert(digest(i)));
+    }
+
+    // Filling the next two generations drops the first one's digests.
+    for(uint64_t i = CAPACITY; i < CAPACITY * 3; ++i)
+    {
+        filter.CheckAndInsert(digest(i));
+    }
+
+    size_t remembered = 0;
+    for(uint64_t i = 0; i < CAPACITY / 2; ++i)
+    {
+        remembered += filter.MayContain(digest(i));
+    }
+    ASSERT_LT(remembered, CAPACITY / 100);
+}
+
+TEST (RecentDigestFilter, Expiration)
+{
+    RecentDigestFilter filter(1000, std::chrono::seconds(0));
+
+    // Every insert ages out the current generation.
+    filter.CheckAndInsert(digest(1));
+    filter.CheckAndInsert(digest(2));
+    filter.CheckAndInsert(digest(3));
+    ASSERT_FALSE(filter.MayContain(digest(1)));
+}
+
+#endif // Unit_Test_Recent_Digest_Filter
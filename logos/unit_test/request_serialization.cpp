@@ -2157,4 +2157,124 @@ TEST (Election_Request_Hash, hash_methods)
     }
 }
 
+TEST (Request_Serialization, batched_digests)
+{
+    // Requests of every size class, hashed one at a time and in a batch.
+    std::vector<std::shared_ptr<Request>> requests;
+    for(uint32_t i = 0; i < 13; ++i)
+    {
+        auto send = std::make_shared<Send>(Send(1, 2, i, 5, 6, 7, 8));
+        for(uint32_t t = 0; t < i % Send::MAX_TRANSACTIONS; ++t)
+        {
+            send->AddTransaction(AccountAddress(t), Amount(t));
+        }
+        requests.push_back(send);
+    }
+
+    // Token and governance requests, whose digests cover their own fields.
+    requests.push_back(std::make_shared<TokenSend>(GenerateTokenSend()));
+    requests.push_back(std::make_shared<ElectionVote>(GenerateElectionVote()));
+    requests.push_back(std::make_shared<AnnounceCandidacy>(GenerateAnnounce()));
+    requests.push_back(std::make_shared<StartRepresenting>(GenerateStart()));
+
+    std::vector<BlockHash> expected;
+    for(auto & request : requests)
+    {
+        expected.push_back(request->Hash());
+        request->digest.clear();
+    }
+
+    Request::ComputeDigests(requests);
+    for(size_t i = 0; i < requests.size(); ++i)
+    {
+        ASSERT_EQ(requests[i]->GetHash(), expected[i]);
+    }
+
+    // Deserialized requests get the same digests.
+    std::vector<uint8_t> buf;
+    {
+        logos::vectorstream stream(buf);
+        for(auto & request : requests)
+        {
+            request->ToStream(stream);
+        }
+    }
+
+    std::vector<std::shared_ptr<Request>> deserialized;
+    {
+        Request::DeferDigests defer;
+        logos::bufferstream stream(buf.data(), buf.size());
+        for(size_t i = 0; i < requests.size(); ++i)
+        {
+            bool error = false;
+            deserialized.push_back(DeserializeRequest(error, stream));
+            ASSERT_FALSE(error);
+            ASSERT_EQ(deserialized.back()->type, requests[i]->type);
+            ASSERT_TRUE(deserialized.back()->GetHash().is_zero());
+        }
+    }
+
+    Request::ComputeDigests(deserialized);
+    for(size_t i = 0; i < requests.size(); ++i)
+    {
+        ASSERT_EQ(deserialized[i]->GetHash(), expected[i]);
+    }
+}
+
+TEST (Request_Serialization, wire_bytes)
+{
+    // A client's message, as a standalone TxAcceptor receives it.
+    std::vector<std::shared_ptr<Request>> sent = {
+        std::make_shared<Send>(Send(1, 2, 3, 5, 6, 7, 8)),
+        std::make_shared<TokenSend>(GenerateTokenSend()),
+        std::make_shared<ElectionVote>(GenerateElectionVote()),
+        std::make_shared<StartRepresenting>(GenerateStart())
+    };
+
+    auto buf = std::make_shared<std::vector<uint8_t>>();
+    {
+        logos::vectorstream stream(*buf);
+        for(auto & request : sent)
+        {
+            request->ToStream(stream);
+        }
+    }
+
+    logos::bufferstream stream(buf->data(), buf->size());
+    uint32_t offset = 0;
+    for(auto & request : sent)
+    {
+        bool error = false;
+        auto received = DeserializeRequest(error, stream, buf);
+        ASSERT_FALSE(error);
+
+        // The kept slice is what serializing the request again gives.
+        auto & wire = received->wire;
+        ASSERT_EQ(wire.buffer, buf);
+        ASSERT_EQ(wire.offset, offset);
+        offset += wire.size;
+
+        std::vector<uint8_t> serialized;
+        {
+            logos::vectorstream fresh(serialized);
+            received->ToStream(fresh);
+        }
+        ASSERT_EQ(std::vector<uint8_t>(buf->begin() + wire.offset, buf->begin() + wire.offset + wire.size),
+                  serialized);
+        ASSERT_EQ(received->StreamSize(), serialized.size());
+        ASSERT_EQ(received->GetHash(), request->Hash());
+    }
+    ASSERT_EQ(offset, buf->size());
+
+    // The size follows changes to the request.
+    Send send(1, 2, 3, 5, 6, 7, 8);
+    auto size = send.StreamSize();
+    ASSERT_TRUE(send.AddTransaction(AccountAddress(9), Amount(10)));
+    ASSERT_GT(send.StreamSize(), size);
+
+    std::vector<uint8_t> db_buf;
+    auto value = send.ToDatabase(db_buf);
+    ASSERT_EQ(value.size(), send.StreamSize() + Request::Locator::WireSize + sizeof(send.next.bytes));
+}
+
 #endif // #ifdef Unit_Test_Request_Serialization
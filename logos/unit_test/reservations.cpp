@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <logos/unit_test/msg_validator_setup.hpp>
+#include <logos/consensus/persistence/request/request_persistence.hpp>
+#include <logos/consensus/persistence/reservations.hpp>
+
+#define Unit_Test_Reservations
+
+#ifdef Unit_Test_Reservations
+
+TEST (Reservations, batch)
+{
+    logos::block_store * store = get_db();
+    clear_dbs();
+    ConsensusReservations reservations(*store);
+
+    // Span every stripe, twice.
+    Reservations::Batch batch;
+    for(uint64_t i = 1; i <= 2 * Reservations::STRIPES; ++i)
+    {
+        batch.emplace_back(AccountAddress(1000 + i), BlockHash(i));
+    }
+
+    std::vector<bool> results;
+    reservations.CanAcquire(batch, false, results);
+    ASSERT_EQ(results.size(), batch.size());
+    for(auto result : results)
+    {
+        ASSERT_TRUE(result);
+    }
+
+    reservations.UpdateReservations(batch);
+
+    // Duplicates can only be reacquired when allowed.
+    reservations.CanAcquire(batch, true, results);
+    for(auto result : results)
+    {
+        ASSERT_TRUE(result);
+    }
+    reservations.CanAcquire(batch, false, results);
+    for(auto result : results)
+    {
+        ASSERT_FALSE(result);
+    }
+
+    // Conflicting reservations can't be acquired until released, and
+    // releasing with the wrong hash is ignored.
+    Reservations::Batch conflicting;
+    for(uint64_t i = 1; i <= 2 * Reservations::STRIPES; ++i)
+    {
+        conflicting.emplace_back(AccountAddress(1000 + i), BlockHash(1000 + i));
+    }
+
+    reservations.CanAcquire(conflicting, true, results);
+    for(size_t i = 0; i < results.size(); ++i)
+    {
+        ASSERT_FALSE(results[i]);
+        ASSERT_EQ(results[i], reservations.CanAcquire(conflicting[i].first, conflicting[i].second, true));
+    }
+
+    reservations.Release(conflicting);
+    reservations.CanAcquire(conflicting, true, results);
+    for(auto result : results)
+    {
+        ASSERT_FALSE(result);
+    }
+
+    reservations.Release(batch);
+    reservations.CanAcquire(conflicting, false, results);
+    for(auto result : results)
+    {
+        ASSERT_TRUE(result);
+    }
+}
+
+#endif // Unit_Test_Reservations
@@ -6,6 +6,9 @@
 #include <logos/rewards/epoch_rewards_manager.hpp>
 #include <logos/unit_test/msg_validator_setup.hpp>
 #include <logos/staking/voting_power_manager.hpp>
+#include <logos/staking/staking_manager.hpp>
+#include <logos/snapshot/state_snapshot.hpp>
+#include <logos/node/utility.hpp>
 
 #include <numeric>
 
@@ -1322,4 +1325,432 @@ TEST(Rewards, Delegate_Rewards)
     EpochVotingManager::ENABLE_ELECTIONS = false;
 }
 
+TEST (Rewards, Governance_Checkpoints)
+{
+    logos::block_store* store = get_db();
+    clear_dbs();
+
+    AccountAddress account = 32746238774683;
+    AccountAddress neighbour = 32746238774684;
+    AccountAddress rep = 12132819283791273;
+
+    Proxy proxy;
+    proxy.origin = account;
+    proxy.rep = rep;
+    proxy.lock_proxy = 100;
+    proxy.epoch_num = 10;
+    proxy.governance_subchain_prev = 1;
+
+    StartRepresenting start_rep;
+    start_rep.origin = account;
+    start_rep.epoch_num = 12;
+    start_rep.governance_subchain_prev = 2;
+
+    {
+        logos::transaction txn(store->environment, nullptr, true);
+        ASSERT_FALSE(store->governance_checkpoint_put(account, proxy.epoch_num, GovernanceCheckpoint(proxy), txn));
+        ASSERT_FALSE(store->governance_checkpoint_put(account, start_rep.epoch_num, GovernanceCheckpoint(start_rep), txn));
+        ASSERT_FALSE(store->governance_checkpoint_put(neighbour, 5, GovernanceCheckpoint(start_rep), txn));
+    }
+
+    logos::transaction txn(store->environment, nullptr, false);
+    uint32_t epoch;
+    GovernanceCheckpoint checkpoint;
+
+    // Checkpoints strictly before the epoch are found, latest first.
+    ASSERT_FALSE(store->governance_checkpoint_get_prior(account, 100, epoch, checkpoint, txn));
+    ASSERT_EQ(epoch, 12);
+    ASSERT_EQ(checkpoint.type, RequestType::StartRepresenting);
+    ASSERT_EQ(checkpoint.previous, BlockHash(2));
+
+    ASSERT_FALSE(store->governance_checkpoint_get_prior(account, 12, epoch, checkpoint, txn));
+    ASSERT_EQ(epoch, 10);
+    ASSERT_EQ(checkpoint.type, RequestType::Proxy);
+    ASSERT_EQ(checkpoint.rep, rep);
+    ASSERT_EQ(checkpoint.lock_proxy, Amount(100));
+
+    // Other accounts' checkpoints aren't returned.
+    ASSERT_TRUE(store->governance_checkpoint_get_prior(account, 10, epoch, checkpoint, txn));
+    ASSERT_FALSE(store->governance_checkpoint_get_prior(neighbour, 100, epoch, checkpoint, txn));
+    ASSERT_EQ(epoch, 5);
+    ASSERT_TRUE(store->governance_checkpoint_get_prior(AccountAddress(neighbour.number() + 1), 100, epoch, checkpoint, txn));
+}
+
+TEST (Rewards, Claim_After_Snapshot_Import)
+{
+    logos::block_store* store = get_db();
+    clear_dbs();
+    std::shared_ptr<Reservations> reservations (std::make_shared<ConsensusReservations>(*store));
+    PersistenceManager<R> req_pm(*store, reservations);
+    PersistenceManager<ECT> epoch_pm(*store, nullptr);
+
+    uint32_t epoch_num = 777;
+    EpochVotingManager::ENABLE_ELECTIONS = true;
+
+    ApprovedEB eb = initialize_epoch(epoch_num, store);
+
+    AccountAddress rep = 12132819283791273;
+    AccountAddress account = 32746238774683;
+    AccountAddress candidate = 347823468274382;
+
+    {
+        logos::transaction txn(store->environment, nullptr, true);
+        // Checkpointed since genesis, as on a node that never imported.
+        store->governance_checkpoint_start_put(0, txn);
+
+        Amount balance = PersistenceManager<R>::MinTransactionFee(RequestType::Send) * 500;
+        balance += MIN_DELEGATE_STAKE;
+        for(auto address : {rep, account, candidate})
+        {
+            logos::account_info info;
+            info.SetBalance(balance, 0, txn);
+            store->account_put(address, info, txn);
+        }
+    }
+
+    std::unordered_map<AccountAddress,RequestMeta> request_meta;
+
+    auto apply = [&](auto & req)
+    {
+        req.fee = PersistenceManager<R>::MinTransactionFee(req.type);
+        request_meta[req.origin].FillIn(req, epoch_num);
+        req.Hash();
+        std::shared_ptr<Request> req_ptr(&req, [](auto r){});
+        logos::process_return result;
+        ASSERT_TRUE(req_pm.ValidateRequest(req_ptr, epoch_num, result, false, false));
+
+        logos::transaction txn(store->environment, nullptr, true);
+        store->request_put(req, txn);
+        req_pm.ApplyRequest(req_ptr, 0, epoch_num, txn);
+        request_meta[req.origin].Apply(req);
+    };
+
+    auto transition_epoch = [&]()
+    {
+        logos::transaction txn(store->environment, nullptr, true);
+        ++epoch_num;
+        eb.epoch_number = epoch_num - 1;
+        advance_supply(eb);
+
+        epoch_pm.UpdateGlobalRewards(eb, txn);
+
+        store->epoch_put(eb, txn);
+        store->epoch_tip_put(eb.CreateTip(), txn);
+        store->clear(store->leading_candidates_db, txn);
+        store->leading_candidates_size = 0;
+    };
+
+    StartRepresenting start_rep;
+    start_rep.origin = rep;
+    start_rep.set_stake = true;
+    start_rep.stake = MIN_REP_STAKE;
+    apply(start_rep);
+
+    Proxy proxy;
+    proxy.origin = account;
+    proxy.rep = rep;
+    proxy.lock_proxy = 100;
+    apply(proxy);
+
+    AnnounceCandidacy announce;
+    announce.origin = candidate;
+    announce.set_stake = true;
+    announce.stake = MIN_DELEGATE_STAKE;
+    init_ecies(announce.ecies_key);
+    apply(announce);
+
+    ElectionVote ev;
+    ev.origin = rep;
+    ev.votes.emplace_back(candidate, 8);
+    for(int i = 0; i < 3; ++i)
+    {
+        transition_epoch();
+        apply(ev);
+    }
+    transition_epoch();
+
+    Claim claim;
+    claim.origin = account;
+    claim.epoch_hash = eb.Hash();
+    claim.epoch_number = eb.epoch_number;
+    claim.fee = PersistenceManager<R>::MinTransactionFee(claim.type);
+    request_meta[account].FillIn(claim, epoch_num);
+    claim.Hash();
+
+    auto claim_balance = [&](logos::block_store & s)
+    {
+        PersistenceManager<R> pm(s, std::make_shared<ConsensusReservations>(s));
+        std::shared_ptr<Request> claim_ptr(&claim, [](auto r){});
+        logos::account_info info;
+        {
+            logos::transaction txn(s.environment, nullptr, true);
+            s.request_put(claim, txn);
+            pm.ApplyRequest(claim_ptr, 0, epoch_num, txn);
+        }
+        logos::transaction txn(s.environment, nullptr, false);
+        EXPECT_FALSE(s.account_get(account, info, txn));
+        EXPECT_EQ(info.claim_epoch, eb.epoch_number);
+        return Rational{info.GetAvailableBalance().number() + info.dust};
+    };
+
+    Rational before;
+    {
+        logos::account_info info;
+        logos::transaction txn(store->environment, nullptr, false);
+        ASSERT_FALSE(store->account_get(account, info, txn));
+        before = info.GetAvailableBalance().number() + info.dust;
+    }
+
+    auto directory = logos::unique_path();
+    SnapshotManifest exported;
+    ASSERT_FALSE(StateSnapshot::Export(*store, directory, StateSnapshotConfig::DEFAULT_CHUNK_SIZE, exported));
+    ASSERT_EQ(exported.governance_checkpoint_start, 0);
+
+    // Opening a store points the staking and rewards managers at it.
+    bool error = false;
+    logos::block_store imported(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    SnapshotManifest manifest;
+    ASSERT_FALSE(StateSnapshot::Import(imported, directory, Blake2bHash(exported), manifest));
+    ASSERT_EQ(imported.governance_checkpoint_start(), 0);
+    auto imported_balance = claim_balance(imported);
+
+    VotingPowerManager::SetInstance(*store);
+    StakingManager::SetInstance(*store);
+    EpochRewardsManager::SetInstance(*store);
+    auto balance = claim_balance(*store);
+
+    // The proxied rep's rewards were harvested, identically on both nodes.
+    ASSERT_EQ(imported_balance, balance);
+    ASSERT_GT(balance + claim.fee.number(), before);
+
+    EpochVotingManager::ENABLE_ELECTIONS = false;
+}
+
+// Exposes the plan prepared when an epoch block is validated.
+struct PlannedEpochPersistence : PersistenceManager<ECT>
+{
+    using PersistenceManager<ECT>::PersistenceManager;
+    using PersistenceManager<ECT>::PrepareTransition;
+    using PersistenceManager<ECT>::TakeTransitionPlan;
+};
+
+extern void init_tips(uint32_t epoch_num);
+
+TEST (Rewards, Transition_Plan_Matches_Inline)
+{
+    logos::block_store* store = get_db();
+    clear_dbs();
+    std::shared_ptr<Reservations> reservations (std::make_shared<ConsensusReservations>(*store));
+    PersistenceManager<R> req_pm(*store, reservations);
+    PlannedEpochPersistence epoch_pm(*store, nullptr);
+
+    uint32_t epoch_num = 777;
+    auto start_elections = EpochVotingManager::START_ELECTIONS_EPOCH;
+    EpochVotingManager::ENABLE_ELECTIONS = true;
+    // Candidates and representatives are pruned on transition, but no
+    // delegates are elected or force retired.
+    EpochVotingManager::START_ELECTIONS_EPOCH = epoch_num + 10;
+
+    ApprovedEB eb = initialize_epoch(epoch_num, store);
+    eb.transaction_fee_pool = PersistenceManager<R>::MinTransactionFee(RequestType::Send) * 500;
+
+    AccountAddress rep = 12132819283791273;
+    AccountAddress candidate = 347823468274382;
+    AccountAddress newcomer = 9283749823749;
+
+    eb.delegates[0].account = rep;
+    eb.delegates[1].account = candidate;
+
+    {
+        logos::transaction txn(store->environment, nullptr, true);
+        store->governance_checkpoint_start_put(0, txn);
+
+        Amount balance = PersistenceManager<R>::MinTransactionFee(RequestType::Send) * 500;
+        balance += MIN_DELEGATE_STAKE;
+        std::vector<AccountAddress> accounts{rep, candidate};
+        for(size_t i = 0; i < NUM_DELEGATES; ++i)
+        {
+            accounts.push_back(i);
+        }
+        for(auto address : accounts)
+        {
+            logos::account_info info;
+            info.SetBalance(balance, 0, txn);
+            store->account_put(address, info, txn);
+        }
+    }
+
+    init_tips(epoch_num);
+
+    std::unordered_map<AccountAddress,RequestMeta> request_meta;
+
+    auto apply = [&](auto & req)
+    {
+        req.fee = PersistenceManager<R>::MinTransactionFee(req.type);
+        request_meta[req.origin].FillIn(req, epoch_num);
+        req.Hash();
+        std::shared_ptr<Request> req_ptr(&req, [](auto r){});
+        logos::process_return result;
+        ASSERT_TRUE(req_pm.ValidateRequest(req_ptr, epoch_num, result, false, false));
+
+        logos::transaction txn(store->environment, nullptr, true);
+        store->request_put(req, txn);
+        req_pm.ApplyRequest(req_ptr, 0, epoch_num, txn);
+        request_meta[req.origin].Apply(req);
+    };
+
+    auto next_epoch = [&]()
+    {
+        eb.previous = eb.Hash();
+        eb.epoch_number = epoch_num;
+        advance_supply(eb);
+    };
+
+    StartRepresenting start_rep;
+    start_rep.origin = rep;
+    start_rep.set_stake = true;
+    start_rep.stake = MIN_REP_STAKE + 100;
+    apply(start_rep);
+
+    AnnounceCandidacy announce;
+    announce.origin = candidate;
+    announce.set_stake = true;
+    announce.stake = MIN_DELEGATE_STAKE + 100;
+    init_ecies(announce.ecies_key);
+    apply(announce);
+
+    next_epoch();
+    epoch_pm.ApplyUpdates(eb);
+    ++epoch_num;
+
+    // The rep's thawing funds are frozen by the next epoch block, which
+    // it is still a delegate of.
+    Stake rep_stake;
+    rep_stake.origin = rep;
+    rep_stake.stake = MIN_REP_STAKE;
+    apply(rep_stake);
+
+    next_epoch();
+    epoch_pm.ApplyUpdates(eb);
+    ++epoch_num;
+
+    Stake candidate_stake;
+    candidate_stake.origin = candidate;
+    candidate_stake.stake = MIN_DELEGATE_STAKE;
+    apply(candidate_stake);
+
+    // The rep retires in favour of the newcomer.
+    next_epoch();
+    eb.delegates[0].account = newcomer;
+    auto hash = eb.Hash();
+
+    EpochTransitionPlan plan;
+    ASSERT_FALSE(epoch_pm.PlanTransition(eb, hash, plan));
+    ASSERT_EQ(plan.retiring, std::vector<AccountAddress>{rep});
+    ASSERT_FALSE(plan.rewards.empty());
+
+    auto directory = logos::unique_path();
+    SnapshotManifest exported;
+    ASSERT_FALSE(StateSnapshot::Export(*store, directory, StateSnapshotConfig::DEFAULT_CHUNK_SIZE, exported));
+
+    auto import = [&](logos::block_store & s)
+    {
+        SnapshotManifest manifest;
+        ASSERT_FALSE(StateSnapshot::Import(s, directory, Blake2bHash(exported), manifest));
+    };
+
+    bool error = false;
+    logos::block_store missing(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    import(missing);
+    logos::block_store stale(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    import(stale);
+
+    auto point_at = [](logos::block_store & s)
+    {
+        VotingPowerManager::SetInstance(s);
+        StakingManager::SetInstance(s);
+        EpochRewardsManager::SetInstance(s);
+    };
+
+    // Validated on this node, so the commit takes the prepared plan.
+    point_at(*store);
+    epoch_pm.PrepareTransition(PrePrepareMessage<ECT>(eb));
+    epoch_pm.ApplyUpdates(eb);
+    ASSERT_EQ(epoch_pm.TakeTransitionPlan(hash), nullptr);
+
+    // Not validated on this node, so the commit plans inline.
+    point_at(missing);
+    PlannedEpochPersistence missing_pm(missing, nullptr);
+    missing_pm.ApplyUpdates(eb);
+
+    // Only validated a competing block, whose plan must not be taken.
+    point_at(stale);
+    PlannedEpochPersistence stale_pm(stale, nullptr);
+    ApprovedEB competing(eb);
+    competing.transaction_fee_pool = eb.transaction_fee_pool * 2;
+    competing.delegates[0].account = rep;
+    stale_pm.PrepareTransition(PrePrepareMessage<ECT>(competing));
+    stale_pm.ApplyUpdates(eb);
+    ASSERT_NE(stale_pm.TakeTransitionPlan(competing.Hash()), nullptr);
+
+    auto snapshot = [&](logos::block_store & s)
+    {
+        SnapshotManifest manifest;
+        EXPECT_FALSE(StateSnapshot::Export(s, logos::unique_path(), StateSnapshotConfig::DEFAULT_CHUNK_SIZE, manifest));
+        return Blake2bHash(manifest);
+    };
+
+    auto check_thawing = [&](logos::block_store & s)
+    {
+        StakingManager::SetInstance(s);
+        logos::transaction txn(s.environment, nullptr, false);
+
+        // The retiring delegate's frozen funds expire, the remaining
+        // delegate's thawing funds are frozen.
+        auto rep_thawing = StakingManager::GetInstance()->GetThawingFunds(rep, txn);
+        ASSERT_EQ(rep_thawing.size(), 1);
+        ASSERT_EQ(rep_thawing[0].expiration_epoch, eb.epoch_number + 2 + 42);
+
+        auto candidate_thawing = StakingManager::GetInstance()->GetThawingFunds(candidate, txn);
+        ASSERT_EQ(candidate_thawing.size(), 1);
+        ASSERT_EQ(candidate_thawing[0].expiration_epoch, 0);
+    };
+
+    auto next_delegates = [&](logos::block_store & s)
+    {
+        EpochVotingManager voting_mgr(s);
+        Delegate delegates[NUM_DELEGATES];
+        voting_mgr.GetNextEpochDelegates(delegates, eb.epoch_number + 2);
+
+        std::vector<AccountAddress> accounts;
+        for(auto & d : delegates)
+        {
+            accounts.push_back(d.account);
+        }
+        return accounts;
+    };
+
+    // Rewards, thawing, staking and voting power all match.
+    auto expected = snapshot(*store);
+    ASSERT_EQ(snapshot(missing), expected);
+    ASSERT_EQ(snapshot(stale), expected);
+
+    auto delegates = next_delegates(*store);
+    ASSERT_NE(std::find(delegates.begin(), delegates.end(), newcomer), delegates.end());
+    ASSERT_EQ(std::find(delegates.begin(), delegates.end(), rep), delegates.end());
+
+    for(auto s : {store, &missing, &stale})
+    {
+        check_thawing(*s);
+        ASSERT_EQ(next_delegates(*s), delegates);
+    }
+
+    point_at(*store);
+    EpochVotingManager::START_ELECTIONS_EPOCH = start_elections;
+    EpochVotingManager::ENABLE_ELECTIONS = false;
+}
+
 #endif // #ifdef Unit_Test_Rewards
@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+
+#include <logos/archive/segment_archiver.hpp>
+#include <logos/snapshot/state_snapshot.hpp>
+#include <logos/lib/hash.hpp>
+#include <logos/node/utility.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+#define Unit_Test_Segment_Store
+
+#ifdef Unit_Test_Segment_Store
+
+TEST (SegmentStore, RoundTrip)
+{
+    auto directory = logos::unique_path();
+    std::vector<std::vector<uint8_t>> records;
+    std::vector<SegmentLocation> locations;
+
+    // Small frames so records are spread over several, some of them
+    // compressible and some not.
+    SegmentWriter writer(directory, 7, 256);
+    for(size_t i = 0; i < 100; ++i)
+    {
+        std::vector<uint8_t> record(1 + i * 7 % 300);
+        for(size_t j = 0; j < record.size(); ++j)
+        {
+            record[j] = i % 2 ? j % 3 : (j * 2654435761u + i) >> 13;
+        }
+        SegmentLocation location;
+        ASSERT_FALSE(writer.Add(SegmentTable::Request, logos::mdb_val(record.size(), record.data()), location));
+        records.push_back(record);
+        locations.push_back(location);
+    }
+    ASSERT_FALSE(writer.Finish());
+    ASSERT_TRUE(boost::filesystem::exists(SegmentFormat::SegmentPath(directory, 7)));
+
+    SegmentStore store(directory, 256, 4);
+    std::vector<uint8_t> value;
+    for(size_t i = 0; i < records.size(); ++i)
+    {
+        ASSERT_EQ(locations[i].segment, 7);
+        ASSERT_FALSE(store.Read(locations[i], value));
+        ASSERT_EQ(value, records[i]);
+    }
+
+    // Corruption is detected.
+    {
+        std::fstream file(SegmentFormat::SegmentPath(directory, 7).string(),
+                          std::ios::binary | std::ios::in | std::ios::out);
+        auto position = locations.back().frame + SegmentFormat::FRAME_HEADER_SIZE + 1;
+        file.seekg(position);
+        auto byte = file.get();
+        file.seekp(position);
+        file.put(char(byte ^ 0xff));
+    }
+    SegmentStore reopened(directory, 256, 4);
+    ASSERT_TRUE(reopened.Read(locations.back(), value));
+}
+
+TEST (SegmentStore, MalformedHeaders)
+{
+    auto directory = logos::unique_path();
+    std::vector<uint8_t> record(100, 1);
+    SegmentLocation location;
+    {
+        SegmentWriter writer(directory, 3, 256);
+        ASSERT_FALSE(writer.Add(SegmentTable::Batch, logos::mdb_val(record.size(), record.data()), location));
+        ASSERT_FALSE(writer.Finish());
+    }
+
+    // Returns the value overwritten.
+    auto overwrite = [&directory](uint64_t position, uint32_t value)
+    {
+        std::fstream file(SegmentFormat::SegmentPath(directory, 3).string(),
+                          std::ios::binary | std::ios::in | std::ios::out);
+        uint32_t previous = 0;
+        file.seekg(position);
+        file.read(reinterpret_cast<char *>(&previous), sizeof(previous));
+        file.seekp(position);
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+        return previous;
+    };
+
+    std::vector<uint8_t> value;
+    {
+        SegmentStore store(directory, 256, 4);
+        ASSERT_FALSE(store.Read(location, value));
+        ASSERT_EQ(value, record);
+    }
+
+    // A frame claiming more bytes than a frame holds, or than the file has.
+    auto raw_size = overwrite(location.frame, 0xffffffff);
+    {
+        SegmentStore store(directory, 256, 4);
+        ASSERT_TRUE(store.Read(location, value));
+    }
+    overwrite(location.frame, raw_size);
+    auto stored_size = overwrite(location.frame + sizeof(uint32_t), raw_size - 1);
+    {
+        SegmentStore store(directory, 256, 4);
+        ASSERT_TRUE(store.Read(location, value));
+    }
+    overwrite(location.frame + sizeof(uint32_t), stored_size);
+
+    // Another file format, or another epoch's segment.
+    auto magic = overwrite(0, 0);
+    {
+        SegmentStore store(directory, 256, 4);
+        ASSERT_TRUE(store.Read(location, value));
+    }
+    overwrite(0, magic);
+    {
+        SegmentStore store(directory, 256, 4);
+        ASSERT_FALSE(store.Read(location, value));
+    }
+    location.segment = 4;
+    boost::filesystem::rename(SegmentFormat::SegmentPath(directory, 3), SegmentFormat::SegmentPath(directory, 4));
+    {
+        SegmentStore store(directory, 256, 4);
+        ASSERT_TRUE(store.Read(location, value));
+    }
+}
+
+TEST (SegmentStore, ArchiveEpoch)
+{
+    bool error = false;
+    logos::block_store store(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    store.open_segments(logos::unique_path(), SegmentArchiveConfig::DEFAULT_FRAME_SIZE, 16);
+
+    // Linked to its successor, which makes it immutable.
+    ApprovedRB batch;
+    batch.epoch_number = 1;
+    batch.sequence = 0;
+    batch.next = BlockHash(1);
+    ApprovedMB micro_block;
+    micro_block.epoch_number = 1;
+    micro_block.tips[0] = Tip(1, 0, batch.Hash());
+    ApprovedEB epoch;
+    epoch.epoch_number = 1;
+    epoch.micro_block_tip = micro_block.CreateTip();
+    {
+        logos::transaction txn(store.environment, nullptr, true);
+        ASSERT_FALSE(store.request_block_put(batch, txn));
+        ASSERT_FALSE(store.micro_block_put(micro_block, txn));
+        ASSERT_FALSE(store.epoch_put(epoch, txn));
+        ASSERT_FALSE(store.epoch_tip_put(epoch.CreateTip(), txn));
+    }
+
+    SegmentArchiveConfig config;
+    SegmentArchiver archiver(store, config);
+    ASSERT_FALSE(archiver.Archive(epoch, nullptr));
+
+    uint32_t archived = 0;
+    {
+        logos::transaction txn(store.environment, nullptr, false);
+        ASSERT_FALSE(store.segment_archived_get(archived, txn));
+
+        // Moved out of their tables...
+        logos::mdb_val value;
+        ASSERT_EQ(mdb_get(store.history_txn(txn), store.batch_db, logos::mdb_val(batch.Hash()), value), MDB_NOTFOUND);
+        ASSERT_EQ(mdb_get(store.history_txn(txn), store.epoch_db, logos::mdb_val(epoch.Hash()), value), MDB_NOTFOUND);
+    }
+    ASSERT_EQ(archived, 1);
+
+    // ...and still found through the store.
+    ApprovedRB batch_l;
+    ASSERT_FALSE(store.request_block_get(batch.Hash(), batch_l));
+    ASSERT_EQ(batch_l.Hash(), batch.Hash());
+    ApprovedMB micro_block_l;
+    ASSERT_FALSE(store.micro_block_get(micro_block.Hash(), micro_block_l));
+    ASSERT_EQ(micro_block_l.Hash(), micro_block.Hash());
+    ApprovedEB epoch_l;
+    ASSERT_FALSE(store.epoch_get(epoch.Hash(), epoch_l));
+    ASSERT_EQ(epoch_l.Hash(), epoch.Hash());
+    ASSERT_TRUE(store.request_block_exists(batch));
+
+    std::vector<uint8_t> raw;
+    ASSERT_GT(store.consensus_block_get_raw(micro_block.Hash(), ConsensusType::MicroBlock, 0, raw), 0);
+
+    // A record's table is checked, not only its hash.
+    ASSERT_TRUE(store.epoch_get(batch.Hash(), epoch_l));
+}
+
+TEST (SegmentStore, IdleDelegateTip)
+{
+    bool error = false;
+    logos::block_store store(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    store.open_segments(logos::unique_path(), SegmentArchiveConfig::DEFAULT_FRAME_SIZE, 16);
+
+    // Delegate 0 proposed twice in epoch 1, delegate 1 once and then stayed
+    // idle until epoch 4.
+    ApprovedRB first;
+    first.epoch_number = 1;
+    first.sequence = 0;
+    ApprovedRB last;
+    last.epoch_number = 1;
+    last.sequence = 1;
+    last.previous = first.Hash();
+    first.next = last.Hash();
+    ApprovedRB idle;
+    idle.epoch_number = 1;
+    idle.sequence = 0;
+    idle.primary_delegate = 1;
+
+    ApprovedMB micro_block;
+    micro_block.epoch_number = 1;
+    micro_block.tips[0] = last.CreateTip();
+    micro_block.tips[1] = idle.CreateTip();
+    ApprovedEB epoch;
+    epoch.epoch_number = 1;
+    epoch.micro_block_tip = micro_block.CreateTip();
+    {
+        logos::transaction txn(store.environment, nullptr, true);
+        ASSERT_FALSE(store.request_block_put(first, txn));
+        ASSERT_FALSE(store.request_block_put(last, txn));
+        ASSERT_FALSE(store.request_block_put(idle, txn));
+        ASSERT_FALSE(store.request_tip_put(0, 1, last.CreateTip(), txn));
+        ASSERT_FALSE(store.request_tip_put(1, 4, idle.CreateTip(), txn));
+        ASSERT_FALSE(store.micro_block_put(micro_block, txn));
+        ASSERT_FALSE(store.epoch_put(epoch, txn));
+        ASSERT_FALSE(store.epoch_tip_put(epoch.CreateTip(), txn));
+    }
+
+    SegmentArchiveConfig config;
+    SegmentArchiver archiver(store, config);
+    ASSERT_FALSE(archiver.Archive(epoch, nullptr));
+
+    {
+        logos::transaction txn(store.environment, nullptr, false);
+        logos::mdb_val value;
+        ASSERT_EQ(mdb_get(store.history_txn(txn), store.batch_db, logos::mdb_val(first.Hash()), value), MDB_NOTFOUND);
+        ASSERT_EQ(mdb_get(store.history_txn(txn), store.batch_db, logos::mdb_val(last.Hash()), value), 0);
+        ASSERT_EQ(mdb_get(store.history_txn(txn), store.batch_db, logos::mdb_val(idle.Hash()), value), 0);
+    }
+
+    // The idle delegate's tip is linked once it proposes in epoch 4.
+    ApprovedRB next;
+    next.epoch_number = 4;
+    next.sequence = 0;
+    next.primary_delegate = 1;
+    {
+        logos::transaction txn(store.environment, nullptr, true);
+        ASSERT_FALSE(store.consensus_block_update_next(idle.Hash(), next.Hash(), ConsensusType::Request, txn));
+        ASSERT_FALSE(store.request_block_put(next, txn));
+        ASSERT_FALSE(store.request_tip_put(1, 4, next.CreateTip(), txn));
+    }
+
+    ApprovedRB idle_l;
+    ASSERT_FALSE(store.request_block_get(idle.Hash(), idle_l));
+    ASSERT_EQ(idle_l.next, next.Hash());
+
+    // It's archived with the next epoch, delegate 0's tip still isn't.
+    ApprovedEB epoch2;
+    epoch2.epoch_number = 2;
+    epoch2.micro_block_tip = epoch.micro_block_tip;
+    ASSERT_FALSE(archiver.Archive(epoch2, &epoch));
+    {
+        logos::transaction txn(store.environment, nullptr, false);
+        logos::mdb_val value;
+        ASSERT_EQ(mdb_get(store.history_txn(txn), store.batch_db, logos::mdb_val(idle.Hash()), value), MDB_NOTFOUND);
+        ASSERT_EQ(mdb_get(store.history_txn(txn), store.batch_db, logos::mdb_val(last.Hash()), value), 0);
+
+        std::vector<BlockHash> deferred;
+        store.segment_deferred_get(deferred, txn);
+        ASSERT_EQ(deferred, std::vector<BlockHash>({last.Hash()}));
+    }
+    ASSERT_FALSE(store.request_block_get(idle.Hash(), idle_l));
+    ASSERT_EQ(idle_l.next, next.Hash());
+}
+
+TEST (SegmentStore, SnapshotOfArchivedEpoch)
+{
+    // The same chain on two nodes, one of which archives it.
+    ApprovedRB batch;
+    batch.epoch_number = 1;
+    batch.next = BlockHash(1);
+    ApprovedMB micro_block;
+    micro_block.epoch_number = 1;
+    micro_block.tips[0] = batch.CreateTip();
+    ApprovedEB epoch;
+    epoch.epoch_number = 1;
+    epoch.micro_block_tip = micro_block.CreateTip();
+
+    auto open = [&](std::unique_ptr<logos::block_store> & store)
+    {
+        bool error = false;
+        store = std::make_unique<logos::block_store>(error, logos::unique_path());
+        ASSERT_FALSE(error);
+        store->open_segments(logos::unique_path(), SegmentArchiveConfig::DEFAULT_FRAME_SIZE, 16);
+
+        logos::transaction txn(store->environment, nullptr, true);
+        ASSERT_FALSE(store->request_block_put(batch, txn));
+        ASSERT_FALSE(store->micro_block_put(micro_block, txn));
+        ASSERT_FALSE(store->epoch_put(epoch, txn));
+        ASSERT_FALSE(store->epoch_tip_put(epoch.CreateTip(), txn));
+    };
+
+    std::unique_ptr<logos::block_store> plain;
+    std::unique_ptr<logos::block_store> archiving;
+    open(plain);
+    open(archiving);
+    {
+        SegmentArchiveConfig config;
+        SegmentArchiver archiver(*archiving, config);
+        ASSERT_FALSE(archiver.Archive(epoch, nullptr));
+    }
+
+    SnapshotManifest plain_manifest;
+    SnapshotManifest archived_manifest;
+    auto directory = logos::unique_path();
+    ASSERT_FALSE(StateSnapshot::Export(*plain, logos::unique_path(), 4096, plain_manifest));
+    ASSERT_FALSE(StateSnapshot::Export(*archiving, directory, 4096, archived_manifest));
+    ASSERT_EQ(Blake2bHash(archived_manifest), Blake2bHash(plain_manifest));
+
+    // The importing node gets the archived blocks back in their tables.
+    bool error = false;
+    logos::block_store imported(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    SnapshotManifest manifest;
+    ASSERT_FALSE(StateSnapshot::Import(imported, directory, Blake2bHash(archived_manifest), manifest));
+
+    logos::transaction txn(imported.environment, nullptr, false);
+    logos::mdb_val value;
+    ASSERT_EQ(mdb_get(txn, imported.batch_db, logos::mdb_val(batch.Hash()), value), 0);
+    ASSERT_EQ(mdb_get(txn, imported.micro_block_db, logos::mdb_val(micro_block.Hash()), value), 0);
+}
+
+#endif // Unit_Test_Segment_Store
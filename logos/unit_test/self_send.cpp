@@ -89,4 +89,72 @@ TEST (Self_Send, self_send)
     ASSERT_EQ(info.GetBalance(), max_bal-fee);
 }
 
+TEST (Self_Send, validation_context)
+{
+    bool error = false;
+    boost::filesystem::path db_file("./test_db/unit_test_db.lmdb");
+    logos::block_store* store = new logos::block_store (error, db_file);
+    ASSERT_FALSE(error);
+    clear_dbs();
+    std::shared_ptr<Reservations> reservations (std::make_shared<ConsensusReservations>(*store));
+    PersistenceManager<R> req_pm(*store, reservations);
+
+    Amount fee = PersistenceManager<R>::MinTransactionFee(RequestType::Send);
+    Amount initial_balance = fee * 100;
+
+    AccountAddress account = 11;
+    AccountAddress account2 = 34;
+    AccountAddress account3 = 42;
+    {
+        logos::transaction txn(store->environment, nullptr, true);
+        for(auto & address : {account, account2, account3})
+        {
+            logos::account_info info;
+            info.SetBalance(initial_balance, 0, txn);
+            ASSERT_FALSE(store->account_put(address, info, txn));
+        }
+    }
+
+    // account -> account2, then account2 -> account3 in the same block
+    std::shared_ptr<Send> send = std::make_shared<Send>();
+    send->origin = account;
+    send->AddTransaction(account2, 5);
+    send->fee = fee;
+    send->Hash();
+    std::shared_ptr<Send> send2 = std::make_shared<Send>();
+    send2->origin = account2;
+    send2->AddTransaction(account3, 7);
+    send2->fee = fee;
+    send2->Hash();
+
+    PersistenceManager<R>::ValidationContext context;
+    logos::process_return result;
+    ASSERT_TRUE(req_pm.ValidateAndUpdate(send, 0, result, true, &context));
+    ASSERT_TRUE(req_pm.ValidateAndUpdate(send2, 0, result, true, &context));
+    ASSERT_EQ(context.validated, 2);
+    ASSERT_EQ(context.accounts.size(), 2);
+    auto validated = context.accounts[account].info;
+    auto validated2 = context.accounts[account2].info;
+
+    {
+        logos::transaction txn(store->environment, nullptr, true);
+        req_pm.ApplyRequest(send, 0, 0, txn, &context);
+        req_pm.ApplyRequest(send2, 0, 0, txn, &context);
+    }
+    ASSERT_TRUE(context.accounts.empty());
+
+    // account was unchanged since validation and is reused, account2
+    // received from send and is decoded again.
+    ASSERT_EQ(validated->GetBalance(), initial_balance - 5 - fee);
+    ASSERT_EQ(validated2->GetBalance(), initial_balance);
+
+    logos::account_info info;
+    ASSERT_FALSE(store->account_get(account, info));
+    ASSERT_EQ(info.GetBalance(), initial_balance - 5 - fee);
+    ASSERT_FALSE(store->account_get(account2, info));
+    ASSERT_EQ(info.GetBalance(), initial_balance + 5 - 7 - fee);
+    ASSERT_FALSE(store->account_get(account3, info));
+    ASSERT_EQ(info.GetBalance(), initial_balance + 7);
+}
+
 #endif // #ifdef Unit_Test_Self_Send
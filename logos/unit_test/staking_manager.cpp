@@ -1011,6 +1011,57 @@ TEST(Staking_Manager, Extract)
 
 
 
+}
+
+
+TEST(Staking_Manager, ThawingSummary)
+{
+    logos::block_store* store = get_db();
+    clear_dbs();
+    logos::transaction txn(store->environment, nullptr, true);
+
+    StakingManager staking_mgr(*store);
+
+    AccountAddress origin = 456;
+    AccountAddress target = 44;
+    uint32_t epoch = 60;
+
+    auto expect = [&](uint32_t count, Amount total, uint32_t earliest)
+    {
+        ThawingSummary summary;
+        ASSERT_FALSE(store->thawing_summary_get(origin, summary, txn));
+        ASSERT_EQ(summary.count, count);
+        ASSERT_EQ(summary.total, total);
+        ASSERT_EQ(summary.earliest_expiration, earliest);
+    };
+
+    ThawingFunds t1 = staking_mgr.CreateThawingFunds(target,origin,epoch,txn);
+    t1.amount = 10;
+    staking_mgr.Store(t1, origin, txn);
+    ThawingFunds t2 = staking_mgr.CreateThawingFunds(target,origin,epoch+1,txn);
+    t2.amount = 20;
+    staking_mgr.Store(t2, origin, txn);
+    expect(2, 30, epoch+42);
+
+    //consolidated funds are counted once
+    ThawingFunds t3 = staking_mgr.CreateThawingFunds(target,origin,epoch+1,txn);
+    t3.amount = 5;
+    staking_mgr.Store(t3, origin, txn);
+    expect(2, 35, epoch+42);
+
+    //earliest expiration is only a lower bound after a delete
+    staking_mgr.UpdateAmountAndStore(t1, origin, 0, txn);
+    expect(1, 25, epoch+42);
+
+    //nothing to prune before the earliest expiration
+    logos::account_info info;
+    ASSERT_EQ(staking_mgr.GetPruneableThawingAmount(origin, info, epoch+42, txn), 0);
+
+    //pruning makes it exact
+    staking_mgr.PruneThawing(origin, info, epoch+42, txn);
+    expect(1, 25, epoch+43);
+    ASSERT_EQ(staking_mgr.GetPruneableThawingAmount(origin, info, epoch+43, txn), 25);
+    ASSERT_EQ(staking_mgr.GetThawingFunds(origin, txn).size(), 1);
 }
 
 
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <logos/snapshot/state_snapshot.hpp>
+#include <logos/node/utility.hpp>
+#include <logos/lib/hash.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+#define Unit_Test_State_Snapshot
+
+#ifdef Unit_Test_State_Snapshot
+
+namespace
+{
+
+const uint64_t SNAPSHOT_ACCOUNTS = 1000;
+
+void populate(logos::block_store & store, ApprovedEB & epoch)
+{
+    logos::transaction txn(store.environment, nullptr, true);
+
+    epoch.epoch_number = 5;
+    ASSERT_FALSE(store.epoch_put(epoch, txn));
+    ASSERT_FALSE(store.epoch_tip_put(epoch.CreateTip(), txn));
+
+    for(uint64_t i = 1; i <= SNAPSHOT_ACCOUNTS; ++i)
+    {
+        logos::account_info info;
+        info.head = BlockHash(i);
+        info.block_count = i;
+        ASSERT_FALSE(store.account_put(AccountAddress(i), info, txn));
+    }
+
+    ThawingSummary summary;
+    summary.count = 2;
+    summary.total = 300;
+    summary.earliest_expiration = 7;
+    ASSERT_FALSE(store.thawing_summary_put(AccountAddress(1), summary, txn));
+}
+
+}
+
+TEST (StateSnapshot, ExportImport)
+{
+    bool error = false;
+    logos::block_store source(error, logos::unique_path());
+    ASSERT_FALSE(error);
+
+    ApprovedEB epoch;
+    populate(source, epoch);
+
+    // Small chunks to span several files.
+    auto directory = logos::unique_path();
+    SnapshotManifest exported;
+    ASSERT_FALSE(StateSnapshot::Export(source, directory, 4096, exported));
+    ASSERT_GT(exported.chunks.size(), 1);
+    ASSERT_EQ(exported.epoch_number, 5);
+    ASSERT_EQ(exported.epoch_hash, epoch.Hash());
+
+    auto trusted_hash = Blake2bHash(exported);
+
+    // The manifest must match the trusted hash.
+    {
+        logos::block_store target(error, logos::unique_path());
+        ASSERT_FALSE(error);
+        SnapshotManifest imported;
+        ASSERT_TRUE(StateSnapshot::Import(target, directory, BlockHash(1), imported));
+
+        Tip tip;
+        ASSERT_TRUE(target.epoch_tip_get(tip));
+    }
+
+    logos::block_store target(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    SnapshotManifest imported;
+    ASSERT_FALSE(StateSnapshot::Import(target, directory, trusted_hash, imported));
+    ASSERT_EQ(Blake2bHash(imported), trusted_hash);
+
+    Tip tip;
+    ASSERT_FALSE(target.epoch_tip_get(tip));
+    ASSERT_EQ(tip.digest, epoch.Hash());
+
+    for(uint64_t i = 1; i <= SNAPSHOT_ACCOUNTS; ++i)
+    {
+        logos::account_info info;
+        ASSERT_FALSE(target.account_get(AccountAddress(i), info));
+        ASSERT_EQ(info.head, BlockHash(i));
+        ASSERT_EQ(info.block_count, i);
+    }
+
+    // Summaries come along, so accounts don't have to be touched again.
+    ThawingSummary summary;
+    {
+        logos::transaction txn(target.environment, nullptr, false);
+        ASSERT_FALSE(target.thawing_summary_get(AccountAddress(1), summary, txn));
+    }
+    ASSERT_EQ(summary.count, 2);
+    ASSERT_EQ(summary.total, 300);
+    ASSERT_EQ(summary.earliest_expiration, 7);
+
+    // A store with a chain can't be imported into.
+    ASSERT_TRUE(StateSnapshot::Import(target, directory, trusted_hash, imported));
+}
+
+TEST (StateSnapshot, TamperedChunk)
+{
+    bool error = false;
+    logos::block_store source(error, logos::unique_path());
+    ASSERT_FALSE(error);
+
+    ApprovedEB epoch;
+    populate(source, epoch);
+
+    auto directory = logos::unique_path();
+    SnapshotManifest exported;
+    ASSERT_FALSE(StateSnapshot::Export(source, directory, 4096, exported));
+
+    {
+        std::fstream chunk((directory / "chunk_000001.bin").string(),
+                           std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(chunk.is_open());
+        chunk.seekp(100);
+        chunk.put('x');
+    }
+
+    // Nothing is committed, not even the chunks preceding the bad one.
+    logos::block_store target(error, logos::unique_path());
+    ASSERT_FALSE(error);
+    SnapshotManifest imported;
+    ASSERT_TRUE(StateSnapshot::Import(target, directory, Blake2bHash(exported), imported));
+
+    logos::account_info info;
+    ASSERT_TRUE(target.account_get(AccountAddress(1), info));
+}
+
+#endif // Unit_Test_State_Snapshot
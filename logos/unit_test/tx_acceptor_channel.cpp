@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <logos/tx_acceptor/tx_acceptor_channel.hpp>
+#include <logos/tx_acceptor/tx_message_header.hpp>
+#include <logos/request/utility.hpp>
+
+#include <boost/asio/read.hpp>
+
+#define Unit_Test_TxAcceptorChannel
+
+#ifdef Unit_Test_TxAcceptorChannel
+
+TEST (TxAcceptorChannel, BuildFrame)
+{
+    using DM = DelegateMessage<ConsensusType::Request>;
+
+    // A client's message of three requests.
+    auto buf = std::make_shared<std::vector<uint8_t>>();
+    {
+        logos::vectorstream stream(*buf);
+        for(uint32_t i = 0; i < 3; ++i)
+        {
+            Send send(1, 2, i, 5, 6, 7, 8);
+            send.ToStream(stream);
+        }
+    }
+
+    std::vector<std::shared_ptr<DM>> received;
+    logos::bufferstream stream(buf->data(), buf->size());
+    for(uint32_t i = 0; i < 3; ++i)
+    {
+        bool error = false;
+        received.push_back(static_pointer_cast<DM>(DeserializeRequest(error, stream, buf)));
+        ASSERT_FALSE(error);
+    }
+
+    // A request received in json sits between the second and the third.
+    std::shared_ptr<Request> json = std::make_shared<Send>(Send(3, 4, 0, 5, 6, 7, 8));
+    std::vector<std::shared_ptr<DM>> blocks = {
+        received[0],
+        received[1],
+        static_pointer_cast<DM>(json),
+        received[2]
+    };
+
+    auto writes = TxAcceptorChannel::BuildFrame(blocks);
+
+    // The header, the first two requests merged, the serialized one and the third.
+    ASSERT_EQ(writes.size(), 4);
+    ASSERT_EQ(writes[1].buffer.size(), received[0]->wire.size + received[1]->wire.size);
+    ASSERT_EQ(writes[3].buffer.size(), received[2]->wire.size);
+
+    std::vector<uint8_t> expected;
+    {
+        logos::vectorstream stream(expected);
+        for(auto & block : blocks)
+        {
+            block->ToStream(stream);
+        }
+    }
+
+    // Write the frame to a local socket, as NetIOSend does to the delegate.
+    boost::asio::io_service service;
+    boost::asio::ip::tcp::acceptor acceptor(service, {boost::asio::ip::address_v4::loopback(), 0});
+    auto sender = std::make_shared<boost::asio::ip::tcp::socket>(service);
+    boost::asio::ip::tcp::socket receiver(service);
+    sender->connect(acceptor.local_endpoint());
+    acceptor.accept(receiver);
+
+    auto send = std::make_shared<NetIOSend>(sender);
+    ASSERT_TRUE(send->AsyncSend(std::move(writes)));
+    service.run();
+
+    std::vector<uint8_t> header_buf(TxMessageHeader::MESSAGE_SIZE);
+    boost::asio::read(receiver, boost::asio::buffer(header_buf));
+    bool error = false;
+    TxMessageHeader header(error, header_buf.data(), header_buf.size());
+    ASSERT_FALSE(error);
+    ASSERT_EQ(header.mpf, blocks.size());
+    ASSERT_EQ(header.payload_size, expected.size());
+
+    std::vector<uint8_t> payload(header.payload_size);
+    boost::asio::read(receiver, boost::asio::buffer(payload));
+    ASSERT_EQ(payload, expected);
+}
+
+#endif // #ifdef Unit_Test_TxAcceptorChannel
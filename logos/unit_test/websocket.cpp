@@ -1,3 +1,15 @@
+#include <gtest/gtest.h>
+
+#include <logos/node/websocket.hpp>
+#include <logos/request/requests.hpp>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include <sstream>
+#include <thread>
+
+#define Unit_Test_Websocket_Account_Filter
+
 //TODO the unit tests are not working, and we are out of time to fix them. We still keep them here for later fix.
 //#include <boost/asio.hpp>
 //#include <boost/beast.hpp>
@@ -416,3 +428,108 @@
 //	client_thread_3.join ();
 //	node1->stop ();
 //}
+
+#ifdef Unit_Test_Websocket_Account_Filter
+
+namespace
+{
+using test_stream = boost::beast::websocket::stream<boost::asio::ip::tcp::socket>;
+
+boost::property_tree::ptree websocket_read (test_stream & ws)
+{
+	boost::beast::flat_buffer buffer;
+	ws.read (buffer);
+	std::stringstream stream;
+	stream << beast_buffers (buffer.data ());
+	boost::property_tree::ptree tree;
+	boost::property_tree::read_json (stream, tree);
+	return tree;
+}
+
+/** Send \p message_a and wait for its acknowledgement, failing if anything else arrives first */
+void websocket_call (test_stream & ws, std::string const & message_a)
+{
+	ws.write (boost::asio::buffer (message_a));
+	auto reply (websocket_read (ws));
+	ASSERT_TRUE (reply.get_optional<std::string> ("ack"));
+}
+
+std::string subscribe_accounts (AccountAddress const & account, bool include_rb)
+{
+	return R"json({"action": "subscribe", "topic": "confirmation", "ack": true, "options": {"include_request_block": )json" +
+	std::string (include_rb ? "true" : "false") + R"json(, "accounts": [")json" + account.to_account () + R"json("]}})json";
+}
+}
+
+/** Tests request filtering by account, through the listener's inverted index */
+TEST (websocket, account_filter)
+{
+	AccountAddress a (1), b (2), c (3), d (4);
+
+	// Only the requests touching a subscribed account are sent.
+	ApprovedRB block;
+	block.requests.push_back (std::make_shared<Send> (a, 0, 0, d, 10, 1, 0));
+	block.requests.push_back (std::make_shared<Send> (b, 0, 0, c, 10, 1, 0));
+	block.requests.push_back (std::make_shared<Send> (c, 0, 0, a, 10, 1, 0));
+	for (auto & request : block.requests)
+	{
+		block.hashes.push_back (request->Hash ());
+	}
+
+	boost::asio::io_service service;
+	std::string local_address ("127.0.0.1");
+	auto websocket_server (std::make_shared<logos::websocket::listener> (service, local_address));
+	websocket_server->run ();
+	std::thread io_thread ([&service]() {
+		service.run ();
+	});
+
+	boost::asio::io_context ioc;
+	test_stream ws (ioc);
+	ws.next_layer ().connect (boost::asio::ip::tcp::endpoint (boost::asio::ip::address::from_string (local_address),
+	                                                          logos::websocket::listener_port));
+	ws.handshake (local_address, "/");
+	ws.text (true);
+
+	websocket_call (ws, subscribe_accounts (a, true));
+	ASSERT_EQ (1, websocket_server->subscriber_count (logos::websocket::topic::confirmation));
+
+	websocket_server->broadcast_confirmation (block);
+	{
+		auto message (websocket_read (ws));
+		ASSERT_EQ (message.get<std::string> ("block.hash"), block.Hash ().to_string ());
+		ASSERT_EQ (message.get<std::string> ("block.request_count"), "3");
+		auto & requests (message.get_child ("block.requests"));
+		ASSERT_EQ (requests.size (), 2);
+		auto request (requests.begin ());
+		ASSERT_EQ (request->second.get<std::string> ("hash"), block.hashes[0].to_string ());
+		++request;
+		ASSERT_EQ (request->second.get<std::string> ("hash"), block.hashes[2].to_string ());
+	}
+
+	// Unsubscribing removes the session from the index; a stale entry for a
+	// would add its requests to those of b.
+	websocket_call (ws, R"json({"action": "unsubscribe", "topic": "confirmation", "ack": true})json");
+	ASSERT_EQ (0, websocket_server->subscriber_count (logos::websocket::topic::confirmation));
+	websocket_call (ws, subscribe_accounts (b, true));
+
+	websocket_server->broadcast_confirmation (block);
+	{
+		auto message (websocket_read (ws));
+		auto & requests (message.get_child ("block.requests"));
+		ASSERT_EQ (requests.size (), 1);
+		ASSERT_EQ (requests.begin ()->second.get<std::string> ("hash"), block.hashes[1].to_string ());
+	}
+
+	// Excluding request blocks excludes the filtered requests too, so the
+	// next message is the acknowledgement of the following subscription.
+	websocket_call (ws, subscribe_accounts (b, false));
+	websocket_server->broadcast_confirmation (block);
+	websocket_call (ws, subscribe_accounts (b, true));
+
+	ws.close (boost::beast::websocket::close_code::normal);
+	websocket_server->stop ();
+	io_thread.join ();
+}
+
+#endif // #ifdef Unit_Test_Websocket_Account_Filter